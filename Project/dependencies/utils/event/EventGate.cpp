@@ -0,0 +1,105 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		EventGate.cpp
+  * @brief 		Implemenation of EventGate utility class
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the definition/implemenation
+  *           for the `EventGate` class' functionality
+  */
+
+/// @brief begin of EVENTGATE_CPP implementation
+#ifndef EVENTGATE_CPP
+#define EVENTGATE_CPP
+
+#include "./EventGate.h"
+
+/// @param[in] now ~ current time (in milliseconds)
+/// @return    `true` if the event is to be delivered at once,
+///            otherwise `false` (pending until `due()`)
+bool EventGate::post(unsigned long long now) {
+
+  mPosted++;
+
+  switch (mPolicy.mode()) {
+
+    case EventPolicy::IMMEDIATE: {
+      deliver(now);
+      return true;
+    }
+
+    case EventPolicy::THROTTLE: {
+      // leading edge ~ the first event after a quiet interval ...
+      if (!mPending && (!mDeliveredOnce || now - mLast >= mPolicy.interval())) {
+        deliver(now);
+        return true;
+      }
+      // ... trailing edge ~ the last event of the interval
+      if (mPending) {
+        mDropped++;
+      }
+      mPending = true;
+      mDue = mLast + mPolicy.interval();
+      return false;
+    }
+
+    case EventPolicy::DEBOUNCE:
+    case EventPolicy::IDLE: {
+      if (mPending) {
+        mDropped++;
+      }
+      mPending = true;
+      mDue = now + mPolicy.interval();
+      return false;
+    }
+  }
+
+  return false;
+}
+
+/// @param[in] now ~ current time (in milliseconds)
+/// @param[in] busy ~ whether input is pending (deferring `IDLE` delivery)
+/// @return    `true` if the pending event is to be delivered now,
+///            otherwise `false` (re-arm the timer until `due()` if still `pending()`)
+bool EventGate::fire(unsigned long long now, bool busy) {
+
+  if (!mPending || now < mDue) {
+    return false;
+  }
+  if (busy && mPolicy.mode() == EventPolicy::IDLE) {
+    mDue = now + mPolicy.interval();
+    return false;
+  }
+  deliver(now);
+  return true;
+}
+
+/// @param[in] now ~ current time (in milliseconds)
+/// @return    `true` if an event was pending (i.e. is to be delivered)
+bool EventGate::flush(unsigned long long now) {
+  if (!mPending) {
+    return false;
+  }
+  deliver(now);
+  return true;
+}
+
+/// @details the pending event counts as dropped
+void EventGate::cancel() {
+  if (mPending) {
+    mPending = false;
+    mDropped++;
+  }
+}
+
+/// @param[in] now ~ time of the delivery (in milliseconds)
+void EventGate::deliver(unsigned long long now) {
+  mPending = false;
+  mDelivered++;
+  mLast = now;
+  mDeliveredOnce = true;
+}
+
+#endif // end of EVENTGATE_CPP
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
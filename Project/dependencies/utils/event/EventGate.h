@@ -0,0 +1,152 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		EventGate.h
+  * @brief 		Declaration of EventPolicy & EventGate utility classes
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the method signatures for the `EventGate` class,
+  *           which decides when bursts of events are delivered to a listener
+  *           according to an `EventPolicy` (immediate, debounce, throttle, idle)
+  */
+
+#pragma once
+
+/// @brief begin of EVENTGATE_H declaration
+#ifndef EVENTGATE_H
+#define EVENTGATE_H
+
+#include <cstddef> // std::size_t
+
+/**
+ * @class   EventPolicy
+ * @brief   delivery policy of a listener
+ * @details - `IMMEDIATE` ~ every event is delivered as it happens <br/>
+ *          - `DEBOUNCE`  ~ a burst is delivered once, `interval` ms after its last event <br/>
+ *          - `THROTTLE`  ~ at most one delivery per `interval` ms, the first event of a
+ *                          burst being delivered at once & the last one at the end <br/>
+ *          - `IDLE`      ~ as `DEBOUNCE`, further deferred while input is pending
+ */
+class EventPolicy {
+
+public:
+
+  /// @brief delivery modes
+  enum Mode {
+    IMMEDIATE,
+    DEBOUNCE,
+    THROTTLE,
+    IDLE,
+  };
+
+  /// @brief default constructor ~ immediate delivery
+  EventPolicy() = default;
+
+  /// @brief constructor ~ mode & interval (in milliseconds)
+  EventPolicy(Mode mode, unsigned interval) : mMode(mode), mInterval(interval) {}
+
+  /// @brief factory method ~ every event delivered as it happens
+  static EventPolicy immediate() { return EventPolicy(); }
+
+  /// @brief factory method ~ bursts delivered `ms` after their last event
+  static EventPolicy debounce(unsigned ms) { return EventPolicy(DEBOUNCE, ms); }
+
+  /// @brief factory method ~ at most one delivery per `ms`
+  static EventPolicy throttle(unsigned ms) { return EventPolicy(THROTTLE, ms); }
+
+  /// @brief factory method ~ bursts delivered once no input is pending (checked every `ms`)
+  static EventPolicy idle(unsigned ms = 10) { return EventPolicy(IDLE, ms); }
+
+  /// @brief method to retrieve the delivery mode
+  Mode mode() const { return mMode; }
+
+  /// @brief method to retrieve the interval (in milliseconds)
+  unsigned interval() const { return mInterval; }
+
+private:
+
+  Mode mMode = IMMEDIATE;
+  unsigned mInterval = 0;
+};
+
+/**
+ * @class   EventGate
+ * @brief   collapses bursts of events according to an `EventPolicy`
+ * @details The gate only decides, the caller owning the clock & the timer: <br/>
+ *          `post(now)` returns `true` if the event is to be delivered at once,
+ *          otherwise the event is pending & `fire(now)` is to be invoked at `due()`;
+ *          `fire(...)` returns `true` if the pending event is to be delivered then,
+ *          otherwise `due()` was moved (i.e. by a later event) & the timer is re-armed <br/>
+ *          A pending event superseded by a later one is counted as dropped,
+ *          so that `posted() == delivered() + dropped()` once nothing is pending
+ */
+class EventGate {
+
+public:
+
+  /// @brief default constructor ~ immediate delivery
+  EventGate() = default;
+
+  /// @brief constructor ~ delivery policy
+  explicit EventGate(EventPolicy policy) : mPolicy(policy) {}
+
+  /// @brief method to change the delivery policy (a pending event is kept)
+  void setPolicy(EventPolicy policy) { mPolicy = policy; }
+
+  /// @brief method to retrieve the delivery policy
+  EventPolicy policy() const { return mPolicy; }
+
+  /// @brief method to record an event
+  bool post(unsigned long long now);
+
+  /// @brief method to check whether the pending event is due
+  bool fire(unsigned long long now, bool busy = false);
+
+  /// @brief method to deliver the pending event (if any) at once
+  bool flush(unsigned long long now);
+
+  /// @brief method to drop the pending event (if any)
+  void cancel();
+
+  /// @brief method to check whether an event is pending
+  bool pending() const { return mPending; }
+
+  /// @brief method to retrieve the time at which the pending event is due
+  unsigned long long due() const { return mDue; }
+
+  /// @brief method to retrieve the number of events posted
+  std::size_t posted() const { return mPosted; }
+
+  /// @brief method to retrieve the number of events delivered
+  std::size_t delivered() const { return mDelivered; }
+
+  /// @brief method to retrieve the number of events collapsed into a later one
+  std::size_t dropped() const { return mDropped; }
+
+  /// @brief method to reset the counters
+  void resetCounters() { mPosted = mDelivered = mDropped = 0; }
+
+private:
+
+  /// @brief the delivery policy
+  EventPolicy mPolicy;
+
+  /// @brief flag indicating whether an event is pending
+  bool mPending = false;
+  /// @brief time at which the pending event is due
+  unsigned long long mDue = 0;
+  /// @brief time of the last delivery (throttle)
+  unsigned long long mLast = 0;
+  /// @brief flag indicating whether any event was delivered (throttle)
+  bool mDeliveredOnce = false;
+
+  std::size_t mPosted = 0;
+  std::size_t mDelivered = 0;
+  std::size_t mDropped = 0;
+
+  /// @brief helper method to account for a delivery
+  void deliver(unsigned long long now);
+};
+
+#endif // end of EVENTGATE_H
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
@@ -0,0 +1,150 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		LineIndex.cpp
+  * @brief 		Implemenation of LineIndex utility class
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the definition/implemenation
+  *           for the `LineIndex` class' functionality
+  */
+
+/// @brief begin of LINEINDEX_CPP implementation
+#ifndef LINEINDEX_CPP
+#define LINEINDEX_CPP
+
+#include "./LineIndex.h"
+
+#include <chrono>
+#include <cstring>
+
+/// @param[in] data ~ first byte of the text
+/// @param[in] size ~ size (in bytes) of the text
+void LineIndex::build(const unsigned char* data, std::size_t size) {
+  cancel();
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mStarts.assign(1, 0);
+    mScanned = 0;
+  }
+  extend(data, size);
+}
+
+/// @param[in] data ~ first byte of the text (MAY differ from the previous call, i.e. re-mapped)
+/// @param[in] size ~ size (in bytes) of the text, the bytes before `scanned()` being unchanged
+/// @details   a text shorter than the bytes scanned (i.e. truncated) is indexed from scratch
+void LineIndex::extend(const unsigned char* data, std::size_t size) {
+  cancel();
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (size < mScanned) {
+      mStarts.assign(1, 0);
+      mScanned = 0;
+    }
+    mSize = size;
+    mFinished = (mScanned == mSize);
+    if (mFinished) {
+      return;
+    }
+    mRunning = true;
+  }
+  mWorker = std::thread(&LineIndex::scan, this, data, size);
+}
+
+/// @details joins the worker, keeping the lines indexed so far
+void LineIndex::cancel() {
+  mCancel = true;
+  if (mWorker.joinable()) {
+    mWorker.join();
+  }
+  mCancel = false;
+}
+
+/// @details returns immediately if no scan is running
+void LineIndex::wait() {
+  std::unique_lock<std::mutex> lock(mMutex);
+  mDone.wait(lock, [this]() { return !mRunning; });
+}
+
+bool LineIndex::done() const {
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mFinished;
+}
+
+std::size_t LineIndex::lineCount() const {
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mFinished ? mStarts.size() : mStarts.size() - 1;
+}
+
+/// @param[in] line ~ index of the line, less than `lineCount()`
+std::size_t LineIndex::lineStart(std::size_t line) const {
+  std::lock_guard<std::mutex> lock(mMutex);
+  return static_cast<std::size_t>(mStarts[line]);
+}
+
+/// @param[in] line ~ index of the line, less than `lineCount()`
+std::size_t LineIndex::lineEnd(std::size_t line) const {
+  std::lock_guard<std::mutex> lock(mMutex);
+  if (line + 1 < mStarts.size()) {
+    return static_cast<std::size_t>(mStarts[line + 1] - 1);
+  }
+  return mScanned;
+}
+
+std::size_t LineIndex::scanned() const {
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mScanned;
+}
+
+/// @param[in] data ~ first byte of the text
+/// @param[in] size ~ size (in bytes) of the text
+void LineIndex::scan(const unsigned char* data, std::size_t size) {
+
+  auto start = std::chrono::steady_clock::now();
+
+  std::size_t pos;
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    pos = mScanned;
+  }
+
+  std::vector<std::uint64_t> found;
+  while (pos < size && !mCancel) {
+
+    const std::size_t end = (size - pos > CHUNK) ? pos + CHUNK : size;
+
+    // `memchr` is vectorized by the C runtime ...
+    const unsigned char* p = data + pos;
+    const unsigned char* last = data + end;
+    while (p < last) {
+      const void* nl = std::memchr(p, '\n', static_cast<std::size_t>(last - p));
+      if (!nl) {
+        break;
+      }
+      p = static_cast<const unsigned char*>(nl) + 1;
+      found.push_back(static_cast<std::uint64_t>(p - data));
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mMutex);
+      mStarts.insert(mStarts.end(), found.begin(), found.end());
+      mScanned = end;
+      mFinished = (mScanned == mSize);
+    }
+    found.clear();
+    pos = end;
+  }
+
+  mElapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - start
+  ).count();
+
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mRunning = false;
+  }
+  mDone.notify_all();
+}
+
+#endif // end of LINEINDEX_CPP
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
@@ -0,0 +1,120 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		LineIndex.h
+  * @brief 		Declaration of LineIndex utility class
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the method signatures for the `LineIndex` class,
+  *           which records the offset of every line of a (mapped) text in the background
+  */
+
+#pragma once
+
+/// @brief begin of LINEINDEX_H declaration
+#ifndef LINEINDEX_H
+#define LINEINDEX_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef> // std::size_t
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class   LineIndex
+ * @brief   background-built index of line starts
+ * @details The text is scanned for `\n` in chunks of `CHUNK` bytes by a worker thread,
+ *          the offsets found being published after each chunk, so that the lines
+ *          indexed so far can be used while the rest of the text is scanned. <br/>
+ *          `extend(...)` resumes the scan where it stopped, i.e. for a file growing
+ *          at its end (tailing) <br/>
+ *          Each line costs 8 bytes of index
+ * @note    the scanned memory MUST remain valid until `cancel()` (or the next
+ *          `build(...)`/`extend(...)`/destruction) returns
+ */
+class LineIndex {
+
+public:
+
+  /// @brief number of bytes scanned between two publications
+  static const std::size_t CHUNK = 1 << 20;
+
+public:
+
+  /// @brief default constructor ~ empty index
+  LineIndex() = default;
+
+  /// @brief destructor ~ stops the worker
+  ~LineIndex() { cancel(); }
+
+  /// @brief deleted copy constructor ~ owns its worker
+  LineIndex(const LineIndex&) = delete;
+  /// @brief deleted copy assignment operator ~ owns its worker
+  LineIndex& operator = (const LineIndex&) = delete;
+
+  /// @brief method to index a text from scratch (in the background)
+  void build(const unsigned char* data, std::size_t size);
+
+  /// @brief method to index the bytes appended to the text (in the background)
+  void extend(const unsigned char* data, std::size_t size);
+
+  /// @brief method to stop the worker (the lines indexed so far are kept)
+  void cancel();
+
+  /// @brief method to block until the whole text is indexed
+  void wait();
+
+  /// @brief method to check whether the whole text is indexed
+  bool done() const;
+
+  /// @brief   method to retrieve the number of lines indexed
+  /// @details complete lines only while scanning, the last (possibly empty) line once done
+  std::size_t lineCount() const;
+
+  /// @brief method to retrieve the offset of the first byte of a line
+  std::size_t lineStart(std::size_t line) const;
+
+  /// @brief method to retrieve the offset past the last byte of a line (line break excluded)
+  std::size_t lineEnd(std::size_t line) const;
+
+  /// @brief method to retrieve the number of bytes scanned
+  std::size_t scanned() const;
+
+  /// @brief method to retrieve the duration (in microseconds) of the last scan
+  long long elapsed() const { return mElapsed; }
+
+private:
+
+  /// @brief the worker thread
+  std::thread mWorker;
+  /// @brief flag requesting the worker to stop
+  std::atomic<bool> mCancel{ false };
+
+  /// @brief guards the fields below
+  mutable std::mutex mMutex;
+  /// @brief signalled when the scan completes
+  std::condition_variable mDone;
+
+  /// @brief offset of every line start (the first line starts at `0`)
+  std::vector<std::uint64_t> mStarts{ 0 };
+  /// @brief number of bytes scanned
+  std::size_t mScanned = 0;
+  /// @brief size of the text
+  std::size_t mSize = 0;
+  /// @brief flag indicating that `mScanned == mSize`
+  bool mFinished = true;
+  /// @brief flag indicating that the worker is scanning
+  bool mRunning = false;
+
+  /// @brief duration (in microseconds) of the last scan
+  std::atomic<long long> mElapsed{ 0 };
+
+  /// @brief helper method run by the worker
+  void scan(const unsigned char* data, std::size_t size);
+};
+
+#endif // end of LINEINDEX_H
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
@@ -0,0 +1,133 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		MappedFile.cpp
+  * @brief 		Implemenation of MappedFile utility class
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the definition/implemenation
+  *           for the `MappedFile` class' functionality
+  */
+
+/// @brief begin of MAPPEDFILE_CPP implementation
+#ifndef MAPPEDFILE_CPP
+#define MAPPEDFILE_CPP
+
+#include "./MappedFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>    // open
+#include <unistd.h>   // close
+#include <sys/mman.h> // mmap, munmap
+#include <sys/stat.h> // fstat
+#endif
+
+/// @details unmaps the file (if any) when the object goes out of scope
+MappedFile::~MappedFile() {
+  close();
+}
+
+/// @param[in] path ~ (narrow) file path of the file to map
+/// @details   Any previously mapped file is released first. <br/>
+///            Empty files cannot be mapped & are reported as failure <br/>
+///            Writers are not locked out, so that a file still being appended to
+///            (i.e. a log) can be mapped & re-mapped once grown
+/// @return    `true` if the whole file is mapped, otherwize `false`
+bool MappedFile::open(const std::string& path) {
+
+  close(); // release the previous mapping (if any)
+
+  #ifdef _WIN32
+
+  HANDLE file = CreateFileA(
+    path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL,
+    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL
+  );
+  if (file == INVALID_HANDLE_VALUE) {
+    return false;
+  }
+
+  LARGE_INTEGER fileSize;
+  if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+    CloseHandle(file);
+    return false;
+  }
+
+  HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+  if (!mapping) {
+    CloseHandle(file);
+    return false;
+  }
+
+  void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (!view) {
+    CloseHandle(mapping);
+    CloseHandle(file);
+    return false;
+  }
+
+  hFile = file;
+  hMapping = mapping;
+  mData = static_cast<const unsigned char*>(view);
+  mSize = static_cast<std::size_t>(fileSize.QuadPart);
+
+  #else
+
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size == 0) {
+    ::close(fd);
+    return false;
+  }
+
+  void* view = mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+  // the mapping holds its own reference on the file ...
+  ::close(fd);
+  if (view == MAP_FAILED) {
+    return false;
+  }
+
+  mData = static_cast<const unsigned char*>(view);
+  mSize = static_cast<std::size_t>(st.st_size);
+
+  #endif
+
+  mPath = path;
+  return true;
+}
+
+/// @details unmaps the view & closes the file/mapping handles,
+///          resetting the object to the "no file mapped" state
+void MappedFile::close() {
+
+  #ifdef _WIN32
+  if (mData) {
+    UnmapViewOfFile(mData);
+  }
+  if (hMapping) {
+    CloseHandle(static_cast<HANDLE>(hMapping));
+  }
+  if (hFile) {
+    CloseHandle(static_cast<HANDLE>(hFile));
+  }
+  hMapping = nullptr;
+  hFile = nullptr;
+  #else
+  if (mData) {
+    munmap(const_cast<unsigned char*>(mData), mSize);
+  }
+  #endif
+
+  mData = nullptr;
+  mSize = 0;
+  mPath.clear();
+}
+
+#endif // end of MAPPEDFILE_CPP
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
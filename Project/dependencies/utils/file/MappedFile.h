@@ -0,0 +1,85 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		MappedFile.h
+  * @brief 		Declaration of MappedFile utility class
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the method signatures for the `MappedFile` class,
+  *           a read-only memory-mapped view over an entire file on disk
+  */
+
+#pragma once
+
+/// @brief begin of MAPPEDFILE_H declaration
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <string>
+#include <cstddef> // std::size_t
+
+/**
+ * @class   MappedFile
+ * @brief   read-only memory mapping of a whole file
+ * @details `MappedFile` maps a file into the address space of the process,
+ *          so that the file contents can be read through a plain pointer
+ *          without copying into an intermediate buffer <br/>
+ *          The mapping is released when the object is closed or destroyed
+ * @note    Win32 file mapping is used on Windows, `mmap` elsewhere
+ */
+class MappedFile {
+
+public:
+
+  /// @brief default constructor ~ no file mapped
+  MappedFile() = default;
+
+  /// @brief destructor ~ unmaps the file (if any)
+  ~MappedFile();
+
+  /// @brief deleted copy constructor ~ the mapping is an owned resource
+  MappedFile(const MappedFile&) = delete;
+  /// @brief deleted copy assignment operator ~ the mapping is an owned resource
+  MappedFile& operator = (const MappedFile&) = delete;
+
+  /// @brief  method to map a file (read-only) into memory
+  /// @param  path ~ (narrow) file path of the file to map
+  /// @return `true` if the file was mapped, otherwize `false`
+  bool open(const std::string& path);
+
+  /// @brief method to unmap the file & release all handles
+  void close();
+
+  /// @brief method to check whether a file is currently mapped
+  bool isOpen() const { return mData != nullptr; }
+
+  /// @brief method to retrieve the first byte of the mapped view
+  const unsigned char* data() const { return mData; }
+
+  /// @brief method to retrieve the size (in bytes) of the mapped view
+  std::size_t size() const { return mSize; }
+
+  /// @brief method to retrieve the path of the mapped file
+  const std::string& path() const { return mPath; }
+
+private:
+
+  /// @brief pointer to the first byte of the mapped view
+  const unsigned char* mData = nullptr;
+
+  /// @brief size (in bytes) of the mapped view
+  std::size_t mSize = 0;
+
+  /// @brief path of the mapped file
+  std::string mPath;
+
+  #ifdef _WIN32
+  /// @brief handle of the opened file (`HANDLE`)
+  void* hFile = nullptr;
+  /// @brief handle of the file mapping object (`HANDLE`)
+  void* hMapping = nullptr;
+  #endif
+};
+
+#endif // end of MAPPEDFILE_H
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
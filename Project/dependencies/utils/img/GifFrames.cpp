@@ -0,0 +1,249 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		GifFrames.cpp
+  * @brief 		Implemenation of GifFrames utility class
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the definition/implemenation
+  *           for the `GifFrames` class' functionality
+  */
+
+/// @brief begin of GIFFRAMES_CPP implementation
+#ifndef GIFFRAMES_CPP
+#define GIFFRAMES_CPP
+
+#include "./GifFrames.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+  /// @brief helper function to read a little-endian 16-bit value
+  inline unsigned readU16(const unsigned char* p) {
+    return static_cast<unsigned>(p[0]) | (static_cast<unsigned>(p[1]) << 8);
+  }
+
+  /// @brief helper function to skip a chain of data sub-blocks
+  /// @return offset following the block terminator, or `0` if truncated
+  std::size_t skipSubBlocks(const unsigned char* data, std::size_t size, std::size_t pos) {
+    while (pos < size) {
+      const std::size_t length = data[pos++];
+      if (length == 0) {
+        return pos;
+      }
+      pos += length;
+    }
+    return 0;
+  }
+}
+
+/// @param[in]  data ~ first byte of the .gif stream
+/// @param[in]  size ~ size (in bytes) of the stream
+/// @param[out] width ~ receives the canvas (logical screen) width
+/// @param[out] height ~ receives the canvas (logical screen) height
+/// @param[out] frames ~ receives the layout of every frame, in order
+/// @return     `true` if the stream is a well-formed .gif with at least one frame
+/// @note       Only the block structure is walked, the LZW data is never decoded
+bool GifFrames::parse(
+  const unsigned char* data, std::size_t size,
+  unsigned& width, unsigned& height,
+  std::vector<Frame>& frames
+) {
+
+  frames.clear();
+
+  // header ("GIF87a"/"GIF89a") + logical screen descriptor
+  if (!data || size < 13 || std::memcmp(data, "GIF8", 4) != 0) {
+    return false;
+  }
+
+  width = readU16(data + 6);
+  height = readU16(data + 8);
+
+  std::size_t pos = 13;
+  if (data[10] & 0x80) {
+    pos += 3u << ((data[10] & 0x07) + 1); // global color table
+  }
+
+  // Graphic Control Extension data applies to the next image only
+  unsigned disposal = DISPOSAL_NONE;
+  unsigned delay = 0;
+
+  while (pos < size) {
+
+    const unsigned char block = data[pos++];
+
+    if (block == 0x3B) { // trailer
+      break;
+    }
+
+    if (block == 0x21) { // extension
+      if (pos >= size) {
+        return false;
+      }
+      const unsigned char label = data[pos++];
+      if (label == 0xF9 && pos + 5 < size && data[pos] == 4) {
+        disposal = (data[pos + 1] >> 2) & 0x07;
+        delay = readU16(data + pos + 2);
+      }
+      pos = skipSubBlocks(data, size, pos);
+      if (pos == 0) {
+        return false;
+      }
+      continue;
+    }
+
+    if (block != 0x2C) { // anything else than an image descriptor is corrupt
+      return false;
+    }
+
+    if (pos + 9 > size) {
+      return false;
+    }
+
+    Frame frame;
+    frame.rect.left = static_cast<int>(readU16(data + pos));
+    frame.rect.top = static_cast<int>(readU16(data + pos + 2));
+    frame.rect.right = frame.rect.left + static_cast<int>(readU16(data + pos + 4));
+    frame.rect.bottom = frame.rect.top + static_cast<int>(readU16(data + pos + 6));
+    frame.disposal = disposal;
+    frame.delay = delay;
+
+    const unsigned char packed = data[pos + 8];
+    pos += 9;
+    if (packed & 0x80) {
+      pos += 3u << ((packed & 0x07) + 1); // local color table
+    }
+
+    pos += 1; // LZW minimum code size
+    pos = (pos < size) ? skipSubBlocks(data, size, pos) : 0;
+    if (pos == 0) {
+      return false;
+    }
+
+    frames.push_back(frame);
+    disposal = DISPOSAL_NONE;
+    delay = 0;
+  }
+
+  return !frames.empty();
+}
+
+/// @param[in] frames ~ layout of every frame (see `parse(...)`)
+/// @param[in] index ~ index of the frame being shown
+/// @param[in] width ~ canvas width
+/// @param[in] height ~ canvas height
+/// @return    rectangle (clipped to the canvas) that MAY differ from the previous frame
+/// @note      The first frame follows the last one when the animation loops,
+///            & the canvas is reset by then, so it changes the whole canvas
+GifFrames::Rect GifFrames::changed(const std::vector<Frame>& frames, std::size_t index, unsigned width, unsigned height) {
+
+  Rect canvas;
+  canvas.right = static_cast<int>(width);
+  canvas.bottom = static_cast<int>(height);
+
+  if (index == 0 || index >= frames.size()) {
+    return canvas;
+  }
+
+  Rect rect = frames[index].rect;
+
+  // the previous frame is cleared/restored before this one is drawn
+  const Frame& previous = frames[index - 1];
+  if (previous.disposal == DISPOSAL_BACKGROUND || previous.disposal == DISPOSAL_PREVIOUS) {
+    rect = unite(rect, previous.rect);
+  }
+
+  return intersect(rect, canvas);
+}
+
+/// @param[in] a ~ pixels of the previous frame (`width` pixels per row)
+/// @param[in] b ~ pixels of the next frame (`width` pixels per row)
+/// @param[in] width ~ canvas width
+/// @param[in] within ~ rectangle to search, i.e. the result of `changed(...)`
+/// @return    bounding rectangle of the differing pixels (empty if none)
+GifFrames::Rect GifFrames::diff(const std::uint32_t* a, const std::uint32_t* b, unsigned width, const Rect& within) {
+
+  Rect rect;
+  if (within.empty()) {
+    return rect;
+  }
+
+  const std::size_t span = static_cast<std::size_t>(within.right - within.left) * sizeof(std::uint32_t);
+  auto rowDiffers = [&](int y) {
+    const std::size_t offset = static_cast<std::size_t>(y) * width + within.left;
+    return std::memcmp(a + offset, b + offset, span) != 0;
+  };
+
+  // rows first (cheap `memcmp`), then columns within the changed rows only
+  int top = within.top;
+  while (top < within.bottom && !rowDiffers(top)) {
+    top++;
+  }
+  if (top == within.bottom) {
+    return rect; // identical frames
+  }
+  int bottom = within.bottom;
+  while (bottom > top && !rowDiffers(bottom - 1)) {
+    bottom--;
+  }
+
+  int left = within.right;
+  int right = within.left;
+  for (int y = top; y < bottom; y++) {
+    const std::uint32_t* pa = a + static_cast<std::size_t>(y) * width;
+    const std::uint32_t* pb = b + static_cast<std::size_t>(y) * width;
+    for (int x = within.left; x < left; x++) {
+      if (pa[x] != pb[x]) {
+        left = x;
+        break;
+      }
+    }
+    for (int x = within.right - 1; x >= right; x--) {
+      if (pa[x] != pb[x]) {
+        right = x + 1;
+        break;
+      }
+    }
+  }
+
+  rect.left = left;
+  rect.top = top;
+  rect.right = right;
+  rect.bottom = bottom;
+  return rect;
+}
+
+/// @return smallest rectangle holding both `a` & `b` (an empty operand is ignored)
+GifFrames::Rect GifFrames::unite(const Rect& a, const Rect& b) {
+  if (a.empty()) {
+    return b;
+  }
+  if (b.empty()) {
+    return a;
+  }
+  Rect rect;
+  rect.left = std::min(a.left, b.left);
+  rect.top = std::min(a.top, b.top);
+  rect.right = std::max(a.right, b.right);
+  rect.bottom = std::max(a.bottom, b.bottom);
+  return rect;
+}
+
+/// @return overlap of `a` & `b` (empty if they do not overlap)
+GifFrames::Rect GifFrames::intersect(const Rect& a, const Rect& b) {
+  Rect rect;
+  rect.left = std::max(a.left, b.left);
+  rect.top = std::max(a.top, b.top);
+  rect.right = std::min(a.right, b.right);
+  rect.bottom = std::min(a.bottom, b.bottom);
+  if (rect.empty()) {
+    return Rect();
+  }
+  return rect;
+}
+
+#endif // end of GIFFRAMES_CPP
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
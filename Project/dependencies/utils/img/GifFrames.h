@@ -0,0 +1,94 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		GifFrames.h
+  * @brief 		Declaration of the GifFrames utility class
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the method signatures for the `GifFrames` class,
+  *           which reads the frame layout (image descriptors & disposal methods)
+  *           of a .gif stream without decoding it, & computes the area of the
+  *           canvas that changes from one animation frame to the next
+  */
+
+#pragma once
+
+/// @brief begin of GIFFRAMES_H declaration
+#ifndef GIFFRAMES_H
+#define GIFFRAMES_H
+
+#include <cstddef> // std::size_t
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class   GifFrames
+ * @brief   .gif frame layout & per-frame changed (dirty) rectangles
+ * @details A .gif frame only covers the rectangle of its image descriptor,
+ *          so moving from frame `i-1` to frame `i` changes at most that rectangle,
+ *          plus the rectangle of frame `i-1` when it is disposed (cleared/restored) <br/>
+ *          `diff(...)` then tightens such a rectangle to the pixels that really differ
+ */
+class GifFrames {
+
+public:
+
+  /// @brief disposal method of a frame (Graphic Control Extension)
+  enum Disposal {
+    /// @brief unspecified ~ treated as `DISPOSAL_KEEP`
+    DISPOSAL_NONE = 0,
+    /// @brief the frame is left in place
+    DISPOSAL_KEEP = 1,
+    /// @brief the frame's rectangle is cleared to the background
+    DISPOSAL_BACKGROUND = 2,
+    /// @brief the frame's rectangle is restored to what it was before the frame
+    DISPOSAL_PREVIOUS = 3
+  };
+
+  /// @brief rectangle (in canvas pixels), `right` & `bottom` exclusive
+  struct Rect {
+    int left = 0;
+    int top = 0;
+    int right = 0;
+    int bottom = 0;
+
+    /// @brief method to check whether the rectangle holds no pixels
+    bool empty() const { return right <= left || bottom <= top; }
+
+    /// @brief method to retrieve the number of pixels in the rectangle
+    std::size_t area() const {
+      return empty() ? 0 : static_cast<std::size_t>(right - left) * static_cast<std::size_t>(bottom - top);
+    }
+  };
+
+  /// @brief layout of a single frame
+  struct Frame {
+    Rect rect;                ///< rectangle covered by the frame's image descriptor
+    unsigned disposal = 0;    ///< `Disposal` applied once the frame is replaced
+    unsigned delay = 0;       ///< delay (in 1/100 s) before the next frame
+  };
+
+public:
+
+  /// @brief  method to read the canvas size & the layout of every frame of a .gif stream
+  static bool parse(
+    const unsigned char* data, std::size_t size,
+    unsigned& width, unsigned& height,
+    std::vector<Frame>& frames
+  );
+
+  /// @brief  method to retrieve the (conservative) rectangle changed by showing frame `index`
+  static Rect changed(const std::vector<Frame>& frames, std::size_t index, unsigned width, unsigned height);
+
+  /// @brief  method to tighten `within` to the pixels that differ between two frames
+  static Rect diff(const std::uint32_t* a, const std::uint32_t* b, unsigned width, const Rect& within);
+
+  /// @brief  method to retrieve the smallest rectangle holding both rectangles
+  static Rect unite(const Rect& a, const Rect& b);
+
+  /// @brief  method to retrieve the overlap of two rectangles
+  static Rect intersect(const Rect& a, const Rect& b);
+};
+
+#endif // end of GIFFRAMES_H
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
@@ -0,0 +1,531 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		Resampler.cpp
+  * @brief 		Implemenation of Resampler utility class
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the definition/implemenation
+  *           for the `Resampler` class' functionality
+  */
+
+/// @brief begin of RESAMPLER_CPP implementation
+#ifndef RESAMPLER_CPP
+#define RESAMPLER_CPP
+
+#include "./Resampler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+/// @brief SSE2 is available (always the case on x86-64)
+#define RESAMPLER_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(RESAMPLER_SSE2) && defined(__AVX2__)
+/// @brief AVX2 is available (i.e. built with `-mavx2`)
+#define RESAMPLER_AVX2
+#include <immintrin.h>
+#endif
+
+namespace {
+
+  /// @brief pi, for the sinc based kernels
+  const double PI = 3.14159265358979323846;
+
+  /// @brief normalized sinc function
+  double sinc(double x) {
+    if (x == 0.0) {
+      return 1.0;
+    }
+    x *= PI;
+    return std::sin(x) / x;
+  }
+
+  /// @brief precomputed (fixed-point) filter taps of one pass
+  struct Taps {
+    /// @brief maximum number of taps of an output pixel (row length of `weights`)
+    int maxTaps = 0;
+    /// @brief index of the first input pixel of every output pixel
+    std::vector<int> start;
+    /// @brief number of taps of every output pixel
+    std::vector<int> count;
+    /// @brief `maxTaps` coefficients per output pixel
+    std::vector<std::int16_t> weights;
+  };
+
+  /// @brief helper function to compute the taps mapping `inSize` pixels onto `outSize` pixels,
+  ///        for output pixels [`outFirst`, `outLast`) only (stored from index `0`)
+  Taps computeTaps(int inSize, int outSize, Resampler::Filter filter, int outFirst, int outLast) {
+
+    const double scale = static_cast<double>(inSize) / outSize;
+    // when downscaling, the kernel is stretched to cover every input pixel
+    const double filterScale = std::max(scale, 1.0);
+    const double support = Resampler::support(filter) * filterScale;
+    const int one = 1 << Resampler::PRECISION_BITS;
+
+    Taps taps;
+    taps.maxTaps = static_cast<int>(std::ceil(support)) * 2 + 1;
+    taps.start.resize(outLast - outFirst);
+    taps.count.resize(outLast - outFirst);
+    taps.weights.assign(static_cast<std::size_t>(outLast - outFirst) * taps.maxTaps, 0);
+
+    std::vector<double> w(taps.maxTaps);
+
+    for (int i = 0; i < outLast - outFirst; i++) {
+
+      const double center = (outFirst + i + 0.5) * scale;
+      int first = std::max(static_cast<int>(center - support + 0.5), 0);
+      int last = std::min(static_cast<int>(center + support + 0.5), inSize);
+      if (last - first > taps.maxTaps) {
+        last = first + taps.maxTaps;
+      }
+
+      double sum = 0.0;
+      for (int k = 0; k < last - first; k++) {
+        w[k] = Resampler::kernel(filter, (first + k - center + 0.5) / filterScale);
+        sum += w[k];
+      }
+
+      std::int16_t* weights = &taps.weights[static_cast<std::size_t>(i) * taps.maxTaps];
+
+      if (last <= first || sum == 0.0) {
+        // degenerate ~ fall back to the nearest input pixel
+        first = std::min(static_cast<int>(center), inSize - 1);
+        last = first + 1;
+        weights[0] = static_cast<std::int16_t>(one);
+      }
+      else {
+        // quantize, then hand the rounding residue to the largest tap,
+        // so that every output pixel keeps exactly unit gain
+        int total = 0;
+        int largest = 0;
+        for (int k = 0; k < last - first; k++) {
+          weights[k] = static_cast<std::int16_t>(std::lround(w[k] / sum * one));
+          total += weights[k];
+          if (weights[k] > weights[largest]) {
+            largest = k;
+          }
+        }
+        weights[largest] = static_cast<std::int16_t>(weights[largest] + one - total);
+      }
+
+      taps.start[i] = first;
+      taps.count[i] = last - first;
+    }
+
+    return taps;
+  }
+
+  /// @brief helper function to retrieve the first byte of row `y`
+  inline unsigned char* rowOf(const Resampler::Surface& s, int y) {
+    return s.data + static_cast<std::ptrdiff_t>(y) * s.stride;
+  }
+
+  /// @brief helper function to clamp the (premultiplied) colors of a pixel to its alpha
+  inline std::uint32_t clampToAlpha(std::uint32_t px) {
+    const std::uint32_t a = px >> 24;
+    std::uint32_t c0 = std::min(px & 0xFF, a);
+    std::uint32_t c1 = std::min((px >> 8) & 0xFF, a);
+    std::uint32_t c2 = std::min((px >> 16) & 0xFF, a);
+    return c0 | (c1 << 8) | (c2 << 16) | (a << 24);
+  }
+
+  /// @brief helper function to convert a 32-bit fixed-point accumulator into a byte
+  inline std::uint32_t toByte(int acc) {
+    acc >>= Resampler::PRECISION_BITS;
+    return static_cast<std::uint32_t>(acc < 0 ? 0 : (acc > 255 ? 255 : acc));
+  }
+
+  #ifdef RESAMPLER_SSE2
+  /// @brief helper function to clamp the colors of 4 pixels to their alpha
+  inline __m128i clampToAlpha(__m128i px) {
+    __m128i a = _mm_srli_epi32(px, 24);
+    a = _mm_or_si128(a, _mm_slli_epi32(a, 8));
+    a = _mm_or_si128(a, _mm_slli_epi32(a, 16));
+    return _mm_min_epu8(px, a);
+  }
+
+  /// @brief helper function to broadcast a pair of coefficients for `_mm_madd_epi16`
+  inline __m128i pairOf(std::int16_t w0, std::int16_t w1) {
+    return _mm_set1_epi32(static_cast<int>(
+      static_cast<std::uint16_t>(w0) | (static_cast<std::uint32_t>(static_cast<std::uint16_t>(w1)) << 16)
+    ));
+  }
+  #endif
+
+  #ifdef RESAMPLER_AVX2
+  /// @brief helper function to clamp the colors of 8 pixels to their alpha
+  inline __m256i clampToAlpha(__m256i px) {
+    __m256i a = _mm256_srli_epi32(px, 24);
+    a = _mm256_or_si256(a, _mm256_slli_epi32(a, 8));
+    a = _mm256_or_si256(a, _mm256_slli_epi32(a, 16));
+    return _mm256_min_epu8(px, a);
+  }
+  #endif
+
+  /// @brief horizontal pass ~ scales rows [y0, y1) of `src` into the same rows of `dst`
+  void horizontalPass(const Resampler::Surface& src, const Resampler::Surface& dst, const Taps& taps, int y0, int y1) {
+
+    for (int y = y0; y < y1; y++) {
+
+      const unsigned char* in = rowOf(src, y);
+      unsigned char* out = rowOf(dst, y);
+
+      for (int x = 0; x < dst.width; x++) {
+
+        const unsigned char* p = in + taps.start[x] * 4;
+        const std::int16_t* w = &taps.weights[static_cast<std::size_t>(x) * taps.maxTaps];
+        const int n = taps.count[x];
+        std::uint32_t px;
+
+        #ifdef RESAMPLER_SSE2
+        const __m128i zero = _mm_setzero_si128();
+        __m128i acc = _mm_set1_epi32(1 << (Resampler::PRECISION_BITS - 1));
+        int k = 0;
+        for (; k + 1 < n; k += 2) {
+          // b0 g0 r0 a0 b1 g1 r1 a1 -> b0 b1 g0 g1 r0 r1 a0 a1 (16-bit)
+          __m128i pix = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p + k * 4)), zero);
+          pix = _mm_unpacklo_epi16(pix, _mm_srli_si128(pix, 8));
+          acc = _mm_add_epi32(acc, _mm_madd_epi16(pix, pairOf(w[k], w[k + 1])));
+        }
+        if (k < n) {
+          std::int32_t last;
+          std::memcpy(&last, p + k * 4, 4);
+          __m128i pix = _mm_unpacklo_epi8(_mm_cvtsi32_si128(last), zero);
+          pix = _mm_unpacklo_epi16(pix, zero);
+          acc = _mm_add_epi32(acc, _mm_madd_epi16(pix, pairOf(w[k], 0)));
+        }
+        acc = _mm_srai_epi32(acc, Resampler::PRECISION_BITS);
+        acc = _mm_packs_epi32(acc, acc);
+        acc = _mm_packus_epi16(acc, acc);
+        px = static_cast<std::uint32_t>(_mm_cvtsi128_si32(acc));
+        #else
+        int acc[4];
+        for (int c = 0; c < 4; c++) {
+          acc[c] = 1 << (Resampler::PRECISION_BITS - 1);
+        }
+        for (int k = 0; k < n; k++) {
+          for (int c = 0; c < 4; c++) {
+            acc[c] += p[k * 4 + c] * w[k];
+          }
+        }
+        px = toByte(acc[0]) | (toByte(acc[1]) << 8) | (toByte(acc[2]) << 16) | (toByte(acc[3]) << 24);
+        #endif
+
+        px = clampToAlpha(px);
+        std::memcpy(out + x * 4, &px, 4);
+      }
+    }
+  }
+
+  /// @brief vertical pass ~ scales columns of `src` into rows [y0, y1) of `dst`
+  void verticalPass(const Resampler::Surface& src, const Resampler::Surface& dst, const Taps& taps, int y0, int y1) {
+
+    const int rowBytes = dst.width * 4;
+
+    for (int y = y0; y < y1; y++) {
+
+      const int first = taps.start[y];
+      const int n = taps.count[y];
+      const std::int16_t* w = &taps.weights[static_cast<std::size_t>(y) * taps.maxTaps];
+      unsigned char* out = rowOf(dst, y);
+      int i = 0;
+
+      #ifdef RESAMPLER_AVX2
+      {
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i rounding = _mm256_set1_epi32(1 << (Resampler::PRECISION_BITS - 1));
+        for (; i + 32 <= rowBytes; i += 32) {
+          __m256i acc0 = rounding, acc1 = rounding, acc2 = rounding, acc3 = rounding;
+          for (int k = 0; k < n; k += 2) {
+            const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rowOf(src, first + k) + i));
+            const __m256i b = (k + 1 < n)
+              ? _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rowOf(src, first + k + 1) + i))
+              : zero;
+            const __m256i c = _mm256_set1_epi32(static_cast<int>(
+              static_cast<std::uint16_t>(w[k]) |
+              (static_cast<std::uint32_t>(static_cast<std::uint16_t>(k + 1 < n ? w[k + 1] : 0)) << 16)
+            ));
+            const __m256i alo = _mm256_unpacklo_epi8(a, zero), blo = _mm256_unpacklo_epi8(b, zero);
+            const __m256i ahi = _mm256_unpackhi_epi8(a, zero), bhi = _mm256_unpackhi_epi8(b, zero);
+            acc0 = _mm256_add_epi32(acc0, _mm256_madd_epi16(_mm256_unpacklo_epi16(alo, blo), c));
+            acc1 = _mm256_add_epi32(acc1, _mm256_madd_epi16(_mm256_unpackhi_epi16(alo, blo), c));
+            acc2 = _mm256_add_epi32(acc2, _mm256_madd_epi16(_mm256_unpacklo_epi16(ahi, bhi), c));
+            acc3 = _mm256_add_epi32(acc3, _mm256_madd_epi16(_mm256_unpackhi_epi16(ahi, bhi), c));
+          }
+          // the unpack/pack pairs stay within 128-bit lanes, so the pixel order is preserved
+          const __m256i lo = _mm256_packs_epi32(
+            _mm256_srai_epi32(acc0, Resampler::PRECISION_BITS), _mm256_srai_epi32(acc1, Resampler::PRECISION_BITS));
+          const __m256i hi = _mm256_packs_epi32(
+            _mm256_srai_epi32(acc2, Resampler::PRECISION_BITS), _mm256_srai_epi32(acc3, Resampler::PRECISION_BITS));
+          _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), clampToAlpha(_mm256_packus_epi16(lo, hi)));
+        }
+      }
+      #endif
+
+      #ifdef RESAMPLER_SSE2
+      {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i rounding = _mm_set1_epi32(1 << (Resampler::PRECISION_BITS - 1));
+        for (; i + 16 <= rowBytes; i += 16) {
+          __m128i acc0 = rounding, acc1 = rounding, acc2 = rounding, acc3 = rounding;
+          for (int k = 0; k < n; k += 2) {
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rowOf(src, first + k) + i));
+            const __m128i b = (k + 1 < n)
+              ? _mm_loadu_si128(reinterpret_cast<const __m128i*>(rowOf(src, first + k + 1) + i))
+              : zero;
+            const __m128i c = pairOf(w[k], k + 1 < n ? w[k + 1] : 0);
+            const __m128i alo = _mm_unpacklo_epi8(a, zero), blo = _mm_unpacklo_epi8(b, zero);
+            const __m128i ahi = _mm_unpackhi_epi8(a, zero), bhi = _mm_unpackhi_epi8(b, zero);
+            // interleave rows, so that each 32-bit lane holds one channel of two rows
+            acc0 = _mm_add_epi32(acc0, _mm_madd_epi16(_mm_unpacklo_epi16(alo, blo), c));
+            acc1 = _mm_add_epi32(acc1, _mm_madd_epi16(_mm_unpackhi_epi16(alo, blo), c));
+            acc2 = _mm_add_epi32(acc2, _mm_madd_epi16(_mm_unpacklo_epi16(ahi, bhi), c));
+            acc3 = _mm_add_epi32(acc3, _mm_madd_epi16(_mm_unpackhi_epi16(ahi, bhi), c));
+          }
+          const __m128i lo = _mm_packs_epi32(
+            _mm_srai_epi32(acc0, Resampler::PRECISION_BITS), _mm_srai_epi32(acc1, Resampler::PRECISION_BITS));
+          const __m128i hi = _mm_packs_epi32(
+            _mm_srai_epi32(acc2, Resampler::PRECISION_BITS), _mm_srai_epi32(acc3, Resampler::PRECISION_BITS));
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), clampToAlpha(_mm_packus_epi16(lo, hi)));
+        }
+      }
+      #endif
+
+      // remaining pixels (or all of them, without SSE2)
+      for (; i < rowBytes; i += 4) {
+        int acc[4];
+        for (int c = 0; c < 4; c++) {
+          acc[c] = 1 << (Resampler::PRECISION_BITS - 1);
+        }
+        for (int k = 0; k < n; k++) {
+          const unsigned char* p = rowOf(src, first + k) + i;
+          for (int c = 0; c < 4; c++) {
+            acc[c] += p[c] * w[k];
+          }
+        }
+        std::uint32_t px = toByte(acc[0]) | (toByte(acc[1]) << 8) | (toByte(acc[2]) << 16) | (toByte(acc[3]) << 24);
+        px = clampToAlpha(px);
+        std::memcpy(out + i, &px, 4);
+      }
+    }
+  }
+
+  /// @brief helper function to split `rows` rows into chunks, processed by up to `threads` threads
+  void parallelRows(int rows, std::size_t work, unsigned threads, const std::function<void(int, int)>& job) {
+
+    if (threads == 0) {
+      threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    threads = std::min(threads, static_cast<unsigned>(std::max(rows, 1)));
+
+    if (threads <= 1 || work < Resampler::PARALLEL_THRESHOLD) {
+      job(0, rows);
+      return;
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    const int chunk = (rows + static_cast<int>(threads) - 1) / static_cast<int>(threads);
+    for (int y = chunk; y < rows; y += chunk) {
+      workers.emplace_back(job, y, std::min(y + chunk, rows));
+    }
+    // the calling thread takes the first chunk
+    job(0, std::min(chunk, rows));
+    for (std::thread& worker : workers) {
+      worker.join();
+    }
+  }
+}
+
+/// @param[in] filter ~ reconstruction filter
+/// @return    radius of the kernel (in pixels), i.e. `kernel(...)` is `0` beyond it
+double Resampler::support(Filter filter) {
+  switch (filter) {
+    case BOX:      return 0.5;
+    case BILINEAR: return 1.0;
+    case BICUBIC:  return 2.0;
+    case LANCZOS3: return 3.0;
+  }
+  return 1.0;
+}
+
+/// @param[in] filter ~ reconstruction filter
+/// @param[in] x ~ distance (in pixels) from the sample center
+/// @return    (un-normalized) weight of the sample
+double Resampler::kernel(Filter filter, double x) {
+
+  x = std::fabs(x);
+
+  switch (filter) {
+    case BOX:
+      return x < 0.5 ? 1.0 : 0.0;
+    case BILINEAR:
+      return x < 1.0 ? 1.0 - x : 0.0;
+    case BICUBIC: {
+      const double a = -0.5;
+      if (x < 1.0) {
+        return ((a + 2.0) * x - (a + 3.0)) * x * x + 1.0;
+      }
+      if (x < 2.0) {
+        return (((x - 5.0) * x + 8.0) * x - 4.0) * a;
+      }
+      return 0.0;
+    }
+    case LANCZOS3:
+      return x < 3.0 ? sinc(x) * sinc(x / 3.0) : 0.0;
+  }
+  return 0.0;
+}
+
+/// @details   The horizontal pass runs first (into an intermediate image holding only
+///            the source rows that the vertical pass reads), then the vertical pass.
+///            A pass is skipped when its dimension is unchanged. <br/>
+///            Each pass splits its rows across threads once the destination
+///            holds at least `PARALLEL_THRESHOLD` pixels
+bool Resampler::resize(const Surface& src, const Surface& dst, Filter filter, unsigned threads) {
+  return resizeRegion(src, dst.width, dst.height, dst, 0, 0, filter, threads);
+}
+
+/// @details   Only the taps of the region's columns & rows are computed, & only the
+///            source rows read by them are scaled horizontally
+bool Resampler::resizeRegion(
+  const Surface& src, int width, int height,
+  const Surface& dst, int left, int top,
+  Filter filter, unsigned threads
+) {
+
+  if (!src.data || !dst.data || src.width <= 0 || src.height <= 0 || dst.width <= 0 || dst.height <= 0) {
+    return false;
+  }
+  if (left < 0 || top < 0 || dst.width > width - left || dst.height > height - top) {
+    return false;
+  }
+
+  const std::size_t work = static_cast<std::size_t>(dst.width) * dst.height;
+
+  // same size ~ plain copy
+  if (src.width == width && src.height == height) {
+    for (int y = 0; y < dst.height; y++) {
+      std::memcpy(rowOf(dst, y), rowOf(src, top + y) + left * 4, static_cast<std::size_t>(dst.width) * 4);
+    }
+    return true;
+  }
+
+  // horizontal only
+  if (src.height == height) {
+    Taps taps = computeTaps(src.width, width, filter, left, left + dst.width);
+    Surface rows = { rowOf(src, top), src.width, dst.height, src.stride };
+    parallelRows(dst.height, work, threads, [&](int y0, int y1) {
+      horizontalPass(rows, dst, taps, y0, y1);
+    });
+    return true;
+  }
+
+  Taps vertical = computeTaps(src.height, height, filter, top, top + dst.height);
+
+  // vertical only
+  if (src.width == width) {
+    Surface columns = { src.data + static_cast<std::ptrdiff_t>(left) * 4, dst.width, src.height, src.stride };
+    parallelRows(dst.height, work, threads, [&](int y0, int y1) {
+      verticalPass(columns, dst, vertical, y0, y1);
+    });
+    return true;
+  }
+
+  // both ~ only the source rows read by the vertical pass are scaled horizontally
+  const int rowFirst = vertical.start.front();
+  const int rowLast = vertical.start.back() + vertical.count.back();
+  for (int& start : vertical.start) {
+    start -= rowFirst;
+  }
+
+  std::vector<unsigned char> buffer(static_cast<std::size_t>(dst.width) * (rowLast - rowFirst) * 4);
+  Surface middle = { buffer.data(), dst.width, rowLast - rowFirst, dst.width * 4 };
+  Surface window = { rowOf(src, rowFirst), src.width, rowLast - rowFirst, src.stride };
+
+  Taps horizontal = computeTaps(src.width, width, filter, left, left + dst.width);
+  parallelRows(middle.height, static_cast<std::size_t>(middle.width) * middle.height, threads, [&](int y0, int y1) {
+    horizontalPass(window, middle, horizontal, y0, y1);
+  });
+  parallelRows(dst.height, work, threads, [&](int y0, int y1) {
+    verticalPass(middle, dst, vertical, y0, y1);
+  });
+
+  return true;
+}
+
+/// @details   An output pixel reads the input pixels its taps start from (the taps are
+///            ordered), so the output pixels found form a single range
+void Resampler::reach(int inSize, int outSize, Filter filter, int first, int last, int& outFirst, int& outLast) {
+
+  outFirst = 0;
+  outLast = 0;
+  first = std::max(first, 0);
+  last = std::min(last, inSize);
+  if (outSize <= 0 || first >= last) {
+    return;
+  }
+
+  // same size ~ copied pixel for pixel
+  if (inSize == outSize) {
+    outFirst = first;
+    outLast = last;
+    return;
+  }
+
+  const Taps taps = computeTaps(inSize, outSize, filter, 0, outSize);
+  outFirst = outSize;
+  for (int i = 0; i < outSize; i++) {
+    if (taps.start[i] < last && taps.start[i] + taps.count[i] > first) {
+      outFirst = std::min(outFirst, i);
+      outLast = i + 1;
+    }
+  }
+  if (outFirst >= outLast) {
+    outFirst = outLast;
+  }
+}
+
+/// @param[in] image ~ straight alpha pixels, converted in place
+void Resampler::premultiply(const Surface& image) {
+  for (int y = 0; y < image.height; y++) {
+    unsigned char* p = rowOf(image, y);
+    for (int x = 0; x < image.width; x++, p += 4) {
+      const unsigned a = p[3];
+      if (a == 255) {
+        continue;
+      }
+      for (int c = 0; c < 3; c++) {
+        p[c] = static_cast<unsigned char>((p[c] * a + 127) / 255);
+      }
+    }
+  }
+}
+
+/// @param[in] image ~ premultiplied alpha pixels, converted in place
+void Resampler::unpremultiply(const Surface& image) {
+  for (int y = 0; y < image.height; y++) {
+    unsigned char* p = rowOf(image, y);
+    for (int x = 0; x < image.width; x++, p += 4) {
+      const unsigned a = p[3];
+      if (a == 255) {
+        continue;
+      }
+      for (int c = 0; c < 3; c++) {
+        p[c] = static_cast<unsigned char>(a ? std::min(255u, (p[c] * 255u + a / 2) / a) : 0u);
+      }
+    }
+  }
+}
+
+#endif // end of RESAMPLER_CPP
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
@@ -0,0 +1,116 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		Resampler.h
+  * @brief 		Declaration of the Resampler utility class
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the method signatures for the `Resampler` class,
+  *           a separable (two-pass) image scaler for 32-bit, 4-channel pixels
+  *
+  *           Both passes use precomputed, 14-bit fixed-point filter coefficients,
+  *           are vectorized with SSE2 (& AVX2 for the vertical pass when built with `-mavx2`)
+  *           & split the rows of large images across threads
+  */
+
+#pragma once
+
+/// @brief begin of RESAMPLER_H declaration
+#ifndef RESAMPLER_H
+#define RESAMPLER_H
+
+#include <cstddef> // std::size_t
+
+/**
+ * @class   Resampler
+ * @brief   scales 32-bit, 4-channel (i.e. BGRA) images
+ * @details The channel order is irrelevant to the resampler, but alpha
+ *          MUST be the 4th byte of every pixel & colors SHOULD be premultiplied
+ *          by alpha (i.e. GDI+ `PixelFormat32bppPARGB`), otherwize transparent
+ *          pixels bleed their color into their neighbours <br/>
+ *          Output colors are clamped to their alpha, so that the ringing of the
+ *          bicubic & Lanczos kernels never produces invalid premultiplied pixels
+ */
+class Resampler {
+
+public:
+
+  /// @brief reconstruction filter (kernel) used by `resize(...)`
+  enum Filter {
+    /// @brief box filter ~ nearest neighbour when upscaling, area average when downscaling
+    BOX,
+    /// @brief triangle filter ~ bilinear interpolation
+    BILINEAR,
+    /// @brief Catmull-Rom cubic filter (a = -0.5) ~ bicubic interpolation
+    BICUBIC,
+    /// @brief windowed sinc filter with 3 lobes ~ sharpest, most expensive
+    LANCZOS3
+  };
+
+  /// @brief (non-owning) view of 32-bit pixels
+  struct Surface {
+    unsigned char* data; ///< first byte of the first (top) row
+    int width;           ///< width (in pixels)
+    int height;          ///< height (in pixels)
+    int stride;          ///< distance (in bytes) between two rows ~ MAY be negative (bottom-up)
+  };
+
+  /// @brief   method to scale `src` into `dst` (both sizes are taken from the surfaces)
+  /// @param   src ~ source pixels (read only)
+  /// @param   dst ~ destination pixels, MUST NOT overlap `src`
+  /// @param   filter ~ reconstruction filter
+  /// @param   threads ~ maximum number of threads, `0` for `std::thread::hardware_concurrency()`
+  /// @return  `false` if either surface is empty/invalid, otherwize `true`
+  static bool resize(const Surface& src, const Surface& dst, Filter filter = BICUBIC, unsigned threads = 0);
+
+  /// @brief   method to scale `src` to `width` x `height`, writing only the region held by `dst`
+  /// @param   src ~ source pixels (read only)
+  /// @param   width ~ width (in pixels) of the whole scaled image
+  /// @param   height ~ height (in pixels) of the whole scaled image
+  /// @param   dst ~ destination pixels of the region, MUST NOT overlap `src`
+  /// @param   left ~ column of the scaled image held by the first column of `dst`
+  /// @param   top ~ row of the scaled image held by the first row of `dst`
+  /// @param   filter ~ reconstruction filter
+  /// @param   threads ~ maximum number of threads, `0` for `std::thread::hardware_concurrency()`
+  /// @return  `false` if either surface is empty/invalid or the region exceeds the scaled image
+  /// @details The pixels are identical to those `resize(...)` writes at the same place, so
+  ///          that a region of an image scaled before (i.e. a changed .gif frame) is refreshed
+  ///          in place, at the cost of the region only
+  static bool resizeRegion(
+    const Surface& src, int width, int height,
+    const Surface& dst, int left, int top,
+    Filter filter = BICUBIC, unsigned threads = 0
+  );
+
+  /// @brief   method to retrieve the output pixels (of one dimension) read from input pixels
+  /// @param   inSize ~ size (in pixels) of the dimension before scaling
+  /// @param   outSize ~ size (in pixels) of the dimension after scaling
+  /// @param   filter ~ reconstruction filter
+  /// @param   first ~ first input pixel
+  /// @param   last ~ input pixel following the last one (exclusive)
+  /// @param   outFirst ~ [out] first output pixel reading any of the input pixels
+  /// @param   outLast ~ [out] output pixel following the last one (`outFirst` if none)
+  /// @details i.e. the region to `resizeRegion(...)` once input pixels changed
+  static void reach(int inSize, int outSize, Filter filter, int first, int last, int& outFirst, int& outLast);
+
+  /// @brief method to premultiply colors by alpha (straight -> premultiplied), in place
+  static void premultiply(const Surface& image);
+
+  /// @brief method to divide colors by alpha (premultiplied -> straight), in place
+  static void unpremultiply(const Surface& image);
+
+  /// @brief method to retrieve the support (radius, in source pixels at 1:1 scale) of a filter
+  static double support(Filter filter);
+
+  /// @brief method to evaluate a filter kernel at `x`
+  static double kernel(Filter filter, double x);
+
+  /// @brief number of destination pixels below which `resize(...)` stays single-threaded
+  static const std::size_t PARALLEL_THRESHOLD = 256 * 256;
+
+  /// @brief number of fractional bits of the fixed-point filter coefficients
+  static const int PRECISION_BITS = 14;
+};
+
+#endif // end of RESAMPLER_H
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
@@ -0,0 +1,281 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		ColumnStore.cpp
+  * @brief 		Implemenation of ColumnStore utility class
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the definition/implemenation
+  *           for the `ColumnStore` class' functionality
+  */
+
+/// @brief begin of COLUMNSTORE_CPP implementation
+#ifndef COLUMNSTORE_CPP
+#define COLUMNSTORE_CPP
+
+#include "./ColumnStore.h"
+
+#include "../str/StrTable.h" // StrTable::compareNoCase
+
+#include <algorithm> // std::sort, std::inplace_merge
+#include <cmath>     // std::isnan
+#include <cstdlib>   // std::strtod
+#include <cstring>   // std::memcpy
+#include <functional>
+#include <limits>
+#include <thread>
+
+namespace {
+
+  /// @brief minimum number of rows per sorting thread
+  const std::size_t SORT_CHUNK_MIN = 1 << 16;
+
+  /// @brief helper function to parse a cell, NaN if not a number
+  double parseNumber(const std::string& text) {
+    const char* begin = text.c_str();
+    char* end = nullptr;
+    const double value = std::strtod(begin, &end);
+    if (end == begin) {
+      return std::numeric_limits<double>::quiet_NaN();
+    }
+    while (*end == ' ' || *end == '\t') {
+      end++;
+    }
+    return (*end == '\0') ? value : std::numeric_limits<double>::quiet_NaN();
+  }
+}
+
+/// @param[in] name ~ name of the column
+/// @param[in] type ~ type of the column
+/// @return    the index of the column
+std::size_t ColumnStore::addColumn(const std::string& name, Type type) {
+
+  mColumns.push_back(Column());
+  Column& column = mColumns.back();
+  column.name = name;
+  column.type = type;
+
+  const std::string empty;
+  column.cells.reserve(mRows);
+  for (std::size_t row = 0; row < mRows; row++) {
+    appendCell(column, empty);
+  }
+  return mColumns.size() - 1;
+}
+
+/// @param[in] name ~ name of the column
+/// @return    the index of the column, `npos` if none
+std::size_t ColumnStore::findColumn(const std::string& name) const {
+  for (std::size_t col = 0; col < mColumns.size(); col++) {
+    if (mColumns[col].name == name) {
+      return col;
+    }
+  }
+  return npos;
+}
+
+/// @param[in] rows ~ number of rows (in total)
+/// @param[in] chars ~ average number of characters per cell
+void ColumnStore::reserve(std::size_t rows, std::size_t chars) {
+  const std::size_t more = (rows > mRows) ? rows - mRows : 0;
+  for (Column& column : mColumns) {
+    column.cells.reserve(more, more * chars);
+    if (column.type == NUMBER) {
+      column.numbers.reserve(rows);
+    }
+  }
+}
+
+/// @param[in] cells ~ the cells of the row, by column
+void ColumnStore::appendRow(const std::vector<std::string>& cells) {
+
+  const std::string empty;
+  for (std::size_t col = 0; col < mColumns.size(); col++) {
+    appendCell(mColumns[col], col < cells.size() ? cells[col] : empty);
+  }
+  mRows++;
+}
+
+void ColumnStore::clearRows() {
+  for (Column& column : mColumns) {
+    column.cells.clear();
+    column.numbers.clear();
+  }
+  mRows = 0;
+}
+
+/// @param[in] col ~ the column
+/// @param[in] a ~ a row
+/// @param[in] b ~ a row
+/// @return    <0 if `a` goes before `b`, >0 if after, 0 if the cells are equal
+int ColumnStore::compare(std::size_t col, row_type a, row_type b) const {
+
+  const Column& column = mColumns[col];
+
+  if (column.type == NUMBER) {
+    const double x = column.numbers[a];
+    const double y = column.numbers[b];
+    const bool nx = std::isnan(x);
+    const bool ny = std::isnan(y);
+    if (!nx && !ny) {
+      return (x < y) ? -1 : (y < x) ? 1 : 0;
+    }
+    if (nx != ny) {
+      return nx ? 1 : -1;
+    }
+    // neither is a number ~ compared as text
+  }
+
+  return StrTable::compareNoCase(
+    column.cells.c_str(a), column.cells.length(a),
+    column.cells.c_str(b), column.cells.length(b)
+  );
+}
+
+/// @param[in]     col ~ the column
+/// @param[in]     ascending ~ whether the rows go in ascending or descending order
+/// @param[in,out] order ~ the permutation to sort (filled with every row if not of `rows()` rows)
+/// @param[in]     threads ~ number of threads (0 for the number of cores)
+/// @details       every row is paired with a 64-bit key (the first 8 folded characters, or the
+///                ordered bits of the number), so that most comparisons read the pairs only,
+///                i.e. sequential memory, the cells being compared on equal keys only
+void ColumnStore::sort(std::size_t col, bool ascending, std::vector<row_type>& order, std::size_t threads) const {
+
+  if (order.size() != mRows) {
+    identity(order, mRows);
+  }
+  if (col >= mColumns.size() || order.size() < 2) {
+    return;
+  }
+
+  if (threads == 0) {
+    threads = std::thread::hardware_concurrency();
+  }
+  const std::size_t most = order.size() / SORT_CHUNK_MIN;
+  if (threads > most) {
+    threads = most;
+  }
+  if (threads == 0) {
+    threads = 1;
+  }
+
+  std::vector<std::size_t> bounds(threads + 1);
+  for (std::size_t i = 0; i <= threads; i++) {
+    bounds[i] = order.size() * i / threads;
+  }
+
+  // runs `task(first, last)` on every chunk, a thread per chunk ...
+  auto parallel = [&bounds, threads](const std::function<void(std::size_t, std::size_t)>& task) {
+    if (threads == 1) {
+      task(bounds[0], bounds[1]);
+      return;
+    }
+    std::vector<std::thread> workers;
+    for (std::size_t i = 0; i < threads; i++) {
+      workers.emplace_back(task, bounds[i], bounds[i + 1]);
+    }
+    for (std::thread& worker : workers) {
+      worker.join();
+    }
+  };
+
+  // pair the rows with their keys ...
+  std::vector<Keyed> keyed(order.size());
+  parallel([&](std::size_t first, std::size_t last) {
+    for (std::size_t i = first; i < last; i++) {
+      keyed[i].key = sortKey(col, order[i], ascending);
+      keyed[i].row = order[i];
+    }
+  });
+
+  auto before = [this, col, ascending](const Keyed& a, const Keyed& b) {
+    if (a.key != b.key) {
+      return a.key < b.key;
+    }
+    const int c = compare(col, a.row, b.row);
+    if (c == 0) {
+      return a.row < b.row;
+    }
+    return ascending ? (c < 0) : (c > 0);
+  };
+
+  // sort the chunks ...
+  parallel([&](std::size_t first, std::size_t last) {
+    std::sort(keyed.begin() + first, keyed.begin() + last, before);
+  });
+
+  // ... then merge them pairwise, the pairs of a round in parallel
+  for (std::size_t width = 1; width < threads; width *= 2) {
+    std::vector<std::thread> workers;
+    for (std::size_t i = 0; i + width < threads; i += 2 * width) {
+      const std::size_t first = bounds[i];
+      const std::size_t middle = bounds[i + width];
+      const std::size_t last = bounds[std::min(i + 2 * width, threads)];
+      workers.emplace_back([&keyed, &before, first, middle, last]() {
+        std::inplace_merge(keyed.begin() + first, keyed.begin() + middle, keyed.begin() + last, before);
+      });
+    }
+    for (std::thread& worker : workers) {
+      worker.join();
+    }
+  }
+
+  parallel([&](std::size_t first, std::size_t last) {
+    for (std::size_t i = first; i < last; i++) {
+      order[i] = keyed[i].row;
+    }
+  });
+}
+
+/// @param[out] order ~ the permutation
+/// @param[in]  rows ~ number of rows
+void ColumnStore::identity(std::vector<row_type>& order, std::size_t rows) {
+  order.resize(rows);
+  for (std::size_t row = 0; row < rows; row++) {
+    order[row] = static_cast<row_type>(row);
+  }
+}
+
+/// @param[in] col ~ the column
+/// @param[in] row ~ the row
+/// @param[in] ascending ~ whether the rows go in ascending or descending order
+/// @return    the key of the cell, ordered as the cells wherever the keys differ
+std::uint64_t ColumnStore::sortKey(std::size_t col, row_type row, bool ascending) const {
+
+  const Column& column = mColumns[col];
+  std::uint64_t key = 0;
+
+  if (column.type == NUMBER && !std::isnan(column.numbers[row])) {
+    double value = column.numbers[row];
+    if (value == 0) {
+      value = 0; // -0 == +0
+    }
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    // order the bits as the values ...
+    key = (bits & 0x8000000000000000ULL) ? ~bits : (bits | 0x8000000000000000ULL);
+  } else if (column.type == NUMBER) {
+    // not a number ~ last, either way
+    return ~0ULL;
+  } else {
+    const char* text = column.cells.c_str(row);
+    const std::size_t length = std::min<std::size_t>(column.cells.length(row), 8);
+    for (std::size_t i = 0; i < 8; i++) {
+      const unsigned char c = (i < length) ? static_cast<unsigned char>(text[i]) : 0;
+      key = (key << 8) | ((c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c);
+    }
+  }
+  return ascending ? key : ~key;
+}
+
+/// @param[in] column ~ the column
+/// @param[in] text ~ the text of the cell
+void ColumnStore::appendCell(Column& column, const std::string& text) {
+  column.cells.push_back(text);
+  if (column.type == NUMBER) {
+    column.numbers.push_back(parseNumber(text));
+  }
+}
+
+#endif // end of COLUMNSTORE_CPP
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
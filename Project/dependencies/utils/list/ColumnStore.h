@@ -0,0 +1,130 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		ColumnStore.h
+  * @brief 		Declaration of ColumnStore utility class
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the method signatures for the `ColumnStore` class,
+  *           the cells of a table stored column by column, sortable by column
+  */
+
+#pragma once
+
+/// @brief begin of COLUMNSTORE_H declaration
+#ifndef COLUMNSTORE_H
+#define COLUMNSTORE_H
+
+#include <cstddef> // std::size_t
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../str/StrArena.h"
+
+/**
+ * @class   ColumnStore
+ * @brief   table cells stored by column
+ * @details Every column keeps the text of its cells in a `StrArena` (one buffer for the
+ *          column), `NUMBER` columns also keeping the parsed value of every cell, so that
+ *          comparing two rows reads two cells of one column only. <br/>
+ *          Rows are never moved: sorting orders a permutation of the rows (32-bit row
+ *          numbers), keyed by the first characters/value of the cells & sorted in chunks
+ *          on several threads then merged pairwise
+ */
+class ColumnStore {
+
+public:
+
+  /// @brief the type of a column, i.e. how its cells compare
+  enum Type {
+    TEXT,   ///< case-insensitive (ASCII) text
+    NUMBER  ///< numeric value (cells not parsed as numbers go last)
+  };
+
+  /// @brief a row number, in permutations of the rows
+  typedef std::uint32_t row_type;
+
+  /// @brief value returned when no column is found
+  static const std::size_t npos = static_cast<std::size_t>(-1);
+
+public:
+
+  /// @brief default constructor ~ no column
+  ColumnStore() = default;
+
+  /// @brief method to add a column (empty cells for the rows already stored), returning its index
+  std::size_t addColumn(const std::string& name, Type type = TEXT);
+
+  /// @brief method to retrieve the number of columns
+  std::size_t columns() const { return mColumns.size(); }
+
+  /// @brief method to retrieve the number of rows
+  std::size_t rows() const { return mRows; }
+
+  /// @brief method to retrieve the name of a column
+  const std::string& name(std::size_t col) const { return mColumns[col].name; }
+
+  /// @brief method to retrieve the type of a column
+  Type type(std::size_t col) const { return mColumns[col].type; }
+
+  /// @brief method to retrieve the index of a column by name, `npos` if none
+  std::size_t findColumn(const std::string& name) const;
+
+  /// @brief method to reserve the storage of `rows` rows of `chars` characters per cell (average)
+  void reserve(std::size_t rows, std::size_t chars = 8);
+
+  /// @brief method to append a row (missing cells are empty, extra cells ignored)
+  void appendRow(const std::vector<std::string>& cells);
+
+  /// @brief method to discard every row (the columns are kept)
+  void clearRows();
+
+  /// @brief method to retrieve the (NUL-terminated) text of a cell
+  const char* text(std::size_t row, std::size_t col) const { return mColumns[col].cells.c_str(row); }
+
+  /// @brief method to retrieve the length of the text of a cell
+  std::size_t length(std::size_t row, std::size_t col) const { return mColumns[col].cells.length(row); }
+
+  /// @brief method to retrieve the numeric value of a cell (`NUMBER` columns, NaN if not a number)
+  double number(std::size_t row, std::size_t col) const { return mColumns[col].numbers[row]; }
+
+  /// @brief method to compare two rows by a column (<0, 0, >0)
+  int compare(std::size_t col, row_type a, row_type b) const;
+
+  /// @brief method to sort a permutation of the rows by a column (ties in row order)
+  void sort(std::size_t col, bool ascending, std::vector<row_type>& order, std::size_t threads = 0) const;
+
+  /// @brief static method to fill a permutation with the rows in order
+  static void identity(std::vector<row_type>& order, std::size_t rows);
+
+private:
+
+  /// @brief the cells of a column
+  struct Column {
+    std::string name;              ///< name of the column
+    Type type;                     ///< type of the column
+    StrArena cells;                ///< text of the cells
+    std::vector<double> numbers;   ///< value of the cells (`NUMBER` columns only)
+  };
+
+  /// @brief the columns
+  std::vector<Column> mColumns;
+  /// @brief number of rows
+  std::size_t mRows = 0;
+
+  /// @brief a row paired with its sort key
+  struct Keyed {
+    std::uint64_t key;  ///< the sort key of the cell
+    row_type row;       ///< the row
+  };
+
+  /// @brief helper method to append a cell to a column
+  void appendCell(Column& column, const std::string& text);
+
+  /// @brief helper method to compute the sort key of a cell
+  std::uint64_t sortKey(std::size_t col, row_type row, bool ascending) const;
+};
+
+#endif // end of COLUMNSTORE_H
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
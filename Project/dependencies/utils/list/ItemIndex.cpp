@@ -0,0 +1,254 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		ItemIndex.cpp
+  * @brief 		Implemenation of BasicItemIndex utility class template
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the definition/implemenation
+  *           for the `BasicItemIndex` class template's functionality,
+  *           explicitly instantiated for `char` & `wchar_t`
+  */
+
+/// @brief begin of ITEMINDEX_CPP implementation
+#ifndef ITEMINDEX_CPP
+#define ITEMINDEX_CPP
+
+#include "./ItemIndex.h"
+
+/// @param[in] items ~ the items, in order (repeated items indexed once)
+template <typename CharT>
+void BasicItemIndex<CharT>::assign(const std::vector<string_type>& items) {
+
+  mItems.clear();
+  mItems.reserve(items.size());
+  mNodes.assign(1, Node());
+  mNodes.reserve(items.size() + 1);
+  mFree.clear();
+
+  // first appearance order, the treap built in linear time (Cartesian tree) ~
+  // the stack holding the right spine, a node final once popped ...
+  std::vector<node_type> spine;
+  for (const string_type& item : items) {
+    auto inserted = mItems.emplace(item, 0);
+    if (!inserted.second) {
+      continue;
+    }
+    const node_type node = newNode(&*inserted.first);
+    node_type last = 0;
+    while (!spine.empty() && mNodes[spine.back()].priority < mNodes[node].priority) {
+      last = spine.back();
+      spine.pop_back();
+      pull(last);
+    }
+    mNodes[node].left = last;
+    if (!spine.empty()) {
+      mNodes[spine.back()].right = node;
+    }
+    spine.push_back(node);
+  }
+  for (auto it = spine.rbegin(); it != spine.rend(); ++it) {
+    pull(*it);
+  }
+  mRoot = spine.empty() ? 0 : spine.front();
+  mNodes[mRoot].parent = 0;
+}
+
+/// @param[in] item ~ the item
+/// @return    position of the item, `npos` if not listed
+template <typename CharT>
+std::size_t BasicItemIndex<CharT>::find(const string_type& item) const {
+  auto found = mItems.find(item);
+  if (found == mItems.end()) {
+    return npos;
+  }
+  return rank(static_cast<node_type>(found->second));
+}
+
+/// @param[in] pos ~ position of the new item (`size()` to append)
+/// @param[in] item ~ the item
+/// @return    `true` if inserted, `false` if already listed
+template <typename CharT>
+bool BasicItemIndex<CharT>::insert(std::size_t pos, const string_type& item) {
+
+  if (pos > size()) {
+    pos = size();
+  }
+  auto inserted = mItems.emplace(item, 0);
+  if (!inserted.second) {
+    return false;
+  }
+  const node_type node = newNode(&*inserted.first);
+
+  // the items before & after `pos`, joined again around the new item ...
+  node_type left = 0;
+  node_type right = 0;
+  split(mRoot, pos, left, right);
+  mRoot = merge(merge(left, node), right);
+  mNodes[mRoot].parent = 0;
+  return true;
+}
+
+/// @param[in] item ~ the item
+/// @return    the position of the removed item, `npos` if not listed
+template <typename CharT>
+std::size_t BasicItemIndex<CharT>::erase(const string_type& item) {
+
+  auto found = mItems.find(item);
+  if (found == mItems.end()) {
+    return npos;
+  }
+  const node_type node = static_cast<node_type>(found->second);
+  const std::size_t pos = rank(node);
+
+  // the children take the place of the node ...
+  const node_type child = merge(mNodes[node].left, mNodes[node].right);
+  const node_type parent = mNodes[node].parent;
+  if (child) {
+    mNodes[child].parent = parent;
+  }
+  if (!parent) {
+    mRoot = child;
+  } else if (mNodes[parent].left == node) {
+    mNodes[parent].left = child;
+  } else {
+    mNodes[parent].right = child;
+  }
+
+  // ... & every ancestor counts one item less
+  for (node_type up = parent; up; up = mNodes[up].parent) {
+    mNodes[up].count--;
+  }
+
+  mNodes[node] = Node();
+  mFree.push_back(node);
+  mItems.erase(found);
+  return pos;
+}
+
+/// @param[in] entry ~ the item
+/// @return    the (detached) node of the item
+template <typename CharT>
+typename BasicItemIndex<CharT>::node_type BasicItemIndex<CharT>::newNode(Entry* entry) {
+
+  node_type node;
+  if (!mFree.empty()) {
+    node = mFree.back();
+    mFree.pop_back();
+  } else {
+    node = static_cast<node_type>(mNodes.size());
+    mNodes.push_back(Node());
+  }
+
+  mSeed ^= mSeed << 13;
+  mSeed ^= mSeed >> 17;
+  mSeed ^= mSeed << 5;
+
+  Node& n = mNodes[node];
+  n.entry = entry;
+  n.left = n.right = n.parent = 0;
+  n.priority = mSeed;
+  n.count = 1;
+  entry->second = node;
+  return node;
+}
+
+/// @param[in] node ~ the node (not `0`)
+template <typename CharT>
+void BasicItemIndex<CharT>::pull(node_type node) {
+  Node& n = mNodes[node];
+  n.count = 1 + mNodes[n.left].count + mNodes[n.right].count;
+  if (n.left) {
+    mNodes[n.left].parent = node;
+  }
+  if (n.right) {
+    mNodes[n.right].parent = node;
+  }
+}
+
+/// @param[in]  node ~ the root of the subtree
+/// @param[in]  k ~ number of items of `left`
+/// @param[out] left ~ the root of the first `k` items
+/// @param[out] right ~ the root of the other items
+/// @note       the parent of the new roots is left to the caller
+template <typename CharT>
+void BasicItemIndex<CharT>::split(node_type node, std::size_t k, node_type& left, node_type& right) {
+
+  if (!node) {
+    left = right = 0;
+    return;
+  }
+  const std::size_t before = mNodes[mNodes[node].left].count;
+  if (k <= before) {
+    node_type rest = 0;
+    split(mNodes[node].left, k, left, rest);
+    mNodes[node].left = rest;
+    right = node;
+  } else {
+    node_type rest = 0;
+    split(mNodes[node].right, k - before - 1, rest, right);
+    mNodes[node].right = rest;
+    left = node;
+  }
+  pull(node);
+}
+
+/// @param[in] left ~ the root of the first items
+/// @param[in] right ~ the root of the items after
+/// @return    the root of the merged subtree (its parent left to the caller)
+template <typename CharT>
+typename BasicItemIndex<CharT>::node_type BasicItemIndex<CharT>::merge(node_type left, node_type right) {
+
+  if (!left || !right) {
+    return left ? left : right;
+  }
+  if (mNodes[left].priority > mNodes[right].priority) {
+    const node_type merged = merge(mNodes[left].right, right);
+    mNodes[left].right = merged;
+    pull(left);
+    return left;
+  }
+  const node_type merged = merge(left, mNodes[right].left);
+  mNodes[right].left = merged;
+  pull(right);
+  return right;
+}
+
+/// @param[in] node ~ the node (not `0`)
+/// @return    the number of items before the item of the node
+template <typename CharT>
+std::size_t BasicItemIndex<CharT>::rank(node_type node) const {
+  std::size_t pos = mNodes[mNodes[node].left].count;
+  for (node_type parent = mNodes[node].parent; parent; node = parent, parent = mNodes[node].parent) {
+    if (mNodes[parent].right == node) {
+      pos += mNodes[mNodes[parent].left].count + 1;
+    }
+  }
+  return pos;
+}
+
+/// @param[in] k ~ position of the item (`k < size()`)
+/// @return    the node of the item
+template <typename CharT>
+typename BasicItemIndex<CharT>::node_type BasicItemIndex<CharT>::kth(std::size_t k) const {
+
+  // descend the treap, skipping the subtrees before `k` ...
+  node_type node = mRoot;
+  for (;;) {
+    const std::size_t before = mNodes[mNodes[node].left].count;
+    if (k < before) {
+      node = mNodes[node].left;
+    } else if (k == before) {
+      return node;
+    } else {
+      k -= before + 1;
+      node = mNodes[node].right;
+    }
+  }
+}
+
+template class BasicItemIndex<char>;
+template class BasicItemIndex<wchar_t>;
+
+#endif // end of ITEMINDEX_CPP
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
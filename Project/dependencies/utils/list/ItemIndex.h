@@ -0,0 +1,137 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		ItemIndex.h
+  * @brief 		Declaration of BasicItemIndex utility class template
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the method signatures for the `BasicItemIndex` class template,
+  *           an index mapping the (unique) items of a list to their position, maintained
+  *           as items are inserted & removed <br/>
+  *           Instantiated for `char` (`ItemIndex`) & `wchar_t` (`WItemIndex`) in ItemIndex.cpp
+  */
+
+#pragma once
+
+/// @brief begin of ITEMINDEX_H declaration
+#ifndef ITEMINDEX_H
+#define ITEMINDEX_H
+
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint32_t
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * @class   BasicItemIndex
+ * @brief   position index of the items of a list
+ * @details Each item is hashed to its node in an implicit treap ordered as the list,
+ *          every node counting the items of its subtree, so that the position of an
+ *          item is the number of items before its node. <br/>
+ *          Membership is O(1), positions O(log n) (expected). Inserting or removing
+ *          (anywhere) splits & merges the treap, so that the following items need no
+ *          update; up to 2^32 - 1 items
+ */
+template <typename CharT>
+class BasicItemIndex {
+
+public:
+
+  /// @brief the string type of the items
+  typedef std::basic_string<CharT> string_type;
+
+  /// @brief value returned by `find(...)` & `erase(...)` when the item is not listed
+  static const std::size_t npos = static_cast<std::size_t>(-1);
+
+public:
+
+  /// @brief default constructor ~ empty list
+  BasicItemIndex() : mNodes(1) { }
+
+  /// @brief method to index the items of a list (discarding the indexed ones)
+  void assign(const std::vector<string_type>& items);
+
+  /// @brief method to discard every item
+  void clear() { assign(std::vector<string_type>()); }
+
+  /// @brief method to retrieve the number of items
+  std::size_t size() const { return mItems.size(); }
+
+  /// @brief method to check whether an item is listed
+  bool contains(const string_type& item) const { return mItems.count(item) != 0; }
+
+  /// @brief method to retrieve the position of an item, `npos` if not listed
+  std::size_t find(const string_type& item) const;
+
+  /// @brief method to retrieve the item at a position (`pos < size()`)
+  const string_type& at(std::size_t pos) const { return mNodes[kth(pos)].entry->first; }
+
+  /// @brief method to insert an item at `pos`, `false` if already listed
+  bool insert(std::size_t pos, const string_type& item);
+
+  /// @brief method to append an item, `false` if already listed
+  bool push_back(const string_type& item) { return insert(size(), item); }
+
+  /// @brief method to remove an item, returning its position (`npos` if not listed)
+  std::size_t erase(const string_type& item);
+
+  /// @brief method to remove the item at a position (`pos < size()`)
+  void eraseAt(std::size_t pos) { erase(at(pos)); }
+
+private:
+
+  /// @brief an indexed item ~ its node
+  typedef std::pair<const string_type, std::size_t> Entry;
+
+  /// @brief index of a node (`0` for none)
+  typedef std::uint32_t node_type;
+
+  /// @brief a node of the treap
+  struct Node {
+    Entry* entry;             ///< the item
+    node_type left;           ///< the subtree of the items before
+    node_type right;          ///< the subtree of the items after
+    node_type parent;         ///< the parent node (`0` for the root)
+    std::uint32_t priority;   ///< the (random) heap priority
+    std::uint32_t count;      ///< the number of items of the subtree
+  };
+
+  /// @brief the node of every item
+  std::unordered_map<string_type, std::size_t> mItems;
+  /// @brief the nodes (`mNodes[0]` standing for none)
+  std::vector<Node> mNodes;
+  /// @brief the nodes freed by `erase(...)`, reused first
+  std::vector<node_type> mFree;
+  /// @brief the root node
+  node_type mRoot = 0;
+  /// @brief state of the priority generator (xorshift)
+  std::uint32_t mSeed = 0x9E3779B9u;
+
+  /// @brief helper method to allocate the node of an item
+  node_type newNode(Entry* entry);
+
+  /// @brief helper method to update the count of a node & the parent of its children
+  void pull(node_type node);
+
+  /// @brief helper method to split a subtree into its first `k` items & the others
+  void split(node_type node, std::size_t k, node_type& left, node_type& right);
+
+  /// @brief helper method to merge two subtrees (the items of `left` first)
+  node_type merge(node_type left, node_type right);
+
+  /// @brief helper method to retrieve the position of the item of a node
+  std::size_t rank(node_type node) const;
+
+  /// @brief helper method to find the node of the item at position `k`
+  node_type kth(std::size_t k) const;
+};
+
+/// @brief index of narrow (i.e. UTF-8) items
+typedef BasicItemIndex<char> ItemIndex;
+/// @brief index of wide (i.e. UTF-16) items
+typedef BasicItemIndex<wchar_t> WItemIndex;
+
+#endif // end of ITEMINDEX_H
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
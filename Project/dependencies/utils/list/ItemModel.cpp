@@ -0,0 +1,228 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		ItemModel.cpp
+  * @brief 		Implemenation of BasicItemModel & BasicItemView utility class templates
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the definition/implemenation
+  *           for the `BasicItemModel` & `BasicItemView` class templates' functionality,
+  *           explicitly instantiated for `char` & `wchar_t`
+  */
+
+/// @brief begin of ITEMMODEL_CPP implementation
+#ifndef ITEMMODEL_CPP
+#define ITEMMODEL_CPP
+
+#include "./ItemModel.h"
+
+#include <algorithm> // std::lower_bound, std::stable_sort
+
+/// @param[in] items ~ the items, in order (repeated items listed once)
+template <typename CharT>
+void BasicItemModel<CharT>::assign(const std::vector<string_type>& items) {
+  mIndex.assign(items);
+  notify(Change{ Change::RESET, 0, nullptr });
+}
+
+/// @param[in] pos ~ position of the new item (`size()` to append)
+/// @param[in] item ~ the item
+/// @return    `true` if inserted, `false` if already listed
+template <typename CharT>
+bool BasicItemModel<CharT>::insert(std::size_t pos, const string_type& item) {
+
+  if (pos > size()) {
+    pos = size();
+  }
+  if (!mIndex.insert(pos, item)) {
+    return false;
+  }
+  notify(Change{ Change::INSERT, pos, &mIndex.at(pos) });
+  return true;
+}
+
+/// @param[in] item ~ the item
+/// @return    the position of the removed item, `npos` if not listed
+template <typename CharT>
+std::size_t BasicItemModel<CharT>::erase(const string_type& item) {
+
+  const std::size_t pos = mIndex.find(item);
+  if (pos == npos) {
+    return npos;
+  }
+  // the item is still listed while the listeners are notified ...
+  notify(Change{ Change::REMOVE, pos, &mIndex.at(pos) });
+  mIndex.erase(item);
+  return pos;
+}
+
+/// @param[in] listener ~ the function notified of the changes
+/// @return    the id of the listener
+template <typename CharT>
+std::size_t BasicItemModel<CharT>::subscribe(listener_type listener) {
+  mListeners.emplace_back(mNextId, std::move(listener));
+  return mNextId++;
+}
+
+/// @param[in] id ~ the id of the listener
+template <typename CharT>
+void BasicItemModel<CharT>::unsubscribe(std::size_t id) {
+  for (std::size_t i = 0; i < mListeners.size(); i++) {
+    if (mListeners[i].first == id) {
+      mListeners.erase(mListeners.begin() + i);
+      return;
+    }
+  }
+}
+
+/// @param[in] change ~ the change
+template <typename CharT>
+void BasicItemModel<CharT>::notify(const Change& change) const {
+  for (std::size_t i = 0; i < mListeners.size(); i++) {
+    if (mListeners[i].second) {
+      mListeners[i].second(change);
+    }
+  }
+}
+
+/// @param[in] model ~ the model (to outlive the view)
+template <typename CharT>
+BasicItemView<CharT>::BasicItemView(model_type& model) : mModel(model) {
+  mSubscription = mModel.subscribe([this](const Change& change) { modelChanged(change); });
+  build();
+}
+
+/// @param[in] order ~ the order function (`nullptr` for the order of the model)
+template <typename CharT>
+void BasicItemView<CharT>::setOrder(order_type order) {
+  mOrder = std::move(order);
+  build();
+  notify(Change::RESET, 0, nullptr);
+}
+
+/// @param[in] filter ~ the filter function (`nullptr` to show every item)
+template <typename CharT>
+void BasicItemView<CharT>::setFilter(filter_type filter) {
+  mFilter = std::move(filter);
+  build();
+  notify(Change::RESET, 0, nullptr);
+}
+
+/// @param[in] item ~ the item
+/// @return    the row of the item, `npos` if not shown
+template <typename CharT>
+std::size_t BasicItemView<CharT>::find(const string_type& item) const {
+
+  const std::size_t pos = mModel.find(item);
+  if (pos == model_type::npos) {
+    return npos;
+  }
+  const string_type* p = &mModel.at(pos);
+  const std::size_t row = lowerBound(p);
+  return (row < mRows.size() && mRows[row] == p) ? row : npos;
+}
+
+/// @param[in] change ~ the change of the model
+template <typename CharT>
+void BasicItemView<CharT>::modelChanged(const Change& change) {
+
+  switch (change.kind) {
+
+    case Change::INSERT: {
+      if (mFilter && !mFilter(*change.item)) {
+        return;
+      }
+      const std::size_t row = lowerBound(change.item);
+      mRows.insert(mRows.begin() + row, change.item);
+      notify(Change::INSERT, row, change.item);
+      break;
+    }
+
+    case Change::REMOVE: {
+      // the item is still in the model, i.e. comparable ...
+      const std::size_t row = lowerBound(change.item);
+      if (row < mRows.size() && mRows[row] == change.item) {
+        notify(Change::REMOVE, row, change.item);
+        mRows.erase(mRows.begin() + row);
+      }
+      break;
+    }
+
+    case Change::RESET: {
+      build();
+      notify(Change::RESET, 0, nullptr);
+      break;
+    }
+  }
+}
+
+template <typename CharT>
+void BasicItemView<CharT>::build() {
+
+  mRows.clear();
+  mRows.reserve(mModel.size());
+  for (std::size_t i = 0; i < mModel.size(); i++) {
+    const string_type* item = &mModel.at(i);
+    if (!mFilter || mFilter(*item)) {
+      mRows.push_back(item);
+    }
+  }
+
+  // stable ~ ties keep the order of the model
+  if (mOrder) {
+    std::stable_sort(mRows.begin(), mRows.end(), [this](const string_type* a, const string_type* b) {
+      return mOrder(*a, *b);
+    });
+  }
+  mBuilds++;
+}
+
+/// @param[in] a ~ an item of the model
+/// @param[in] b ~ an item of the model
+/// @return    `true` if `a` goes before `b`
+template <typename CharT>
+bool BasicItemView<CharT>::before(const string_type* a, const string_type* b) const {
+
+  if (a == b) {
+    return false;
+  }
+  if (mOrder) {
+    if (mOrder(*a, *b)) {
+      return true;
+    }
+    if (mOrder(*b, *a)) {
+      return false;
+    }
+  }
+  return mModel.find(*a) < mModel.find(*b);
+}
+
+/// @param[in] item ~ an item of the model
+/// @return    the first row not going before `item`
+template <typename CharT>
+std::size_t BasicItemView<CharT>::lowerBound(const string_type* item) const {
+  auto found = std::lower_bound(mRows.begin(), mRows.end(), item,
+    [this](const string_type* row, const string_type* value) {
+      return before(row, value);
+    }
+  );
+  return static_cast<std::size_t>(found - mRows.begin());
+}
+
+/// @param[in] kind ~ the kind of change
+/// @param[in] row ~ the row inserted/removed
+/// @param[in] item ~ the item inserted/removed
+template <typename CharT>
+void BasicItemView<CharT>::notify(typename Change::Kind kind, std::size_t row, const string_type* item) const {
+  if (mOnChange) {
+    mOnChange(Change{ kind, row, item });
+  }
+}
+
+template class BasicItemModel<char>;
+template class BasicItemModel<wchar_t>;
+template class BasicItemView<char>;
+template class BasicItemView<wchar_t>;
+
+#endif // end of ITEMMODEL_CPP
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
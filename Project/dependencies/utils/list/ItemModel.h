@@ -0,0 +1,240 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		ItemModel.h
+  * @brief 		Declaration of BasicItemModel & BasicItemView utility class templates
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the method signatures for the `BasicItemModel` class template,
+  *           a list of (unique) items notifying its inserts & removes, & the `BasicItemView`
+  *           class template, a sorted and/or filtered view of a model, maintained as the model
+  *           changes <br/>
+  *           Instantiated for `char` (`ItemModel`, `ItemView`) & `wchar_t` (`WItemModel`,
+  *           `WItemView`) in ItemModel.cpp
+  */
+
+#pragma once
+
+/// @brief begin of ITEMMODEL_H declaration
+#ifndef ITEMMODEL_H
+#define ITEMMODEL_H
+
+#include <cstddef> // std::size_t
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "./ItemIndex.h"
+
+/**
+ * @class   BasicItemModel
+ * @brief   list of unique items notifying its changes
+ * @details The items are kept by a `BasicItemIndex` (O(1) membership, O(log n) positions),
+ *          whose storage is shared with the views: an item keeps its address until removed.
+ *          <br/>
+ *          Listeners are notified of every insert (after the item is inserted), remove
+ *          (before the item is discarded) & reset (after `assign(...)`)
+ */
+template <typename CharT>
+class BasicItemModel {
+
+public:
+
+  /// @brief the string type of the items
+  typedef std::basic_string<CharT> string_type;
+
+  /// @brief value returned by `find(...)` & `erase(...)` when the item is not listed
+  static const std::size_t npos = static_cast<std::size_t>(-1);
+
+  /// @brief a change of a list (model or view)
+  struct Change {
+    /// @brief the kind of change
+    enum Kind { INSERT, REMOVE, RESET };
+    /// @brief the kind of change
+    Kind kind;
+    /// @brief position of the inserted/removed item (0 upon reset)
+    std::size_t pos;
+    /// @brief the inserted/removed item (`nullptr` upon reset)
+    const string_type* item;
+  };
+
+  /// @brief the function notified of the changes
+  typedef std::function<void(const Change&)> listener_type;
+
+public:
+
+  /// @brief default constructor ~ empty list
+  BasicItemModel() = default;
+
+  /// @brief deleted copy constructor (views & listeners refer to the model)
+  BasicItemModel(const BasicItemModel&) = delete;
+  /// @brief deleted copy assignment (views & listeners refer to the model)
+  BasicItemModel& operator=(const BasicItemModel&) = delete;
+
+  /// @brief method to replace the items (repeated items listed once), notifying a reset
+  void assign(const std::vector<string_type>& items);
+
+  /// @brief method to discard every item, notifying a reset
+  void clear() { assign(std::vector<string_type>()); }
+
+  /// @brief method to retrieve the number of items
+  std::size_t size() const { return mIndex.size(); }
+
+  /// @brief method to check whether an item is listed
+  bool contains(const string_type& item) const { return mIndex.contains(item); }
+
+  /// @brief method to retrieve the position of an item, `npos` if not listed
+  std::size_t find(const string_type& item) const { return mIndex.find(item); }
+
+  /// @brief method to retrieve the item at a position (`pos < size()`)
+  const string_type& at(std::size_t pos) const { return mIndex.at(pos); }
+
+  /// @brief method to insert an item at `pos`, `false` if already listed
+  bool insert(std::size_t pos, const string_type& item);
+
+  /// @brief method to append an item, `false` if already listed
+  bool push_back(const string_type& item) { return insert(size(), item); }
+
+  /// @brief method to remove an item, returning its position (`npos` if not listed)
+  std::size_t erase(const string_type& item);
+
+  /// @brief method to remove the item at a position (`pos < size()`)
+  void eraseAt(std::size_t pos) { erase(at(pos)); }
+
+  /// @brief method to register a listener, returning its id (see `unsubscribe(...)`)
+  std::size_t subscribe(listener_type listener);
+
+  /// @brief method to unregister a listener by id
+  void unsubscribe(std::size_t id);
+
+private:
+
+  /// @brief the items
+  BasicItemIndex<CharT> mIndex;
+
+  /// @brief the listeners, by id
+  std::vector<std::pair<std::size_t, listener_type>> mListeners;
+  /// @brief id of the next listener
+  std::size_t mNextId = 1;
+
+  /// @brief helper method to notify the listeners of a change
+  void notify(const Change& change) const;
+};
+
+/**
+ * @class   BasicItemView
+ * @brief   sorted and/or filtered view of a `BasicItemModel`
+ * @details The rows point to the items of the model (no string is copied), ordered by
+ *          the order function (ties & no order function: the order of the model) & limited
+ *          to the items accepted by the filter function. <br/>
+ *          Inserts & removes of the model are applied to the view as they happen, an item
+ *          being placed by binary search (O(log n) comparisons), & the listener notified
+ *          of the changed row only; setting the order or the filter builds the view again
+ *          (O(n log n)) & notifies a reset
+ * @note    the model is to outlive the view
+ */
+template <typename CharT>
+class BasicItemView {
+
+public:
+
+  /// @brief the model type
+  typedef BasicItemModel<CharT> model_type;
+  /// @brief the string type of the items
+  typedef typename model_type::string_type string_type;
+  /// @brief a change of the view (`pos` being the row)
+  typedef typename model_type::Change Change;
+  /// @brief the function notified of the changes
+  typedef typename model_type::listener_type listener_type;
+  /// @brief the order function, `true` if the first item goes before the second
+  typedef std::function<bool(const string_type&, const string_type&)> order_type;
+  /// @brief the filter function, `true` if the item is shown
+  typedef std::function<bool(const string_type&)> filter_type;
+
+  /// @brief value returned by `find(...)` when the item is not shown
+  static const std::size_t npos = static_cast<std::size_t>(-1);
+
+public:
+
+  /// @brief constructor ~ every item of the model, in the order of the model
+  explicit BasicItemView(model_type& model);
+
+  /// @brief destructor ~ unregisters from the model
+  ~BasicItemView() { mModel.unsubscribe(mSubscription); }
+
+  /// @brief deleted copy constructor (registered to the model)
+  BasicItemView(const BasicItemView&) = delete;
+  /// @brief deleted copy assignment (registered to the model)
+  BasicItemView& operator=(const BasicItemView&) = delete;
+
+  /// @brief method to retrieve the model
+  const model_type& model() const { return mModel; }
+
+  /// @brief method to set the order function (`nullptr` for the order of the model)
+  void setOrder(order_type order);
+
+  /// @brief method to set the filter function (`nullptr` to show every item)
+  void setFilter(filter_type filter);
+
+  /// @brief method to set the function notified of the changes of the view
+  void setOnChange(listener_type listener) { mOnChange = std::move(listener); }
+
+  /// @brief method to retrieve the number of rows
+  std::size_t size() const { return mRows.size(); }
+
+  /// @brief method to retrieve the item of a row (`row < size()`)
+  const string_type& at(std::size_t row) const { return *mRows[row]; }
+
+  /// @brief method to retrieve the row of an item, `npos` if not shown
+  std::size_t find(const string_type& item) const;
+
+  /// @brief method to retrieve the number of times the view was built
+  std::size_t builds() const { return mBuilds; }
+
+private:
+
+  /// @brief the model
+  model_type& mModel;
+  /// @brief id of the listener registered to the model
+  std::size_t mSubscription = 0;
+
+  /// @brief the order function (optional)
+  order_type mOrder;
+  /// @brief the filter function (optional)
+  filter_type mFilter;
+  /// @brief the function notified of the changes (optional)
+  listener_type mOnChange;
+
+  /// @brief the items of the model shown, in order
+  std::vector<const string_type*> mRows;
+  /// @brief number of times the view was built
+  std::size_t mBuilds = 0;
+
+  /// @brief helper method to apply a change of the model
+  void modelChanged(const Change& change);
+
+  /// @brief helper method to build the rows from the model
+  void build();
+
+  /// @brief helper method to check whether an item goes before another
+  bool before(const string_type* a, const string_type* b) const;
+
+  /// @brief helper method to retrieve the first row not going before an item
+  std::size_t lowerBound(const string_type* item) const;
+
+  /// @brief helper method to notify the listener of a change
+  void notify(typename Change::Kind kind, std::size_t row, const string_type* item) const;
+};
+
+/// @brief model of narrow (i.e. UTF-8) items
+typedef BasicItemModel<char> ItemModel;
+/// @brief model of wide (i.e. UTF-16) items
+typedef BasicItemModel<wchar_t> WItemModel;
+/// @brief view of a model of narrow (i.e. UTF-8) items
+typedef BasicItemView<char> ItemView;
+/// @brief view of a model of wide (i.e. UTF-16) items
+typedef BasicItemView<wchar_t> WItemView;
+
+#endif // end of ITEMMODEL_H
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
@@ -0,0 +1,145 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		PageQueue.cpp
+  * @brief 		Implemenation of PageQueue utility class
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the definition/implemenation
+  *           for the `PageQueue` class' functionality
+  */
+
+/// @brief begin of PAGEQUEUE_CPP implementation
+#ifndef PAGEQUEUE_CPP
+#define PAGEQUEUE_CPP
+
+#include "./PageQueue.h"
+
+/// @param[in] pageSize ~ number of rows per page
+/// @param[in] capacity ~ maximum number of pages waiting to be taken
+PageQueue::PageQueue(std::size_t pageSize, std::size_t capacity)
+  : mPageSize(pageSize ? pageSize : 1), mCapacity(capacity ? capacity : 1) {
+}
+
+/// @param[in] producer ~ the producer (run on the producer thread)
+/// @param[in] ready ~ the function called on the producer thread once a page is ready (optional)
+/// @return    `true` if started, `false` if started already (or cancelled)
+bool PageQueue::start(producer_type producer, ready_type ready) {
+
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (mStarted || mCancelled.load()) {
+      return false;
+    }
+    mStarted = true;
+  }
+  mWorker = std::thread(&PageQueue::run, this, std::move(producer), std::move(ready));
+  return true;
+}
+
+/// @param[in] pages ~ number of pages waiting or requested
+/// @details   repeated requests (i.e. every scroll message) do not add up
+void PageQueue::request(std::size_t pages) {
+
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    const std::size_t ahead = mPages.size() + mDemand;
+    if (mDone || ahead >= pages) {
+      return;
+    }
+    mDemand += pages - ahead;
+  }
+  mCv.notify_all();
+}
+
+/// @param[out] page ~ the page taken
+/// @return     `true` if a page was taken
+bool PageQueue::pop(page_type& page) {
+
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (mPages.empty()) {
+      return false;
+    }
+    page = std::move(mPages.front());
+    mPages.pop_front();
+  }
+  // room for the producer ...
+  mCv.notify_all();
+  return true;
+}
+
+void PageQueue::cancel() {
+
+  mCancelled.store(true);
+  mCv.notify_all();
+
+  if (mWorker.joinable() && mWorker.get_id() != std::this_thread::get_id()) {
+    mWorker.join();
+  }
+
+  std::lock_guard<std::mutex> lock(mMutex);
+  mPages.clear();
+  mDemand = 0;
+  mDone = true;
+}
+
+/// @return `true` if no page is to come
+bool PageQueue::finished() const {
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mDone && mPages.empty();
+}
+
+/// @return the number of pages waiting to be taken
+std::size_t PageQueue::waiting() const {
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mPages.size();
+}
+
+/// @param[in] producer ~ the producer
+/// @param[in] ready ~ the function called once a page is ready (optional)
+void PageQueue::run(producer_type producer, ready_type ready) {
+
+  bool more = true;
+  while (more) {
+
+    // wait for a request & room in the queue ...
+    {
+      std::unique_lock<std::mutex> lock(mMutex);
+      mCv.wait(lock, [this]() {
+        return mCancelled.load() || (mDemand > 0 && mPages.size() < mCapacity);
+      });
+      if (mCancelled.load()) {
+        break;
+      }
+      mDemand--;
+    }
+
+    // ... then produce outside the lock
+    page_type page;
+    page.reserve(mPageSize);
+    more = producer(page, mPageSize);
+    if (mCancelled.load()) {
+      break;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mMutex);
+      if (!page.empty()) {
+        mPages.push_back(std::move(page));
+      }
+      if (!more) {
+        mDone = true;
+      }
+    }
+    if (ready) {
+      ready();
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(mMutex);
+  mDone = true;
+}
+
+#endif // end of PAGEQUEUE_CPP
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
@@ -0,0 +1,121 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		PageQueue.h
+  * @brief 		Declaration of PageQueue utility class
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the method signatures for the `PageQueue` class,
+  *           the handoff of pages of rows from a producer thread to the UI thread
+  */
+
+#pragma once
+
+/// @brief begin of PAGEQUEUE_H declaration
+#ifndef PAGEQUEUE_H
+#define PAGEQUEUE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef> // std::size_t
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @class   PageQueue
+ * @brief   bounded queue of pages of rows filled by a producer thread on demand
+ * @details The producer (i.e. a file scan or parser) runs on a thread of its own & fills
+ *          one page at a time, only while pages are requested (`request(...)`, i.e. upon
+ *          scrolling near the last row) & fewer than `capacity` pages wait to be taken
+ *          (back-pressure). <br/>
+ *          Each page is announced through the ready function (called on the producer
+ *          thread, i.e. to post a message to the control) & taken by the UI thread with
+ *          `pop(...)`, which never blocks. <br/>
+ *          `cancel()` stops the producer at the next page (or sooner, if the producer
+ *          checks `cancelled()`) & waits for the thread
+ */
+class PageQueue {
+
+public:
+
+  /// @brief a page of rows
+  typedef std::vector<std::string> page_type;
+
+  /// @brief the producer, appending at most `size` rows to `page`,
+  ///        `false` once no row is left (the last rows being still delivered)
+  typedef std::function<bool(page_type& page, std::size_t size)> producer_type;
+
+  /// @brief the function called (on the producer thread) once a page is ready
+  typedef std::function<void()> ready_type;
+
+public:
+
+  /// @brief constructor ~ pages of `pageSize` rows, at most `capacity` of them waiting
+  explicit PageQueue(std::size_t pageSize = 256, std::size_t capacity = 4);
+
+  /// @brief destructor ~ cancels the producer
+  ~PageQueue() { cancel(); }
+
+  /// @brief deleted copy constructor (owns a thread)
+  PageQueue(const PageQueue&) = delete;
+  /// @brief deleted copy assignment (owns a thread)
+  PageQueue& operator=(const PageQueue&) = delete;
+
+  /// @brief method to start the producer thread (once)
+  bool start(producer_type producer, ready_type ready);
+
+  /// @brief method to ensure `pages` pages are either waiting or requested
+  void request(std::size_t pages = 1);
+
+  /// @brief method to take the next page, `false` if none is waiting (never blocks)
+  bool pop(page_type& page);
+
+  /// @brief method to stop the producer & wait for its thread
+  void cancel();
+
+  /// @brief method to check whether the producer is to stop
+  bool cancelled() const { return mCancelled.load(); }
+
+  /// @brief method to check whether the producer is done (or cancelled) & every page taken
+  bool finished() const;
+
+  /// @brief method to retrieve the number of pages waiting
+  std::size_t waiting() const;
+
+  /// @brief method to retrieve the number of rows per page
+  std::size_t pageSize() const { return mPageSize; }
+
+private:
+
+  /// @brief the producer thread
+  std::thread mWorker;
+  /// @brief mutex & condition variable guarding the pages & the demand
+  mutable std::mutex mMutex;
+  std::condition_variable mCv;
+
+  /// @brief the pages waiting to be taken
+  std::deque<page_type> mPages;
+  /// @brief number of rows per page
+  std::size_t mPageSize;
+  /// @brief maximum number of pages waiting
+  std::size_t mCapacity;
+  /// @brief number of pages requested, not produced yet
+  std::size_t mDemand = 0;
+
+  /// @brief flag indicating the producer thread was started
+  bool mStarted = false;
+  /// @brief flag indicating the producer is done (or cancelled)
+  bool mDone = false;
+  /// @brief flag indicating the producer is to stop
+  std::atomic<bool> mCancelled{ false };
+
+  /// @brief helper method (producer thread) producing the requested pages
+  void run(producer_type producer, ready_type ready);
+};
+
+#endif // end of PAGEQUEUE_H
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
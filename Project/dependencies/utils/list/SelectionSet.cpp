@@ -0,0 +1,294 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		SelectionSet.cpp
+  * @brief 		Implemenation of SelectionSet utility class
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the definition/implemenation
+  *           for the `SelectionSet` class' functionality
+  */
+
+/// @brief begin of SELECTIONSET_CPP implementation
+#ifndef SELECTIONSET_CPP
+#define SELECTIONSET_CPP
+
+#include "./SelectionSet.h"
+
+#ifdef _MSC_VER
+#include <intrin.h> // _BitScanForward(64)
+#endif
+
+namespace {
+
+  /// @brief helper function to count the set bits of a word
+  inline std::size_t popcount(std::uint64_t w) {
+    #if defined(__GNUC__)
+    return static_cast<std::size_t>(__builtin_popcountll(w));
+    #else
+    // no `popcnt` instruction assumed ...
+    w = w - ((w >> 1) & 0x5555555555555555ULL);
+    w = (w & 0x3333333333333333ULL) + ((w >> 2) & 0x3333333333333333ULL);
+    w = (w + (w >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return static_cast<std::size_t>((w * 0x0101010101010101ULL) >> 56);
+    #endif
+  }
+
+  /// @brief helper function to retrieve the index of the lowest set bit (`w != 0`)
+  inline std::size_t lowestBit(std::uint64_t w) {
+    #if defined(__GNUC__)
+    return static_cast<std::size_t>(__builtin_ctzll(w));
+    #elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanForward64(&index, w);
+    return index;
+    #elif defined(_MSC_VER)
+    unsigned long index;
+    if (_BitScanForward(&index, static_cast<unsigned long>(w))) {
+      return index;
+    }
+    _BitScanForward(&index, static_cast<unsigned long>(w >> 32));
+    return index + 32;
+    #else
+    std::size_t index = 0;
+    while (!(w & 1)) {
+      w >>= 1;
+      index++;
+    }
+    return index;
+    #endif
+  }
+
+  /// @brief mask of the bits from `bit` (included) up
+  inline std::uint64_t maskFrom(std::size_t bit) {
+    return ~0ULL << bit;
+  }
+
+  /// @brief mask of the bits up to `bit` (included)
+  inline std::uint64_t maskTo(std::size_t bit) {
+    return ~0ULL >> (63 - bit);
+  }
+}
+
+/// @param[in] size ~ the new number of positions
+void SelectionSet::resize(std::size_t size) {
+
+  const std::size_t words = (size + 63) / 64;
+
+  if (size < mSize) {
+    // drop the positions past `size` ...
+    for (std::size_t w = words; w < mWords.size(); w++) {
+      mCount -= popcount(mWords[w]);
+    }
+    mWords.resize(words);
+    if (size % 64) {
+      store(words - 1, mWords[words - 1] & maskTo(size % 64 - 1));
+    }
+    mSummary.resize((words + 63) / 64);
+    if (words % 64) {
+      mSummary.back() &= maskTo(words % 64 - 1);
+    }
+  } else {
+    // new words (& their summary bits) are zero ...
+    mWords.resize(words, 0);
+    mSummary.resize((words + 63) / 64, 0);
+  }
+  mSize = size;
+}
+
+void SelectionSet::clear() {
+  mWords.assign(mWords.size(), 0);
+  mSummary.assign(mSummary.size(), 0);
+  mCount = 0;
+}
+
+void SelectionSet::invert() {
+
+  if (mSize == 0) {
+    return;
+  }
+
+  const std::size_t last = mWords.size() - 1;
+  for (std::size_t w = 0; w < last; w++) {
+    mWords[w] = ~mWords[w];
+  }
+  mWords[last] = ~mWords[last] & maskTo((mSize - 1) % 64);
+  mCount = mSize - mCount;
+
+  for (std::size_t w = 0; w < mWords.size(); w++) {
+    const std::uint64_t bit = 1ULL << (w % 64);
+    if (mWords[w]) {
+      mSummary[w / 64] |= bit;
+    } else {
+      mSummary[w / 64] &= ~bit;
+    }
+  }
+}
+
+/// @param[in] pos ~ position of the first new position (`size()` to append)
+/// @param[in] count ~ number of new positions
+/// @details   the words from `pos` up are shifted a word at a time, from the last one down
+void SelectionSet::insertAt(std::size_t pos, std::size_t count) {
+
+  if (pos > mSize) {
+    pos = mSize;
+  }
+  if (count == 0) {
+    return;
+  }
+  resize(mSize + count);
+
+  const long long shift = static_cast<long long>(count);
+  for (std::size_t w = mWords.size(); w-- > pos / 64; ) {
+    const std::size_t base = w * 64;
+    // the positions before `pos` stay, those after the new ones come from `count` below ...
+    const std::uint64_t keep = (base + 64 <= pos) ? ~0ULL : (pos > base ? maskTo(pos - base - 1) : 0);
+    const std::uint64_t moved = (base >= pos + count) ? ~0ULL : (pos + count < base + 64 ? maskFrom(pos + count - base) : 0);
+    store(w, (mWords[w] & keep) | (read(static_cast<long long>(base) - shift) & moved));
+  }
+}
+
+/// @param[in] pos ~ position of the first dropped position
+/// @param[in] count ~ number of dropped positions
+/// @details   the words from `pos` up are shifted a word at a time, from the first one up
+void SelectionSet::eraseAt(std::size_t pos, std::size_t count) {
+
+  if (pos >= mSize || count == 0) {
+    return;
+  }
+  if (count > mSize - pos) {
+    count = mSize - pos;
+  }
+
+  for (std::size_t w = pos / 64; w < mWords.size(); w++) {
+    const std::size_t base = w * 64;
+    // the positions before `pos` stay, the others come from `count` above ...
+    const std::uint64_t keep = (pos > base) ? maskTo(pos - base - 1) : 0;
+    store(w, (mWords[w] & keep) | (read(static_cast<long long>(base + count)) & ~keep));
+  }
+  resize(mSize - count);
+}
+
+/// @param[in] from ~ first position
+/// @return    the first selected position at or after `from`, `npos` if none
+std::size_t SelectionSet::next(std::size_t from) const {
+
+  if (from >= mSize) {
+    return npos;
+  }
+
+  std::size_t w = from / 64;
+  const std::uint64_t bits = mWords[w] & maskFrom(from % 64);
+  if (bits) {
+    return w * 64 + lowestBit(bits);
+  }
+
+  // the next word holding any position, through the summary ...
+  w++;
+  if (w >= mWords.size()) {
+    return npos;
+  }
+  std::size_t s = w / 64;
+  std::uint64_t summary = mSummary[s] & maskFrom(w % 64);
+  while (!summary) {
+    if (++s >= mSummary.size()) {
+      return npos;
+    }
+    summary = mSummary[s];
+  }
+  w = s * 64 + lowestBit(summary);
+  return w * 64 + lowestBit(mWords[w]);
+}
+
+/// @param[in] from ~ first position
+/// @return    the first unselected position at or after `from`, `size()` if none
+std::size_t SelectionSet::nextClear(std::size_t from) const {
+
+  if (from >= mSize) {
+    return mSize;
+  }
+
+  for (std::size_t w = from / 64; w < mWords.size(); w++) {
+    std::uint64_t bits = ~mWords[w];
+    if (w == from / 64) {
+      bits &= maskFrom(from % 64);
+    }
+    if (bits) {
+      const std::size_t pos = w * 64 + lowestBit(bits);
+      return pos < mSize ? pos : mSize;
+    }
+  }
+  return mSize;
+}
+
+/// @param[in] first ~ first position
+/// @param[in] last ~ past the last position
+/// @param[in] selected ~ whether the positions are selected or deselected
+void SelectionSet::assign(std::size_t first, std::size_t last, bool selected) {
+
+  if (first >= last) {
+    return;
+  }
+  if (last > mSize) {
+    if (!selected) {
+      last = mSize;
+      if (first >= last) {
+        return;
+      }
+    } else {
+      resize(last);
+    }
+  }
+
+  const std::size_t w0 = first / 64;
+  const std::size_t w1 = (last - 1) / 64;
+  for (std::size_t w = w0; w <= w1; w++) {
+    std::uint64_t mask = ~0ULL;
+    if (w == w0) {
+      mask &= maskFrom(first % 64);
+    }
+    if (w == w1) {
+      mask &= maskTo((last - 1) % 64);
+    }
+    store(w, selected ? (mWords[w] | mask) : (mWords[w] & ~mask));
+  }
+}
+
+/// @param[in] word ~ index of the word
+/// @param[in] bits ~ the new bits of the word
+void SelectionSet::store(std::size_t word, std::uint64_t bits) {
+
+  const std::uint64_t old = mWords[word];
+  if (old == bits) {
+    return;
+  }
+  mCount = mCount - popcount(old) + popcount(bits);
+  mWords[word] = bits;
+
+  const std::uint64_t bit = 1ULL << (word % 64);
+  if (bits) {
+    mSummary[word / 64] |= bit;
+  } else {
+    mSummary[word / 64] &= ~bit;
+  }
+}
+
+/// @param[in] from ~ first position
+/// @return    the positions [`from`, `from + 64`), from the lowest bit
+std::uint64_t SelectionSet::read(long long from) const {
+
+  const long long words = static_cast<long long>(mWords.size());
+  // floor division, i.e. negative positions in the word before the first ...
+  const long long w = (from >= 0) ? from / 64 : -((63 - from) / 64);
+  const unsigned bit = static_cast<unsigned>(from - w * 64);
+
+  const std::uint64_t low = (w >= 0 && w < words) ? mWords[static_cast<std::size_t>(w)] : 0;
+  if (bit == 0) {
+    return low;
+  }
+  const std::uint64_t high = (w + 1 >= 0 && w + 1 < words) ? mWords[static_cast<std::size_t>(w + 1)] : 0;
+  return (low >> bit) | (high << (64 - bit));
+}
+
+#endif // end of SELECTIONSET_CPP
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
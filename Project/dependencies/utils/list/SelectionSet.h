@@ -0,0 +1,124 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		SelectionSet.h
+  * @brief 		Declaration of SelectionSet utility class
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the method signatures for the `SelectionSet` class,
+  *           the set of selected positions of a list, with range operations
+  */
+
+#pragma once
+
+/// @brief begin of SELECTIONSET_H declaration
+#ifndef SELECTIONSET_H
+#define SELECTIONSET_H
+
+#include <cstddef> // std::size_t
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class   SelectionSet
+ * @brief   two-level bitset of selected positions
+ * @details One bit per position, 64 per word, & one summary bit per word set when the
+ *          word holds any position, so that iterating skips 4096 unselected positions
+ *          per summary word. <br/>
+ *          Membership is O(1); ranges (select/deselect all, invert) are applied a word
+ *          at a time; the count is maintained with popcounts as words change. <br/>
+ *          Iteration allocates nothing:
+ *          `for (size_t i = set.next(0); i != SelectionSet::npos; i = set.next(i + 1))`
+ */
+class SelectionSet {
+
+public:
+
+  /// @brief value returned by `next(...)` when no position follows
+  static const std::size_t npos = static_cast<std::size_t>(-1);
+
+public:
+
+  /// @brief default constructor ~ empty list
+  SelectionSet() = default;
+
+  /// @brief constructor ~ list of `size` positions, none selected
+  explicit SelectionSet(std::size_t size) { resize(size); }
+
+  /// @brief method to change the number of positions (positions past `size` are dropped)
+  void resize(std::size_t size);
+
+  /// @brief method to retrieve the number of positions
+  std::size_t size() const { return mSize; }
+
+  /// @brief method to retrieve the number of selected positions
+  std::size_t count() const { return mCount; }
+
+  /// @brief method to check whether no position is selected
+  bool empty() const { return mCount == 0; }
+
+  /// @brief method to check whether a position is selected
+  bool contains(std::size_t pos) const {
+    return pos < mSize && ((mWords[pos >> 6] >> (pos & 63)) & 1) != 0;
+  }
+
+  /// @brief method to select a position (growing the list if needed)
+  void insert(std::size_t pos) { assign(pos, pos + 1, true); }
+
+  /// @brief method to deselect a position
+  void erase(std::size_t pos) { assign(pos, pos + 1, false); }
+
+  /// @brief method to select the positions in [`first`, `last`) (growing the list if needed)
+  void insert(std::size_t first, std::size_t last) { assign(first, last, true); }
+
+  /// @brief method to deselect the positions in [`first`, `last`)
+  void erase(std::size_t first, std::size_t last) { assign(first, last, false); }
+
+  /// @brief method to select every position
+  void fill() { assign(0, mSize, true); }
+
+  /// @brief method to deselect every position
+  void clear();
+
+  /// @brief method to invert the selection of every position
+  void invert();
+
+  /// @brief method to open `count` unselected positions at `pos`, the following ones
+  ///        moving up (i.e. rows inserted in the list)
+  void insertAt(std::size_t pos, std::size_t count = 1);
+
+  /// @brief method to drop `count` positions at `pos`, the following ones
+  ///        moving down (i.e. rows removed from the list)
+  void eraseAt(std::size_t pos, std::size_t count = 1);
+
+  /// @brief method to retrieve the first selected position at or after `from`, `npos` if none
+  std::size_t next(std::size_t from) const;
+
+  /// @brief method to retrieve the first unselected position at or after `from`, `size()` if none
+  std::size_t nextClear(std::size_t from) const;
+
+private:
+
+  /// @brief the positions, 64 per word
+  std::vector<std::uint64_t> mWords;
+  /// @brief one bit per word of `mWords`, set if the word is not zero
+  std::vector<std::uint64_t> mSummary;
+
+  /// @brief number of positions
+  std::size_t mSize = 0;
+  /// @brief number of selected positions
+  std::size_t mCount = 0;
+
+  /// @brief helper method to (de)select the positions in [`first`, `last`)
+  void assign(std::size_t first, std::size_t last, bool selected);
+
+  /// @brief helper method to store a word, updating the count & the summary
+  void store(std::size_t word, std::uint64_t bits);
+
+  /// @brief helper method to read the 64 positions from `from` (possibly unaligned or
+  ///        negative), positions out of the list being unselected
+  std::uint64_t read(long long from) const;
+};
+
+#endif // end of SELECTIONSET_H
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
@@ -0,0 +1,519 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		AssetPack.cpp
+  * @brief 		Implemenation of the AssetPack & AssetPackBuilder utility classes
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the definition/implemenation
+  *           for the `AssetPack` reader & the `AssetPackBuilder` <br/>
+  *           When compiled with `-DPACK_TOOL` this file also provides
+  *           the `main` entry point of the command line packer used by `make pack`
+  */
+
+/// @brief begin of ASSETPACK_CPP implementation
+#ifndef ASSETPACK_CPP
+#define ASSETPACK_CPP
+
+#include "./AssetPack.h"
+
+#include <algorithm> // std::sort, std::lower_bound
+#include <cstring>   // std::memcmp, std::memcpy
+#include <cctype>    // ::tolower
+#include <fstream>
+#include <iterator>  // std::istreambuf_iterator
+
+static_assert(sizeof(AssetPack::Header) == 32, "unexpected AssetPack::Header layout");
+static_assert(sizeof(AssetPack::Entry) == 32, "unexpected AssetPack::Entry layout");
+
+const char AssetPack::MAGIC[4] = { 'X', 'P', 'A', 'K' };
+
+/// @brief helper to round an offset up to the next `AssetPack::ALIGNMENT` boundary
+static std::uint64_t alignUp(std::uint64_t offset) {
+  return (offset + (AssetPack::ALIGNMENT - 1)) & ~static_cast<std::uint64_t>(AssetPack::ALIGNMENT - 1);
+}
+
+/// @brief helper to compare an index entry's name to a (normalized) name
+static int compareName(const char* strings, const AssetPack::Entry& entry, const std::string& name) {
+  std::size_t n = std::min<std::size_t>(entry.nameLength, name.size());
+  int c = std::memcmp(strings + entry.nameOffset, name.data(), n);
+  if (c != 0) {
+    return c;
+  }
+  if (entry.nameLength == name.size()) {
+    return 0;
+  }
+  return (entry.nameLength < name.size()) ? -1 : 1;
+}
+
+/// @param[in] name ~ asset name/path to normalize
+/// @details   back slashes become forward slashes & any leading "./" or "/" is dropped,
+///            so that "./src/png/a.png", "src\\png\\a.png" & "src/png/a.png" are the same asset
+/// @return    copy of the normalized name
+std::string AssetPack::normalize(const std::string& name) {
+  std::string n(name);
+  std::replace(n.begin(), n.end(), '\\', '/');
+  std::size_t start = 0;
+  while (true) {
+    if (n.compare(start, 2, "./") == 0) {
+      start += 2;
+    } else if (n.compare(start, 1, "/") == 0) {
+      start += 1;
+    } else {
+      break;
+    }
+  }
+  return n.substr(start);
+}
+
+/// @param[in] path ~ file path of the `.xpak` archive
+/// @details   maps the archive into memory & validates the header & the index
+/// @return    `true` if the archive is mapped & valid, otherwize `false`
+bool AssetPack::open(const std::string& path) {
+  close();
+  if (!mFile.open(path)) {
+    return false;
+  }
+  if (!attach(mFile.data(), mFile.size())) {
+    mFile.close();
+    return false;
+  }
+  return true;
+}
+
+/// @param[in] data ~ first byte of an archive already in memory
+/// @param[in] size ~ size (in bytes) of the archive
+/// @details   every entry is bounds-checked once here, so that `find(...)`
+///            never needs to validate the offsets it hands out
+/// @return    `true` if the archive is valid, otherwize `false`
+bool AssetPack::attach(const void* data, std::size_t size) {
+
+  mBase = nullptr;
+  mSize = 0;
+  mEntries = nullptr;
+  mCount = 0;
+  mStrings = nullptr;
+
+  if (!data || size < sizeof(Header)) {
+    return false;
+  }
+
+  const unsigned char* base = static_cast<const unsigned char*>(data);
+  Header header;
+  std::memcpy(&header, base, sizeof(Header));
+
+  if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION) {
+    return false;
+  }
+
+  std::uint64_t indexEnd = sizeof(Header) + static_cast<std::uint64_t>(header.count) * sizeof(Entry);
+  std::uint64_t stringsEnd = static_cast<std::uint64_t>(header.stringsOffset) + header.stringsSize;
+  if (indexEnd > size || header.stringsOffset < indexEnd || stringsEnd > size) {
+    return false;
+  }
+
+  const Entry* entries = reinterpret_cast<const Entry*>(base + sizeof(Header));
+  for (std::uint32_t i = 0; i < header.count; i++) {
+    const Entry& e = entries[i];
+    if (static_cast<std::uint64_t>(e.nameOffset) + e.nameLength > header.stringsSize) {
+      return false;
+    }
+    if (e.dataOffset > size || e.dataSize > size - e.dataOffset) {
+      return false;
+    }
+    if (e.format == FORMAT_BGRA32 && static_cast<std::uint64_t>(e.width) * e.height * 4 != e.dataSize) {
+      return false;
+    }
+  }
+
+  mBase = base;
+  mSize = size;
+  mEntries = entries;
+  mCount = header.count;
+  mStrings = reinterpret_cast<const char*>(base + header.stringsOffset);
+  return true;
+}
+
+/// @details releases the mapping (if any) & resets the reader
+void AssetPack::close() {
+  mFile.close();
+  mBase = nullptr;
+  mSize = 0;
+  mEntries = nullptr;
+  mCount = 0;
+  mStrings = nullptr;
+}
+
+/// @param[in]  name ~ name of the asset to look up (normalized internally)
+/// @param[out] asset ~ receives the pointer/size/format of the blob if found
+/// @details    binary search over the sorted index ~ `O(log n)`, no copies
+/// @return     `true` if the asset exists in the archive, otherwize `false`
+bool AssetPack::find(const std::string& name, Asset& asset) const {
+
+  if (!mBase) {
+    return false;
+  }
+
+  std::string key = normalize(name);
+
+  std::size_t lo = 0;
+  std::size_t hi = mCount;
+  while (lo < hi) {
+    std::size_t mid = lo + (hi - lo) / 2;
+    int c = compareName(mStrings, mEntries[mid], key);
+    if (c == 0) {
+      const Entry& e = mEntries[mid];
+      asset.data = mBase + e.dataOffset;
+      asset.size = static_cast<std::size_t>(e.dataSize);
+      asset.format = e.format;
+      asset.width = e.width;
+      asset.height = e.height;
+      return true;
+    }
+    if (c < 0) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  return false;
+}
+
+/// @param[in] i ~ index of the asset (sorted order)
+/// @return    copy of the asset name or an empty string if out of range
+std::string AssetPack::name(std::size_t i) const {
+  if (i >= mCount) {
+    return "";
+  }
+  return std::string(mStrings + mEntries[i].nameOffset, mEntries[i].nameLength);
+}
+
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+
+/// @param[in] pending ~ the asset to insert (replaces an existing asset of the same name)
+void AssetPackBuilder::store(Pending&& pending) {
+  for (Pending& p : mPending) {
+    if (p.name == pending.name) {
+      p = std::move(pending);
+      return;
+    }
+  }
+  mPending.push_back(std::move(pending));
+}
+
+/// @param[in] name ~ name of the asset inside the archive
+/// @param[in] path ~ file path of the loose file to read
+/// @param[in] decodeBitmaps ~ if `true`, uncompressed .bmp files are stored as BGRA pixels
+/// @return    `true` if the file was read, otherwize `false`
+bool AssetPackBuilder::addFile(const std::string& name, const std::string& path, bool decodeBitmaps) {
+
+  std::ifstream file(path, std::ios::binary);
+  if (!file.is_open()) {
+    return false;
+  }
+
+  std::vector<unsigned char> bytes(
+    (std::istreambuf_iterator<char>(file)),
+    std::istreambuf_iterator<char>()
+  );
+
+  if (decodeBitmaps) {
+    std::string::size_type dot = path.find_last_of('.');
+    std::string ext = (dot == std::string::npos) ? "" : path.substr(dot + 1);
+    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+    std::vector<unsigned char> pixels;
+    unsigned w = 0, h = 0;
+    if (ext == "bmp" && decodeBitmap(bytes, pixels, w, h)) {
+      Pending p;
+      p.name = AssetPack::normalize(name);
+      p.bytes = std::move(pixels);
+      p.format = AssetPack::FORMAT_BGRA32;
+      p.width = static_cast<std::uint16_t>(w);
+      p.height = static_cast<std::uint16_t>(h);
+      store(std::move(p));
+      return true;
+    }
+  }
+
+  Pending p;
+  p.name = AssetPack::normalize(name);
+  p.bytes = std::move(bytes);
+  p.format = AssetPack::FORMAT_RAW;
+  p.width = 0;
+  p.height = 0;
+  store(std::move(p));
+  return true;
+}
+
+/// @param[in] name ~ name of the asset inside the archive
+/// @param[in] data ~ first byte of the blob
+/// @param[in] size ~ size (in bytes) of the blob
+void AssetPackBuilder::addData(const std::string& name, const void* data, std::size_t size) {
+  const unsigned char* bytes = static_cast<const unsigned char*>(data);
+  Pending p;
+  p.name = AssetPack::normalize(name);
+  p.bytes.assign(bytes, bytes + size);
+  p.format = AssetPack::FORMAT_RAW;
+  p.width = 0;
+  p.height = 0;
+  store(std::move(p));
+}
+
+/// @param[in] name ~ name of the asset inside the archive
+/// @param[in] width ~ pixel width (at most 65535)
+/// @param[in] height ~ pixel height (at most 65535)
+/// @param[in] bgra ~ `width * height` top-down 32-bit BGRA pixels
+void AssetPackBuilder::addPixels(const std::string& name, unsigned width, unsigned height, const void* bgra) {
+  const unsigned char* bytes = static_cast<const unsigned char*>(bgra);
+  Pending p;
+  p.name = AssetPack::normalize(name);
+  p.bytes.assign(bytes, bytes + static_cast<std::size_t>(width) * height * 4);
+  p.format = AssetPack::FORMAT_BGRA32;
+  p.width = static_cast<std::uint16_t>(width);
+  p.height = static_cast<std::uint16_t>(height);
+  store(std::move(p));
+}
+
+/// @param[in]  file ~ contents of a .bmp file
+/// @param[out] pixels ~ receives `width * height` top-down BGRA pixels
+/// @param[out] width ~ receives the pixel width
+/// @param[out] height ~ receives the pixel height
+/// @details    only uncompressed (`BI_RGB`) 24 & 32-bit bitmaps are decoded,
+///             anything else is left to be stored as a raw blob <br/>
+///             32-bit bitmaps whose alpha channel is entirely 0 are treated as opaque
+/// @return     `true` if the bitmap was decoded, otherwize `false`
+bool AssetPackBuilder::decodeBitmap(
+  const std::vector<unsigned char>& file,
+  std::vector<unsigned char>& pixels,
+  unsigned& width, unsigned& height
+) {
+
+  // BITMAPFILEHEADER (14 bytes) + BITMAPINFOHEADER (at least 40 bytes)
+  if (file.size() < 54 || file[0] != 'B' || file[1] != 'M') {
+    return false;
+  }
+
+  auto u16 = [&file](std::size_t at) -> std::uint32_t {
+    return file[at] | (file[at + 1] << 8);
+  };
+  auto u32 = [&file](std::size_t at) -> std::uint32_t {
+    return file[at] | (file[at + 1] << 8) | (file[at + 2] << 16) | (static_cast<std::uint32_t>(file[at + 3]) << 24);
+  };
+
+  std::uint32_t offBits = u32(10);
+  std::uint32_t infoSize = u32(14);
+  std::int32_t w = static_cast<std::int32_t>(u32(18));
+  std::int32_t h = static_cast<std::int32_t>(u32(22));
+  std::uint32_t bitCount = u16(28);
+  std::uint32_t compression = u32(30);
+
+  if (infoSize < 40 || compression != 0 || (bitCount != 24 && bitCount != 32)) {
+    return false;
+  }
+
+  bool topDown = h < 0;
+  if (topDown) {
+    h = -h;
+  }
+  if (w <= 0 || h <= 0 || w > 0xFFFF || h > 0xFFFF) {
+    return false;
+  }
+
+  std::size_t bytesPerPixel = bitCount / 8;
+  std::size_t stride = ((static_cast<std::size_t>(w) * bitCount + 31) / 32) * 4;
+  if (offBits > file.size() || stride * h > file.size() - offBits) {
+    return false;
+  }
+
+  pixels.resize(static_cast<std::size_t>(w) * h * 4);
+  bool anyAlpha = false;
+
+  for (std::int32_t y = 0; y < h; y++) {
+    std::size_t srcRow = topDown ? y : (h - 1 - y);
+    const unsigned char* src = &file[offBits + srcRow * stride];
+    unsigned char* dst = &pixels[static_cast<std::size_t>(y) * w * 4];
+    for (std::int32_t x = 0; x < w; x++) {
+      dst[0] = src[0];
+      dst[1] = src[1];
+      dst[2] = src[2];
+      dst[3] = (bytesPerPixel == 4) ? src[3] : 0xFF;
+      anyAlpha = anyAlpha || (bytesPerPixel == 4 && src[3] != 0);
+      src += bytesPerPixel;
+      dst += 4;
+    }
+  }
+
+  // 32-bit bitmaps commonly leave the alpha channel unused (all 0) ...
+  if (bytesPerPixel == 4 && !anyAlpha) {
+    for (std::size_t i = 3; i < pixels.size(); i += 4) {
+      pixels[i] = 0xFF;
+    }
+  }
+
+  width = static_cast<unsigned>(w);
+  height = static_cast<unsigned>(h);
+  return true;
+}
+
+/// @param[in] path ~ file path of the `.xpak` archive to write
+/// @details   entries are sorted by name, the name strings are written after the index,
+///            followed by every blob on a `AssetPack::ALIGNMENT` boundary
+/// @return    `true` if the archive was written, otherwize `false`
+bool AssetPackBuilder::write(const std::string& path) const {
+
+  std::vector<const Pending*> sorted;
+  sorted.reserve(mPending.size());
+  for (const Pending& p : mPending) {
+    sorted.push_back(&p);
+  }
+  std::sort(sorted.begin(), sorted.end(), [](const Pending* a, const Pending* b) {
+    return a->name < b->name; // byte-wise, matches `AssetPack::find(...)`
+  });
+
+  AssetPack::Header header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, AssetPack::MAGIC, sizeof(header.magic));
+  header.version = AssetPack::VERSION;
+  header.count = static_cast<std::uint32_t>(sorted.size());
+  header.stringsOffset = static_cast<std::uint32_t>(sizeof(AssetPack::Header) + sorted.size() * sizeof(AssetPack::Entry));
+
+  std::string strings;
+  std::vector<AssetPack::Entry> entries(sorted.size());
+  for (std::size_t i = 0; i < sorted.size(); i++) {
+    std::memset(&entries[i], 0, sizeof(AssetPack::Entry));
+    entries[i].nameOffset = static_cast<std::uint32_t>(strings.size());
+    entries[i].nameLength = static_cast<std::uint32_t>(sorted[i]->name.size());
+    strings += sorted[i]->name;
+  }
+  header.stringsSize = static_cast<std::uint32_t>(strings.size());
+
+  std::uint64_t offset = alignUp(static_cast<std::uint64_t>(header.stringsOffset) + header.stringsSize);
+  for (std::size_t i = 0; i < sorted.size(); i++) {
+    entries[i].dataOffset = offset;
+    entries[i].dataSize = sorted[i]->bytes.size();
+    entries[i].format = sorted[i]->format;
+    entries[i].width = sorted[i]->width;
+    entries[i].height = sorted[i]->height;
+    offset = alignUp(offset + sorted[i]->bytes.size());
+  }
+
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file.is_open()) {
+    return false;
+  }
+
+  static const char zeros[AssetPack::ALIGNMENT] = { 0 };
+  std::uint64_t written = 0;
+  auto put = [&file, &written](const void* data, std::size_t size) {
+    file.write(static_cast<const char*>(data), size);
+    written += size;
+  };
+  auto pad = [&put, &written]() {
+    put(zeros, static_cast<std::size_t>(alignUp(written) - written));
+  };
+
+  put(&header, sizeof(header));
+  if (!entries.empty()) {
+    put(entries.data(), entries.size() * sizeof(AssetPack::Entry));
+  }
+  put(strings.data(), strings.size());
+  for (const Pending* p : sorted) {
+    pad();
+    if (!p->bytes.empty()) {
+      put(p->bytes.data(), p->bytes.size());
+    }
+  }
+
+  return file.good();
+}
+
+#ifdef PACK_TOOL
+
+// command line packer, built & run by `make pack`:
+//
+//     pack [--decode-bmp] <output.xpak> <file|directory> ...
+//
+// every regular file found (recursively) is stored under its path
+// as given on the command line, e.g. `src/png/a.png`
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include <iostream>
+#include <cstdlib>  // EXIT_SUCCESS, EXIT_FAILURE
+
+/// @brief helper to (recursively) add a file or directory to the builder
+static void packPath(AssetPackBuilder& builder, const std::string& path, bool decodeBitmaps) {
+
+  struct stat st;
+  if (stat(path.c_str(), &st) != 0) {
+    std::cerr << "pack: cannot access " << path << std::endl;
+    return;
+  }
+
+  if (S_ISDIR(st.st_mode)) {
+    DIR* dir = opendir(path.c_str());
+    if (!dir) {
+      std::cerr << "pack: cannot open " << path << std::endl;
+      return;
+    }
+    std::vector<std::string> children;
+    while (dirent* entry = readdir(dir)) {
+      if (entry->d_name[0] != '.') { // skip ".", ".." & hidden files
+        children.push_back(entry->d_name);
+      }
+    }
+    closedir(dir);
+    std::sort(children.begin(), children.end());
+    for (const std::string& child : children) {
+      packPath(builder, path + "/" + child, decodeBitmaps);
+    }
+    return;
+  }
+
+  if (!builder.addFile(path, path, decodeBitmaps)) {
+    std::cerr << "pack: cannot read " << path << std::endl;
+  }
+}
+
+int main(int argc, char* argv[]) {
+
+  bool decodeBitmaps = false;
+  int i = 1;
+  if (i < argc && std::string(argv[i]) == "--decode-bmp") {
+    decodeBitmaps = true;
+    i++;
+  }
+
+  if (argc - i < 2) {
+    std::cerr << "usage: pack [--decode-bmp] <output.xpak> <file|directory> ..." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::string output = argv[i++];
+
+  AssetPackBuilder builder;
+  for (; i < argc; i++) {
+    packPath(builder, argv[i], decodeBitmaps);
+  }
+
+  if (!builder.write(output)) {
+    std::cerr << "pack: cannot write " << output << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // validate what was just written ...
+  AssetPack pack;
+  if (!pack.open(output)) {
+    std::cerr << "pack: " << output << " failed validation" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "pack: " << pack.count() << " assets => " << output << std::endl;
+  return EXIT_SUCCESS;
+}
+
+#endif // PACK_TOOL
+
+#endif // end of ASSETPACK_CPP
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
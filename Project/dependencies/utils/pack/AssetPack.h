@@ -0,0 +1,195 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		AssetPack.h
+  * @brief 		Declaration of the AssetPack & AssetPackBuilder utility classes
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the on-disk layout of the `.xpak` asset archive,
+  *           the read-only (memory-mapped) `AssetPack` reader & the `AssetPackBuilder`
+  *           used by the `make pack` recipe to produce the archive
+  *
+  *           Layout (little-endian): <br/>
+  *
+  *               [Header][Entry 0 .. Entry n-1][name strings][pad][blob 0][pad][blob 1] ... <br/>
+  *
+  *           The entries are sorted by name (byte-wise), so that a lookup is a binary search.
+  *           Every blob starts on a 16-byte boundary, so that pre-decoded pixel data
+  *           can be handed to the graphics APIs as-is, straight from the mapped view.
+  */
+
+#pragma once
+
+/// @brief begin of ASSETPACK_H declaration
+#ifndef ASSETPACK_H
+#define ASSETPACK_H
+
+#include "../file/MappedFile.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @class   AssetPack
+ * @brief   read-only view of an `.xpak` asset archive
+ * @details `AssetPack` memory-maps the archive & resolves asset names
+ *          to (pointer, size) pairs pointing directly into the mapped view,
+ *          i.e. looking up an asset never copies its data <br/>
+ *          Pointers handed out remain valid until the pack is closed
+ */
+class AssetPack {
+
+public:
+
+  /// @brief magic bytes identifying an `.xpak` archive
+  static const char MAGIC[4];
+  /// @brief current version of the archive layout
+  static const std::uint16_t VERSION = 1;
+  /// @brief alignment (in bytes) of every blob in the archive
+  static const std::uint32_t ALIGNMENT = 16;
+
+  /// @brief storage format of an asset blob
+  enum Format : std::uint16_t {
+    /// @brief the blob holds the original file bytes (.png, .ico, .jpg, ...)
+    FORMAT_RAW = 0,
+    /// @brief the blob holds pre-decoded, top-down 32-bit BGRA pixels (straight alpha)
+    FORMAT_BGRA32 = 1
+  };
+
+  /// @brief archive header ~ always at offset 0
+  struct Header {
+    char          magic[4];       ///< "XPAK"
+    std::uint16_t version;        ///< layout version ~ `VERSION`
+    std::uint16_t flags;          ///< reserved ~ 0
+    std::uint32_t count;          ///< number of entries in the index
+    std::uint32_t stringsOffset;  ///< offset of the name strings block
+    std::uint32_t stringsSize;    ///< size (in bytes) of the name strings block
+    std::uint32_t reserved[3];    ///< reserved ~ 0
+  };
+
+  /// @brief index entry ~ `Header::count` entries follow the header
+  struct Entry {
+    std::uint32_t nameOffset;     ///< offset of the name, relative to the strings block
+    std::uint32_t nameLength;     ///< length of the name (in bytes, no terminator)
+    std::uint64_t dataOffset;     ///< absolute offset of the blob (16-byte aligned)
+    std::uint64_t dataSize;       ///< size of the blob (in bytes)
+    std::uint16_t format;         ///< `Format` of the blob
+    std::uint16_t width;          ///< pixel width (`FORMAT_BGRA32` only)
+    std::uint16_t height;         ///< pixel height (`FORMAT_BGRA32` only)
+    std::uint16_t reserved;       ///< reserved ~ 0
+  };
+
+  /// @brief result of a successful lookup ~ points into the mapped archive
+  struct Asset {
+    const unsigned char* data = nullptr; ///< first byte of the blob
+    std::size_t size = 0;                ///< size of the blob (in bytes)
+    unsigned format = FORMAT_RAW;        ///< `Format` of the blob
+    unsigned width = 0;                  ///< pixel width (`FORMAT_BGRA32` only)
+    unsigned height = 0;                 ///< pixel height (`FORMAT_BGRA32` only)
+  };
+
+public:
+
+  /// @brief default constructor ~ no archive opened
+  AssetPack() = default;
+
+  /// @brief deleted copy constructor ~ the mapping is an owned resource
+  AssetPack(const AssetPack&) = delete;
+  /// @brief deleted copy assignment operator ~ the mapping is an owned resource
+  AssetPack& operator = (const AssetPack&) = delete;
+
+  /// @brief method to memory-map & validate an archive on disk
+  bool open(const std::string& path);
+
+  /// @brief method to validate an archive that is already in memory (not owned)
+  bool attach(const void* data, std::size_t size);
+
+  /// @brief method to release the archive
+  void close();
+
+  /// @brief method to check whether an archive is opened
+  bool isOpen() const { return mBase != nullptr; }
+
+  /// @brief method to look up an asset by name
+  bool find(const std::string& name, Asset& asset) const;
+
+  /// @brief method to retrieve the number of assets in the archive
+  std::size_t count() const { return mCount; }
+
+  /// @brief method to retrieve the name of the i-th asset (sorted order)
+  std::string name(std::size_t i) const;
+
+  /// @brief method to normalize an asset name, i.e. forward slashes & no leading "./"
+  static std::string normalize(const std::string& name);
+
+private:
+
+  /// @brief the mapped archive (if opened from disk)
+  MappedFile mFile;
+
+  /// @brief first byte of the archive
+  const unsigned char* mBase = nullptr;
+  /// @brief size (in bytes) of the archive
+  std::size_t mSize = 0;
+  /// @brief first entry of the (sorted) index
+  const Entry* mEntries = nullptr;
+  /// @brief number of entries in the index
+  std::size_t mCount = 0;
+  /// @brief first byte of the name strings block
+  const char* mStrings = nullptr;
+};
+
+/**
+ * @class   AssetPackBuilder
+ * @brief   builds an `.xpak` archive from loose files
+ * @details Assets are collected in memory, then sorted by name
+ *          & written out with a single sequential pass <br/>
+ *          Adding an asset under an existing name replaces it
+ */
+class AssetPackBuilder {
+
+public:
+
+  /// @brief method to add the raw contents of a file
+  bool addFile(const std::string& name, const std::string& path, bool decodeBitmaps = false);
+
+  /// @brief method to add a raw blob
+  void addData(const std::string& name, const void* data, std::size_t size);
+
+  /// @brief method to add pre-decoded, top-down 32-bit BGRA pixels
+  void addPixels(const std::string& name, unsigned width, unsigned height, const void* bgra);
+
+  /// @brief method to retrieve the number of assets added so far
+  std::size_t count() const { return mPending.size(); }
+
+  /// @brief method to write the archive to disk
+  bool write(const std::string& path) const;
+
+  /// @brief   method to decode an uncompressed 24/32-bit .bmp file into top-down BGRA
+  static bool decodeBitmap(
+    const std::vector<unsigned char>& file,
+    std::vector<unsigned char>& pixels,
+    unsigned& width, unsigned& height
+  );
+
+private:
+
+  /// @brief an asset waiting to be written
+  struct Pending {
+    std::string name;
+    std::vector<unsigned char> bytes;
+    std::uint16_t format;
+    std::uint16_t width;
+    std::uint16_t height;
+  };
+
+  /// @brief assets added so far (insertion order)
+  std::vector<Pending> mPending;
+
+  /// @brief helper method to insert or replace an asset
+  void store(Pending&& pending);
+};
+
+#endif // end of ASSETPACK_H
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
@@ -0,0 +1,64 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		CaseMap.h
+  * @brief 		Declaration of CaseMap utility class
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the method signatures for the `CaseMap` class,
+  *           which converts UTF-8 & UTF-16 (UTF-32) text to upper/lower case
+  *           independently of the C locale
+  */
+
+#pragma once
+
+/// @brief begin of CASEMAP_H declaration
+#ifndef CASEMAP_H
+#define CASEMAP_H
+
+#include <cstddef> // std::size_t
+#include <cstdint>
+#include <string>
+
+/**
+ * @class   CaseMap
+ * @brief   locale-independent Unicode case conversion
+ * @details Simple (one-to-one) case mapping of the Unicode Character Database (14.0),
+ *          i.e. `ß` is kept as is rather than expanded to `SS`. <br/>
+ *          ASCII runs are converted 16 bytes (8 UTF-16 units) at a time with SSE2,
+ *          other codepoints through a table of ranges. <br/>
+ *          Conversion is in place: UTF-16 mappings never change the number of units,
+ *          the few UTF-8 mappings changing the number of bytes (i.e. `ı` -> `I`)
+ *          copying the rest of the text once. Malformed sequences are left untouched
+ */
+class CaseMap {
+
+public:
+
+  /// @brief method to retrieve the uppercase mapping of a codepoint
+  static std::uint32_t upper(std::uint32_t cp);
+
+  /// @brief method to retrieve the lowercase mapping of a codepoint
+  static std::uint32_t lower(std::uint32_t cp);
+
+  /// @brief method to convert UTF-8 text to uppercase
+  static void toUpper(std::string& s) { convert(s, true); }
+  /// @brief method to convert UTF-8 text to lowercase
+  static void toLower(std::string& s) { convert(s, false); }
+
+  /// @brief method to convert UTF-16 (UTF-32 where `wchar_t` is 32-bit) text to uppercase
+  static void toUpper(std::wstring& s) { if (!s.empty()) { convert(&s[0], s.size(), true); } }
+  /// @brief method to convert UTF-16 (UTF-32 where `wchar_t` is 32-bit) text to lowercase
+  static void toLower(std::wstring& s) { if (!s.empty()) { convert(&s[0], s.size(), false); } }
+
+  /// @brief method to convert a UTF-16 (UTF-32) buffer to upper/lower case in place
+  static void convert(wchar_t* s, std::size_t n, bool upper);
+
+private:
+
+  /// @brief helper method to convert UTF-8 text to upper/lower case
+  static void convert(std::string& s, bool upper);
+};
+
+#endif // end of CASEMAP_H
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
@@ -0,0 +1,117 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		StrArena.cpp
+  * @brief 		Implemenation of BasicStrArena utility class template
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the definition/implemenation
+  *           for the `BasicStrArena` class template's functionality,
+  *           explicitly instantiated for `char` & `wchar_t`
+  */
+
+/// @brief begin of STRARENA_CPP implementation
+#ifndef STRARENA_CPP
+#define STRARENA_CPP
+
+#include "./StrArena.h"
+
+#include <algorithm> // std::max
+
+namespace {
+
+  /// @brief minimum number of dead characters before compacting
+  const std::size_t COMPACT_MIN = 4096;
+}
+
+/// @param[in] strings ~ the strings, in order
+template <typename CharT>
+void BasicStrArena<CharT>::assign(const std::vector<string_type>& strings) {
+
+  std::size_t chars = 0;
+  for (const string_type& s : strings) {
+    chars += s.size();
+  }
+
+  clear();
+  reserve(strings.size(), chars);
+  for (const string_type& s : strings) {
+    push_back(s);
+  }
+}
+
+/// @param[in] count ~ number of strings to add
+/// @param[in] chars ~ number of characters of the strings to add (NUL excluded)
+/// @details   the storage grows geometrically, so that reserving batch after batch
+///            (i.e. pages of a streamed list) does not reallocate at every batch
+template <typename CharT>
+void BasicStrArena<CharT>::reserve(std::size_t count, std::size_t chars) {
+  const std::size_t spans = mSpans.size() + count;
+  if (spans > mSpans.capacity()) {
+    mSpans.reserve(std::max(spans, 2 * mSpans.capacity()));
+  }
+  const std::size_t total = mChars.size() + chars + count;
+  if (total > mChars.capacity()) {
+    mChars.reserve(std::max(total, 2 * mChars.capacity()));
+  }
+}
+
+template <typename CharT>
+void BasicStrArena<CharT>::clear() {
+  mChars.clear();
+  mSpans.clear();
+  mDead = 0;
+}
+
+/// @param[in] pos ~ position of the new string (`size()` to append)
+/// @param[in] s ~ the string
+template <typename CharT>
+void BasicStrArena<CharT>::insert(std::size_t pos, const string_type& s) {
+
+  if (pos > mSpans.size()) {
+    pos = mSpans.size();
+  }
+
+  // the characters go to the end of the arena, whatever the position ...
+  Span span;
+  span.offset = static_cast<std::uint32_t>(mChars.size());
+  span.length = static_cast<std::uint32_t>(s.size());
+  mChars.insert(mChars.end(), s.begin(), s.end());
+  mChars.push_back(CharT());
+
+  mSpans.insert(mSpans.begin() + pos, span);
+}
+
+/// @param[in] pos ~ position of the string
+template <typename CharT>
+void BasicStrArena<CharT>::erase(std::size_t pos) {
+
+  mDead += mSpans[pos].length + 1;
+  mSpans.erase(mSpans.begin() + pos);
+
+  if (mSpans.empty()) {
+    clear();
+  } else if (mDead >= COMPACT_MIN && mDead * 2 > mChars.size()) {
+    compact();
+  }
+}
+
+template <typename CharT>
+void BasicStrArena<CharT>::compact() {
+
+  std::vector<CharT> chars;
+  chars.reserve(mChars.size() - mDead);
+  for (Span& span : mSpans) {
+    const CharT* s = mChars.data() + span.offset;
+    span.offset = static_cast<std::uint32_t>(chars.size());
+    chars.insert(chars.end(), s, s + span.length + 1);
+  }
+  mChars.swap(chars);
+  mDead = 0;
+}
+
+template class BasicStrArena<char>;
+template class BasicStrArena<wchar_t>;
+
+#endif // end of STRARENA_CPP
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
@@ -0,0 +1,118 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		StrArena.h
+  * @brief 		Declaration of BasicStrArena utility class template
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the method signatures for the `BasicStrArena` class template,
+  *           an ordered list of strings stored back-to-back in a single buffer <br/>
+  *           Instantiated for `char` (`StrArena`) & `wchar_t` (`WStrArena`) in StrArena.cpp
+  */
+
+#pragma once
+
+/// @brief begin of STRARENA_H declaration
+#ifndef STRARENA_H
+#define STRARENA_H
+
+#include <cstddef> // std::size_t
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @class   BasicStrArena
+ * @brief   ordered list of strings in a single contiguous arena
+ * @details The characters of the strings are appended (NUL-terminated) to one buffer &
+ *          the list is a table of (offset, length) spans, i.e. 8 bytes per string & two
+ *          allocations for the whole list, instead of a string object (& its own allocation
+ *          past the small-string buffer) per string. <br/>
+ *          Inserting anywhere appends the characters & shifts the spans only; removing drops
+ *          the span, the characters being left as a tombstone until the dead characters
+ *          outweigh the live ones & the arena is compacted (in list order)
+ * @note    `c_str(...)` pointers are invalidated by any insert or remove
+ */
+template <typename CharT>
+class BasicStrArena {
+
+public:
+
+  /// @brief the string type of the items
+  typedef std::basic_string<CharT> string_type;
+
+public:
+
+  /// @brief default constructor ~ empty list
+  BasicStrArena() = default;
+
+  /// @brief method to replace the strings
+  void assign(const std::vector<string_type>& strings);
+
+  /// @brief method to reserve the storage of `count` more strings of `chars` more characters
+  ///        (in total), i.e. both on top of the strings already listed
+  void reserve(std::size_t count, std::size_t chars = 0);
+
+  /// @brief method to discard every string
+  void clear();
+
+  /// @brief method to retrieve the number of strings
+  std::size_t size() const { return mSpans.size(); }
+
+  /// @brief method to check whether the list is empty
+  bool empty() const { return mSpans.empty(); }
+
+  /// @brief method to retrieve the (NUL-terminated) characters of a string (`i < size()`)
+  const CharT* c_str(std::size_t i) const { return mChars.data() + mSpans[i].offset; }
+
+  /// @brief method to retrieve the length of a string (`i < size()`)
+  std::size_t length(std::size_t i) const { return mSpans[i].length; }
+
+  /// @brief method to retrieve a copy of a string (`i < size()`)
+  string_type str(std::size_t i) const { return string_type(c_str(i), length(i)); }
+
+  /// @brief method to insert a string at `pos` (`size()` to append)
+  void insert(std::size_t pos, const string_type& s);
+
+  /// @brief method to append a string
+  void push_back(const string_type& s) { insert(size(), s); }
+
+  /// @brief method to remove the string at a position (`pos < size()`)
+  void erase(std::size_t pos);
+
+  /// @brief method to rewrite the arena without its dead characters, in list order
+  void compact();
+
+  /// @brief method to retrieve the number of dead characters (removed strings)
+  std::size_t dead() const { return mDead; }
+
+  /// @brief method to retrieve the number of bytes allocated by the list
+  std::size_t bytes() const {
+    return mChars.capacity() * sizeof(CharT) + mSpans.capacity() * sizeof(Span);
+  }
+
+private:
+
+  /// @brief the position of a string in the arena
+  struct Span {
+    /// @brief offset of the first character
+    std::uint32_t offset;
+    /// @brief number of characters (NUL excluded)
+    std::uint32_t length;
+  };
+
+  /// @brief the characters of the strings, NUL-terminated
+  std::vector<CharT> mChars;
+  /// @brief the spans of the strings, in list order
+  std::vector<Span> mSpans;
+  /// @brief number of dead characters in `mChars` (NUL included)
+  std::size_t mDead = 0;
+};
+
+/// @brief arena of narrow (i.e. UTF-8) strings
+typedef BasicStrArena<char> StrArena;
+/// @brief arena of wide (i.e. UTF-16) strings
+typedef BasicStrArena<wchar_t> WStrArena;
+
+#endif // end of STRARENA_H
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
@@ -0,0 +1,278 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		StrTable.cpp
+  * @brief 		Implemenation of StrTable utility class
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the definition/implemenation
+  *           for the `StrTable` class' functionality
+  */
+
+/// @brief begin of STRTABLE_CPP implementation
+#ifndef STRTABLE_CPP
+#define STRTABLE_CPP
+
+#include "./StrTable.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <new> // std::bad_alloc
+
+/// @brief "XSTB"
+const char StrTable::MAGIC[4] = { 'X', 'S', 'T', 'B' };
+
+namespace {
+
+  /// @brief helper function to fold an ASCII letter to lower case
+  inline unsigned char fold(unsigned char c) {
+    return (c >= 'A' && c <= 'Z') ? static_cast<unsigned char>(c + ('a' - 'A')) : c;
+  }
+
+  /// @brief on-disk header of a saved table (native byte order)
+  struct FileHeader {
+    char          magic[4];   ///< "XSTB"
+    std::uint32_t version;    ///< `StrTable::VERSION`
+    std::uint64_t stamp;      ///< caller-defined validation stamp
+    std::uint32_t count;      ///< number of strings
+    std::uint32_t arenaSize;  ///< size (in bytes) of the arena that follows
+  };
+}
+
+/// @param[in] a ~ first string
+/// @param[in] na ~ length of `a`
+/// @param[in] b ~ second string
+/// @param[in] nb ~ length of `b`
+/// @return    negative, zero or positive, as `a` is ordered before, equal to or after `b`
+int StrTable::compareNoCase(const char* a, std::size_t na, const char* b, std::size_t nb) {
+  const std::size_t n = std::min(na, nb);
+  for (std::size_t i = 0; i < n; i++) {
+    const unsigned char ca = fold(static_cast<unsigned char>(a[i]));
+    const unsigned char cb = fold(static_cast<unsigned char>(b[i]));
+    if (ca != cb) {
+      return ca < cb ? -1 : 1;
+    }
+  }
+  return (na == nb) ? 0 : (na < nb ? -1 : 1);
+}
+
+/// @param[in] strings ~ strings to store, in any order
+void StrTable::assign(std::vector<std::string> strings) {
+
+  std::sort(strings.begin(), strings.end(), [](const std::string& a, const std::string& b) {
+    int c = compareNoCase(a.data(), a.size(), b.data(), b.size());
+    return c != 0 ? c < 0 : a < b;
+  });
+  strings.erase(std::unique(strings.begin(), strings.end()), strings.end());
+
+  std::size_t bytes = 0;
+  for (const std::string& s : strings) {
+    bytes += s.size() + 1;
+  }
+
+  clear();
+  mArena.reserve(bytes);
+  mOffsets.reserve(strings.size());
+  for (const std::string& s : strings) {
+    mOffsets.push_back(static_cast<std::uint32_t>(mArena.size()));
+    mArena.append(s.c_str(), s.size() + 1);
+  }
+}
+
+/// @details releases the arena & the index
+void StrTable::clear() {
+  mArena.clear();
+  mOffsets.clear();
+}
+
+/// @param[in] i ~ index of the string (sorted order)
+/// @return    length (in bytes) of the string, excluding its terminator
+std::size_t StrTable::length(std::size_t i) const {
+  const std::size_t end = (i + 1 < mOffsets.size()) ? mOffsets[i + 1] : mArena.size();
+  return end - mOffsets[i] - 1;
+}
+
+/// @param[in] s ~ first byte of the searched string
+/// @param[in] n ~ length of the searched string
+/// @param[in] first ~ first index searched
+/// @param[in] last ~ past the last index searched
+/// @return    index of the first string (in [`first`, `last`]) not ordered before `s` (ignoring case)
+std::size_t StrTable::lowerBoundNoCase(const char* s, std::size_t n, std::size_t first, std::size_t last) const {
+  std::size_t count = last - first;
+  while (count > 0) {
+    const std::size_t step = count / 2;
+    const std::size_t i = first + step;
+    if (compareNoCase(at(i), length(i), s, n) < 0) {
+      first = i + 1;
+      count -= step + 1;
+    } else {
+      count = step;
+    }
+  }
+  return first;
+}
+
+/// @param[in] s ~ string to find
+/// @return    index of `s` or `npos` if not found
+std::size_t StrTable::find(const std::string& s) const {
+  // strings equal ignoring case are adjacent, in byte-wise order ...
+  for (std::size_t i = lowerBoundNoCase(s.data(), s.size(), 0, size()); i < size(); i++) {
+    if (compareNoCase(at(i), length(i), s.data(), s.size()) != 0) {
+      break;
+    }
+    if (length(i) == s.size() && std::memcmp(at(i), s.data(), s.size()) == 0) {
+      return i;
+    }
+  }
+  return npos;
+}
+
+/// @param[in] s ~ string to find
+/// @return    index of the first string equal to `s` ignoring case, or `npos`
+std::size_t StrTable::findNoCase(const std::string& s) const {
+  const std::size_t i = lowerBoundNoCase(s.data(), s.size(), 0, size());
+  if (i < size() && compareNoCase(at(i), length(i), s.data(), s.size()) == 0) {
+    return i;
+  }
+  return npos;
+}
+
+/// @param[in] prefix ~ prefix to match (ignoring case)
+/// @return    range [first, last) of the matching strings, empty (first == last) if none
+std::pair<std::size_t, std::size_t> StrTable::prefixRange(const std::string& prefix) const {
+  return prefixRange(prefix, std::make_pair(static_cast<std::size_t>(0), size()));
+}
+
+/// @param[in] prefix ~ prefix to match (ignoring case)
+/// @param[in] within ~ range of the strings matching a shorter prefix of `prefix`
+/// @return    range [first, last) of the matching strings, empty (first == last) if none
+/// @details   i.e. narrowing the candidates of a type-ahead search as characters are typed,
+///            the binary searches covering the previous candidates only
+std::pair<std::size_t, std::size_t> StrTable::prefixRange(
+  const std::string& prefix, std::pair<std::size_t, std::size_t> within
+) const {
+
+  const std::size_t first = lowerBoundNoCase(prefix.data(), prefix.size(), within.first, within.second);
+
+  // the matches are contiguous ~ find the first string whose (truncated) head differs
+  std::size_t last = first;
+  std::size_t count = within.second - first;
+  while (count > 0) {
+    const std::size_t step = count / 2;
+    const std::size_t i = last + step;
+    const std::size_t head = std::min(length(i), prefix.size());
+    if (compareNoCase(at(i), head, prefix.data(), prefix.size()) == 0) {
+      last = i + 1;
+      count -= step + 1;
+    } else {
+      count = step;
+    }
+  }
+
+  return std::make_pair(first, last);
+}
+
+/// @param[in] path ~ file to (over)write
+/// @param[in] stamp ~ value that `load(...)` MUST be given to accept the file
+/// @return    `true` if the whole table was written
+bool StrTable::save(const std::string& path, std::uint64_t stamp) const {
+
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file) {
+    return false;
+  }
+
+  FileHeader header;
+  std::memset(&header, 0, sizeof(FileHeader));
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version = VERSION;
+  header.stamp = stamp;
+  header.count = static_cast<std::uint32_t>(mOffsets.size());
+  header.arenaSize = static_cast<std::uint32_t>(mArena.size());
+
+  file.write(reinterpret_cast<const char*>(&header), sizeof(FileHeader));
+  file.write(mArena.data(), static_cast<std::streamsize>(mArena.size()));
+  return static_cast<bool>(file);
+}
+
+/// @param[in] path ~ file written by `save(...)`
+/// @param[in] stamp ~ expected validation stamp
+/// @return    `true` if the file is valid & carries `stamp`, otherwize `false` (table unchanged)
+/// @details   the stamp only tells a stale file, so the sizes are checked against
+///            the file length (before allocating) & the order of the strings is verified,
+///            every lookup being a binary search
+bool StrTable::load(const std::string& path, std::uint64_t stamp) {
+
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  if (!file) {
+    return false;
+  }
+  const std::streamoff fileSize = file.tellg();
+  file.seekg(0);
+
+  FileHeader header;
+  if (fileSize < static_cast<std::streamoff>(sizeof(FileHeader))
+    || !file.read(reinterpret_cast<char*>(&header), sizeof(FileHeader))) {
+    return false;
+  }
+  if (
+       std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0
+    || header.version != VERSION
+    || header.stamp != stamp
+    || static_cast<std::streamoff>(header.arenaSize) != fileSize - static_cast<std::streamoff>(sizeof(FileHeader))
+    || header.count > header.arenaSize // every string holds a terminator at least
+  ) {
+    return false;
+  }
+
+  std::string arena;
+  std::vector<std::uint32_t> offsets;
+  try {
+    arena.assign(header.arenaSize, '\0');
+    offsets.reserve(header.count);
+  } catch (const std::bad_alloc&) {
+    return false;
+  }
+  if (header.arenaSize && !file.read(&arena[0], header.arenaSize)) {
+    return false;
+  }
+  if (!arena.empty() && arena.back() != '\0') {
+    return false;
+  }
+
+  // rebuild the index from the terminators, checking that
+  // every string is ordered (strictly) after the previous one ...
+  for (std::size_t i = 0; i < arena.size(); i = arena.find('\0', i) + 1) {
+    if (!offsets.empty()) {
+      const char* previous = arena.data() + offsets.back();
+      const std::size_t length = i - 1 - offsets.back();
+      const std::size_t n = arena.find('\0', i) - i;
+      int c = compareNoCase(previous, length, arena.data() + i, n);
+      if (c == 0) {
+        c = std::string::traits_type::compare(previous, arena.data() + i, std::min(length, n));
+        if (c == 0) {
+          c = (length < n) ? -1 : (length > n ? 1 : 0);
+        }
+      }
+      if (c >= 0) {
+        return false;
+      }
+    }
+    if (offsets.size() == header.count) {
+      return false;
+    }
+    offsets.push_back(static_cast<std::uint32_t>(i));
+  }
+  if (offsets.size() != header.count) {
+    return false;
+  }
+
+  mArena.swap(arena);
+  mOffsets.swap(offsets);
+  return true;
+}
+
+#endif // end of STRTABLE_CPP
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
@@ -0,0 +1,108 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		StrTable.h
+  * @brief 		Declaration of StrTable utility class
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the method signatures for the `StrTable` class,
+  *           an immutable, sorted set of strings stored in one contiguous arena
+  */
+
+#pragma once
+
+/// @brief begin of STRTABLE_H declaration
+#ifndef STRTABLE_H
+#define STRTABLE_H
+
+#include <cstddef> // std::size_t
+#include <cstdint>
+#include <string>
+#include <utility> // std::pair
+#include <vector>
+
+/**
+ * @class   StrTable
+ * @brief   sorted string set in a single contiguous arena
+ * @details The strings are stored back-to-back (NUL-terminated) in one buffer
+ *          & indexed by offset, i.e. two allocations for the whole set. <br/>
+ *          The order is case-insensitive (ASCII) first, then byte-wise, so that
+ *          exact, case-insensitive & prefix lookups are all binary searches <br/>
+ *          The table can be saved to & loaded from disk, stamped with a
+ *          caller-defined value used to detect stale files
+ */
+class StrTable {
+
+public:
+
+  /// @brief value returned by lookups that found nothing
+  static const std::size_t npos = static_cast<std::size_t>(-1);
+
+  /// @brief magic bytes identifying a saved table
+  static const char MAGIC[4];
+  /// @brief current version of the file layout
+  static const std::uint32_t VERSION = 1;
+
+public:
+
+  /// @brief default constructor ~ empty table
+  StrTable() = default;
+
+  /// @brief method to replace the contents with `strings` (sorted, duplicates removed)
+  void assign(std::vector<std::string> strings);
+
+  /// @brief method to empty the table
+  void clear();
+
+  /// @brief method to retrieve the number of strings
+  std::size_t size() const { return mOffsets.size(); }
+
+  /// @brief method to check whether the table holds no strings
+  bool empty() const { return mOffsets.empty(); }
+
+  /// @brief method to retrieve the i-th string (NUL-terminated, sorted order)
+  const char* at(std::size_t i) const { return mArena.data() + mOffsets[i]; }
+
+  /// @brief method to retrieve the length of the i-th string
+  std::size_t length(std::size_t i) const;
+
+  /// @brief method to retrieve a copy of the i-th string
+  std::string str(std::size_t i) const { return std::string(at(i), length(i)); }
+
+  /// @brief method to find a string (exact match)
+  std::size_t find(const std::string& s) const;
+
+  /// @brief method to find a string, ignoring (ASCII) case
+  std::size_t findNoCase(const std::string& s) const;
+
+  /// @brief method to retrieve the range [first, last) of strings starting with `prefix` (ignoring case)
+  std::pair<std::size_t, std::size_t> prefixRange(const std::string& prefix) const;
+
+  /// @brief method to narrow the range `within` (of a shorter prefix) to the strings starting with `prefix`
+  std::pair<std::size_t, std::size_t> prefixRange(
+    const std::string& prefix, std::pair<std::size_t, std::size_t> within
+  ) const;
+
+  /// @brief method to save the table to disk
+  bool save(const std::string& path, std::uint64_t stamp) const;
+
+  /// @brief method to load a table saved with the same `stamp`
+  bool load(const std::string& path, std::uint64_t stamp);
+
+  /// @brief method to compare two strings, ignoring (ASCII) case
+  static int compareNoCase(const char* a, std::size_t na, const char* b, std::size_t nb);
+
+private:
+
+  /// @brief the strings, back-to-back & NUL-terminated
+  std::string mArena;
+
+  /// @brief offset of every string in `mArena` (sorted order)
+  std::vector<std::uint32_t> mOffsets;
+
+  /// @brief helper method to find the first string not ordered (ignoring case) before `s`
+  std::size_t lowerBoundNoCase(const char* s, std::size_t n, std::size_t first, std::size_t last) const;
+};
+
+#endif // end of STRTABLE_H
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
@@ -0,0 +1,359 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		GlyphAtlas.cpp
+  * @brief 		Implemenation of the HeadlessGlyphRasterizer & GlyphAtlas utility classes
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the definition/implemenation
+  *           for the `HeadlessGlyphRasterizer` & `GlyphAtlas` classes' functionality
+  */
+
+/// @brief begin of GLYPHATLAS_CPP implementation
+#ifndef GLYPHATLAS_CPP
+#define GLYPHATLAS_CPP
+
+#include "./GlyphAtlas.h"
+#include "./Utf.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+/// @brief SSE2 is available (always the case on x86-64)
+#define GLYPHATLAS_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+  /// @brief helper function to divide by 255, rounded (for products of two 8-bit values)
+  inline int div255(int x) {
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+  }
+
+  #ifdef GLYPHATLAS_SSE2
+  /// @brief helper function to divide 8 x 16-bit lanes by 255, rounded
+  inline __m128i div255(__m128i x) {
+    x = _mm_add_epi16(x, _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+  }
+  #endif
+}
+
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/* HeadlessGlyphRasterizer   */
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+
+/// @param[in]  cp ~ codepoint
+/// @param[out] out ~ receives the glyph: a box outline (full coverage) with a lighter interior
+/// @return     `true` ~ every codepoint is rendered (white space & control characters without pixels)
+bool HeadlessGlyphRasterizer::rasterize(std::uint32_t cp, GlyphBitmap& out) {
+
+  out = GlyphBitmap();
+  mSource.advances(cp, 1, &out.advance);
+
+  if (cp <= ' ' || cp == 0x7F || cp == 0x3000 || out.advance <= 0) {
+    return true; // nothing to paint
+  }
+
+  const int capHeight = (700 * mSize + 500) / 1000;
+  const int xHeight = (500 * mSize + 500) / 1000;
+  const int descent = (200 * mSize + 500) / 1000;
+
+  const bool lower = cp >= 'a' && cp <= 'z';
+  const bool ascends = lower && std::strchr("bdfhklt", static_cast<char>(cp));
+  const bool descends = lower && std::strchr("gjpqy", static_cast<char>(cp));
+
+  out.left = out.advance > 2 ? 1 : 0;
+  out.width = std::max(1, out.advance - 2 * out.left);
+  out.top = std::max(1, (lower && !ascends) ? xHeight : capHeight);
+  out.height = out.top + (descends ? descent : 0);
+
+  out.coverage.assign(static_cast<std::size_t>(out.width) * out.height, 96);
+  for (int y = 0; y < out.height; y++) {
+    unsigned char* row = &out.coverage[static_cast<std::size_t>(y) * out.width];
+    if (y == 0 || y == out.height - 1) {
+      std::fill(row, row + out.width, 255);
+    } else {
+      row[0] = row[out.width - 1] = 255;
+    }
+  }
+  return true;
+}
+
+/*%*%*%*%*%*%*%*/
+/* GlyphAtlas    */
+/*%*%*%*%*%*%*%*/
+
+/// @param[in] rasterizer ~ renders the glyphs of the font
+GlyphAtlas::GlyphAtlas(std::unique_ptr<GlyphRasterizer> rasterizer)
+  : mRasterizer(std::move(rasterizer)) {
+  std::fill(mLow, mLow + 256, -1);
+}
+
+/// @param[in] cp ~ codepoint
+/// @return    the cached glyph (without pixels if it could not be rendered)
+const GlyphAtlas::Glyph& GlyphAtlas::glyph(std::uint32_t cp) {
+  if (cp < 256) {
+    if (mLow[cp] < 0) {
+      mLow[cp] = load(cp);
+    }
+    return mGlyphs[mLow[cp]];
+  }
+  auto it = mHigh.find(cp);
+  if (it == mHigh.end()) {
+    it = mHigh.emplace(cp, load(cp)).first;
+  }
+  return mGlyphs[it->second];
+}
+
+/// @param[in] cp ~ codepoint
+/// @return    index of the new glyph in `mGlyphs`
+int GlyphAtlas::load(std::uint32_t cp) {
+
+  Glyph g;
+  GlyphBitmap bitmap;
+  mRasterized++;
+
+  if (mRasterizer->rasterize(cp, bitmap)) {
+
+    g.left = bitmap.left;
+    g.top = bitmap.top;
+    g.advance = bitmap.advance;
+
+    const bool valid =
+         bitmap.width > 0 && bitmap.height > 0
+      && bitmap.coverage.size() >= static_cast<std::size_t>(bitmap.width) * bitmap.height;
+
+    if (valid && pack(bitmap.width, bitmap.height, g.page, g.x, g.y)) {
+      g.width = bitmap.width;
+      g.height = bitmap.height;
+      unsigned char* pixels = mPages[g.page].pixels.data();
+      for (int y = 0; y < g.height; y++) {
+        std::memcpy(
+          pixels + static_cast<std::size_t>(g.y + y) * PAGE_SIZE + g.x,
+          &bitmap.coverage[static_cast<std::size_t>(y) * bitmap.width],
+          static_cast<std::size_t>(g.width)
+        );
+      }
+    }
+  }
+
+  mGlyphs.push_back(g);
+  return static_cast<int>(mGlyphs.size() - 1);
+}
+
+/// @param[in]  w ~ width of the glyph
+/// @param[in]  h ~ height of the glyph
+/// @param[out] page ~ receives the page
+/// @param[out] x ~ receives the left column (padding excluded)
+/// @param[out] y ~ receives the top row (padding excluded)
+/// @return     `false` if the glyph is larger than a page
+bool GlyphAtlas::pack(int w, int h, int& page, int& x, int& y) {
+
+  w += 2 * PADDING;
+  h += 2 * PADDING;
+  if (w > PAGE_SIZE || h > PAGE_SIZE) {
+    return false;
+  }
+
+  for (std::size_t p = 0; p <= mPages.size(); p++) {
+
+    if (p == mPages.size()) {
+      mPages.push_back(Page());
+      mPages.back().pixels.assign(static_cast<std::size_t>(PAGE_SIZE) * PAGE_SIZE, 0);
+    }
+    std::vector<Shelf>& shelves = mPages[p].shelves;
+
+    // best fit ~ the existing shelf wasting the fewest rows ...
+    Shelf* pBest = nullptr;
+    for (Shelf& shelf : shelves) {
+      if (shelf.height >= h && shelf.x + w <= PAGE_SIZE && (!pBest || shelf.height < pBest->height)) {
+        pBest = &shelf;
+      }
+    }
+
+    // ... otherwize open a shelf below the last one
+    if (!pBest) {
+      const int bottom = shelves.empty() ? 0 : shelves.back().y + shelves.back().height;
+      if (bottom + h > PAGE_SIZE) {
+        continue; // page full
+      }
+      shelves.push_back(Shelf{ bottom, h, 0 });
+      pBest = &shelves.back();
+    }
+
+    page = static_cast<int>(p);
+    x = pBest->x + PADDING;
+    y = pBest->y + PADDING;
+    pBest->x += w;
+    return true;
+  }
+
+  return false; // unreachable
+}
+
+/// @param[in,out] dst ~ premultiplied BGRA pixels
+/// @param[in]     coverage ~ `count` coverage values
+/// @param[in]     count ~ number of pixels
+/// @param[in]     color ~ `0xAARRGGBB` (not premultiplied)
+void GlyphAtlas::blend(unsigned char* dst, const unsigned char* coverage, int count, std::uint32_t color) {
+
+  const int ca = static_cast<int>(color >> 24);
+  const int cr = static_cast<int>((color >> 16) & 0xFF);
+  const int cg = static_cast<int>((color >> 8) & 0xFF);
+  const int cb = static_cast<int>(color & 0xFF);
+  if (ca == 0) {
+    return;
+  }
+
+  int i = 0;
+
+  #ifdef GLYPHATLAS_SSE2
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i k255 = _mm_set1_epi16(255);
+  const __m128i alpha = _mm_set1_epi16(static_cast<short>(ca));
+  const __m128i rgba = _mm_set_epi16(255, cr, cg, cb, 255, cr, cg, cb);
+
+  // 4 pixels at a time ...
+  for (; i + 4 <= count; i += 4) {
+    std::uint32_t cov4;
+    std::memcpy(&cov4, coverage + i, 4);
+    if (cov4 == 0) {
+      continue; // most of a glyph box is empty
+    }
+
+    // source alpha of each pixel, replicated over its 4 channels
+    __m128i a = div255(_mm_mullo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(static_cast<int>(cov4)), zero), alpha));
+    a = _mm_unpacklo_epi16(a, a);
+    const __m128i aLo = _mm_unpacklo_epi32(a, a);
+    const __m128i aHi = _mm_unpackhi_epi32(a, a);
+
+    __m128i* pDst = reinterpret_cast<__m128i*>(dst + 4 * i);
+    const __m128i d = _mm_loadu_si128(pDst);
+    const __m128i dLo = _mm_unpacklo_epi8(d, zero);
+    const __m128i dHi = _mm_unpackhi_epi8(d, zero);
+
+    // src * a + dst * (1 - a)
+    const __m128i oLo = _mm_add_epi16(div255(_mm_mullo_epi16(rgba, aLo)), div255(_mm_mullo_epi16(dLo, _mm_sub_epi16(k255, aLo))));
+    const __m128i oHi = _mm_add_epi16(div255(_mm_mullo_epi16(rgba, aHi)), div255(_mm_mullo_epi16(dHi, _mm_sub_epi16(k255, aHi))));
+    _mm_storeu_si128(pDst, _mm_packus_epi16(oLo, oHi));
+  }
+  #endif
+
+  // remaining pixels (all of them without SSE2) ...
+  for (; i < count; i++) {
+    if (coverage[i] == 0) {
+      continue;
+    }
+    const int a = div255(coverage[i] * ca);
+    const int inv = 255 - a;
+    unsigned char* p = dst + 4 * i;
+    p[0] = static_cast<unsigned char>(std::min(255, div255(cb * a) + div255(p[0] * inv)));
+    p[1] = static_cast<unsigned char>(std::min(255, div255(cg * a) + div255(p[1] * inv)));
+    p[2] = static_cast<unsigned char>(std::min(255, div255(cr * a) + div255(p[2] * inv)));
+    p[3] = static_cast<unsigned char>(std::min(255, a + div255(p[3] * inv)));
+  }
+}
+
+/// @param[in,out] dst ~ target surface
+/// @param[in]     g ~ the glyph
+/// @param[in]     x ~ pen position
+/// @param[in]     baseline ~ row of the baseline
+/// @param[in]     color ~ `0xAARRGGBB` (not premultiplied)
+void GlyphAtlas::drawGlyph(Resampler::Surface& dst, const Glyph& g, int x, int baseline, std::uint32_t color) {
+
+  if (g.page < 0) {
+    return;
+  }
+
+  const int gx = x + g.left;
+  const int gy = baseline - g.top;
+
+  // clip to the surface ...
+  const int x0 = std::max(0, gx);
+  const int x1 = std::min(dst.width, gx + g.width);
+  const int y0 = std::max(0, gy);
+  const int y1 = std::min(dst.height, gy + g.height);
+  if (x0 >= x1 || y0 >= y1) {
+    return;
+  }
+
+  const unsigned char* pixels = mPages[g.page].pixels.data();
+  for (int y = y0; y < y1; y++) {
+    blend(
+      dst.data + static_cast<std::ptrdiff_t>(y) * dst.stride + 4 * x0,
+      pixels + static_cast<std::size_t>(g.y + y - gy) * PAGE_SIZE + g.x + (x0 - gx),
+      x1 - x0,
+      color
+    );
+  }
+}
+
+template <typename CharT>
+int GlyphAtlas::drawImpl(
+  Resampler::Surface& dst,
+  int x, int baseline,
+  const CharT* s, std::size_t n,
+  std::uint32_t color,
+  TextMetrics* metrics
+) {
+
+  const bool visible = dst.data && dst.width > 0 && dst.height > 0 && (color >> 24) != 0;
+
+  std::uint32_t prev = 0;
+  for (std::size_t i = 0; i < n; ) {
+
+    const std::uint32_t cp = Utf::next(s, n, i);
+    if (cp == '\r' || cp == '\n') {
+      prev = 0;
+      continue; // single line ~ see `TextMetrics::breakLines(...)`
+    }
+
+    const Glyph g = glyph(cp); // copy ~ `glyph(' ')` below may grow `mGlyphs`
+
+    int advance = g.advance;
+    if (metrics) {
+      x += prev ? metrics->kerning(prev, cp) : 0;
+      advance = (cp == '\t') ? TextMetrics::TAB_SIZE * metrics->advance(' ') : metrics->advance(cp);
+    } else if (cp == '\t') {
+      advance = TextMetrics::TAB_SIZE * glyph(' ').advance;
+    }
+
+    if (visible) {
+      drawGlyph(dst, g, x, baseline, color);
+    }
+
+    x += advance;
+    prev = cp;
+  }
+
+  return x;
+}
+
+/// @param[in,out] dst ~ premultiplied BGRA surface
+/// @param[in]     x ~ pen position of the first character
+/// @param[in]     baseline ~ row of the baseline
+/// @param[in]     text ~ UTF-8 text (line breaks are ignored)
+/// @param[in]     color ~ `0xAARRGGBB` (not premultiplied)
+/// @param[in]     metrics ~ advances & kerning to lay out with, `nullptr` for the glyph advances
+/// @return        pen position after the last character
+int GlyphAtlas::draw(Resampler::Surface& dst, int x, int baseline, const std::string& text, std::uint32_t color, TextMetrics* metrics) {
+  return drawImpl(dst, x, baseline, text.data(), text.size(), color, metrics);
+}
+
+/// @param[in,out] dst ~ premultiplied BGRA surface
+/// @param[in]     x ~ pen position of the first character
+/// @param[in]     baseline ~ row of the baseline
+/// @param[in]     text ~ UTF-16 (UTF-32) text (line breaks are ignored)
+/// @param[in]     color ~ `0xAARRGGBB` (not premultiplied)
+/// @param[in]     metrics ~ advances & kerning to lay out with, `nullptr` for the glyph advances
+/// @return        pen position after the last character
+int GlyphAtlas::draw(Resampler::Surface& dst, int x, int baseline, const std::wstring& text, std::uint32_t color, TextMetrics* metrics) {
+  return drawImpl(dst, x, baseline, text.data(), text.size(), color, metrics);
+}
+
+#endif // end of GLYPHATLAS_CPP
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
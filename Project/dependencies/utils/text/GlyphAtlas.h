@@ -0,0 +1,196 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		GlyphAtlas.h
+  * @brief 		Declaration of the GlyphRasterizer, HeadlessGlyphRasterizer & GlyphAtlas utility classes
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the method signatures for the `GlyphAtlas` class,
+  *           which rasterizes the glyphs of a font once, packs their coverage into
+  *           8-bit atlas pages & composites runs of text onto 32-bit premultiplied
+  *           surfaces (SIMD blending) <br/>
+  *           The glyphs are supplied by a `GlyphRasterizer`: GDI on Windows (see `xGlyphRasterizer`),
+  *           or the synthetic `HeadlessGlyphRasterizer` anywhere else (i.e. reference images)
+  */
+
+#pragma once
+
+/// @brief begin of GLYPHATLAS_H declaration
+#ifndef GLYPHATLAS_H
+#define GLYPHATLAS_H
+
+#include <cstddef> // std::size_t
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../img/Resampler.h" // Resampler::Surface
+#include "./TextMetrics.h"
+
+/// @brief coverage (alpha) mask of a single glyph
+struct GlyphBitmap {
+  int width = 0;    ///< width (in pixels) of the mask
+  int height = 0;   ///< height (in pixels) of the mask
+  int left = 0;     ///< offset from the pen position to the left column
+  int top = 0;      ///< offset from the baseline up to the top row
+  int advance = 0;  ///< distance the pen moves after the glyph
+  std::vector<unsigned char> coverage;  ///< `width * height` values (0 ~ 255), top row first
+};
+
+/**
+ * @class   GlyphRasterizer
+ * @brief   interface rendering the glyphs of a font (one size) into coverage masks
+ * @details Invoked at most once per codepoint by `GlyphAtlas`
+ */
+class GlyphRasterizer {
+
+public:
+
+  /// @brief virtual destructor
+  virtual ~GlyphRasterizer() = default;
+
+  /// @brief method to render a codepoint ~ `false` if the font cannot render it
+  virtual bool rasterize(std::uint32_t cp, GlyphBitmap& out) = 0;
+};
+
+/**
+ * @class   HeadlessGlyphRasterizer
+ * @brief   synthetic glyphs requiring no graphics API
+ * @details Each glyph is a box outline with a lighter interior, sized from the
+ *          advances of `HeadlessGlyphSource` (cap height, x-height & descenders),
+ *          i.e. deterministic output suitable for reference images on any platform
+ */
+class HeadlessGlyphRasterizer : public GlyphRasterizer {
+
+public:
+
+  /// @brief constructor ~ `size` is the em size (in pixels)
+  explicit HeadlessGlyphRasterizer(int size = 16) : mSize(size), mSource(size) {}
+
+  bool rasterize(std::uint32_t cp, GlyphBitmap& out) override;
+
+private:
+
+  /// @brief em size (in pixels)
+  int mSize;
+
+  /// @brief synthetic advances matching `HeadlessGlyphSource`
+  HeadlessGlyphSource mSource;
+};
+
+/**
+ * @class   GlyphAtlas
+ * @brief   cache of rasterized glyphs packed into 8-bit atlas pages
+ * @details Glyphs are rasterized the first time they are drawn & packed on shelves
+ *          (rows of similar height) of `PAGE_SIZE` square pages. Codepoints below 256
+ *          are looked up in a flat table, the others in a hash map. <br/>
+ *          `draw(...)` composites a run of text in a solid color onto a premultiplied
+ *          BGRA surface, clipped to the surface
+ * @note    not thread-safe ~ meant to be used from the UI thread
+ */
+class GlyphAtlas {
+
+public:
+
+  /// @brief width & height (in pixels) of an atlas page
+  static const int PAGE_SIZE = 512;
+  /// @brief empty pixels kept around every glyph
+  static const int PADDING = 1;
+
+  /// @brief a cached glyph
+  struct Glyph {
+    int page = -1;    ///< atlas page, `-1` for glyphs without pixels (i.e. white space)
+    int x = 0;        ///< left column in the page
+    int y = 0;        ///< top row in the page
+    int width = 0;    ///< width (in pixels)
+    int height = 0;   ///< height (in pixels)
+    int left = 0;     ///< offset from the pen position to the left column
+    int top = 0;      ///< offset from the baseline up to the top row
+    int advance = 0;  ///< distance the pen moves after the glyph
+  };
+
+public:
+
+  /// @brief constructor ~ takes ownership of the rasterizer
+  explicit GlyphAtlas(std::unique_ptr<GlyphRasterizer> rasterizer);
+
+  /// @brief deleted copy constructor ~ owns its rasterizer & pages
+  GlyphAtlas(const GlyphAtlas&) = delete;
+  /// @brief deleted copy assignment operator ~ owns its rasterizer & pages
+  GlyphAtlas& operator = (const GlyphAtlas&) = delete;
+
+  /// @brief method to retrieve a glyph, rasterizing it on first use ~ valid until the next cache miss
+  const Glyph& glyph(std::uint32_t cp);
+
+  /// @brief   method to draw a line of UTF-8 text
+  /// @details `metrics` (optional) supplies the advances & kerning, so that the text
+  ///          lands where it was measured, otherwize the glyph advances are used
+  int draw(Resampler::Surface& dst, int x, int baseline, const std::string& text, std::uint32_t color, TextMetrics* metrics = nullptr);
+  /// @brief   method to draw a line of UTF-16 (UTF-32) text
+  int draw(Resampler::Surface& dst, int x, int baseline, const std::wstring& text, std::uint32_t color, TextMetrics* metrics = nullptr);
+
+  /// @brief method to retrieve the number of atlas pages
+  std::size_t pageCount() const { return mPages.size(); }
+
+  /// @brief method to retrieve the coverage of an atlas page (`PAGE_SIZE` rows of `PAGE_SIZE` bytes)
+  const unsigned char* page(std::size_t i) const { return mPages[i].pixels.data(); }
+
+  /// @brief method to retrieve the number of cached glyphs
+  std::size_t glyphCount() const { return mGlyphs.size(); }
+
+  /// @brief method to retrieve the number of glyphs rasterized (i.e. cache misses)
+  std::size_t rasterized() const { return mRasterized; }
+
+  /// @brief   method to blend a row of coverage onto premultiplied BGRA pixels
+  /// @details `color` is non-premultiplied `0xAARRGGBB`, scaled by the coverage of each pixel
+  static void blend(unsigned char* dst, const unsigned char* coverage, int count, std::uint32_t color);
+
+private:
+
+  /// @brief a row of glyphs of (at most) the same height
+  struct Shelf {
+    int y;       ///< top row
+    int height;  ///< height of the tallest glyph
+    int x;       ///< first free column
+  };
+
+  /// @brief an atlas page
+  struct Page {
+    std::vector<unsigned char> pixels;  ///< `PAGE_SIZE * PAGE_SIZE` coverage values
+    std::vector<Shelf> shelves;         ///< shelves, top to bottom
+  };
+
+  /// @brief the glyph renderer
+  std::unique_ptr<GlyphRasterizer> mRasterizer;
+
+  /// @brief the atlas pages
+  std::vector<Page> mPages;
+
+  /// @brief cached glyphs
+  std::vector<Glyph> mGlyphs;
+  /// @brief index (in `mGlyphs`) of the codepoints below 256, `-1` until cached
+  int mLow[256];
+  /// @brief index (in `mGlyphs`) of the codepoints from 256
+  std::unordered_map<std::uint32_t, int> mHigh;
+
+  /// @brief number of glyphs rasterized
+  std::size_t mRasterized = 0;
+
+  /// @brief helper method to rasterize & pack a glyph
+  int load(std::uint32_t cp);
+
+  /// @brief helper method to reserve a `w` x `h` area in the pages
+  bool pack(int w, int h, int& page, int& x, int& y);
+
+  /// @brief helper method to composite one glyph
+  void drawGlyph(Resampler::Surface& dst, const Glyph& g, int x, int baseline, std::uint32_t color);
+
+  /// @brief shared implementation of `draw(...)`
+  template <typename CharT>
+  int drawImpl(Resampler::Surface& dst, int x, int baseline, const CharT* s, std::size_t n, std::uint32_t color, TextMetrics* metrics);
+};
+
+#endif // end of GLYPHATLAS_H
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
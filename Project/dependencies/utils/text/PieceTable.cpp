@@ -0,0 +1,437 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		PieceTable.cpp
+  * @brief 		Implemenation of BasicPieceTable utility class template
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the definition/implemenation
+  *           for the `BasicPieceTable` class template's functionality,
+  *           explicitly instantiated for `char` & `wchar_t`
+  */
+
+/// @brief begin of PIECETABLE_CPP implementation
+#ifndef PIECETABLE_CPP
+#define PIECETABLE_CPP
+
+#include "./PieceTable.h"
+
+#include <algorithm>
+
+/// @param[in] text ~ the new text
+template <typename CharT>
+void BasicPieceTable<CharT>::assign(string_type text) {
+
+  mSize = text.size();
+  mOriginal = std::make_shared<const string_type>(std::move(text));
+  mAdded = std::make_shared<string_type>();
+  mPieces = std::make_shared<std::vector<Piece>>();
+  if (mSize) {
+    mPieces->push_back(Piece{ false, 0, mSize });
+  }
+  mHintPiece = mHintStart = 0;
+
+  mLines.assign(1, 0);
+  mShiftFrom = mShiftBy = 0;
+  const CharT* s = mOriginal->data();
+  for (std::size_t i = 0; i < mSize; i++) {
+    if (s[i] == CharT('\n')) {
+      mLines.push_back(i + 1);
+    }
+  }
+}
+
+/// @return the piece sequence, copied first if a snapshot holds it
+template <typename CharT>
+std::vector<typename BasicPieceTable<CharT>::Piece>& BasicPieceTable<CharT>::pieces() {
+  if (mPieces.use_count() > 1) {
+    mPieces = std::make_shared<std::vector<Piece>>(*mPieces);
+  }
+  return *mPieces;
+}
+
+/// @param[in]  pos ~ offset of a character (`size()` for the end of the text)
+/// @param[out] start ~ receives the offset of the first character of the piece
+/// @return     index of the piece holding `pos`, `pieceCount()` at the end of the text
+template <typename CharT>
+std::size_t BasicPieceTable<CharT>::locate(std::size_t pos, std::size_t& start) const {
+
+  const std::vector<Piece>& seq = *mPieces;
+
+  std::size_t i = std::min(mHintPiece, seq.size());
+  std::size_t at = (i == mHintPiece) ? mHintStart : mSize;
+
+  // walk back, then forward, from the last located piece ...
+  while (i > 0 && pos < at) {
+    at -= seq[--i].length;
+  }
+  while (i < seq.size() && pos >= at + seq[i].length) {
+    at += seq[i++].length;
+  }
+
+  mHintPiece = i;
+  mHintStart = at;
+  start = at;
+  return i;
+}
+
+/// @param[in] pos ~ offset of the insertion (clamped to `size()`)
+/// @param[in] s ~ characters to insert
+/// @param[in] n ~ number of characters
+template <typename CharT>
+void BasicPieceTable<CharT>::insert(std::size_t pos, const CharT* s, std::size_t n) {
+
+  if (n == 0) {
+    return;
+  }
+  pos = std::min(pos, mSize);
+
+  std::vector<Piece>& seq = pieces();
+  const std::size_t addStart = mAdded->size();
+  mAdded->append(s, n);
+
+  std::size_t start;
+  std::size_t i = locate(pos, start);
+  const std::size_t offset = pos - start;
+
+  if (offset == 0 && i > 0 && seq[i - 1].added && seq[i - 1].start + seq[i - 1].length == addStart) {
+    // typing on ~ extend the previous piece
+    seq[i - 1].length += n;
+    mHintPiece = i - 1;
+    mHintStart = start - (seq[i - 1].length - n);
+  } else if (offset == 0) {
+    seq.insert(seq.begin() + i, Piece{ true, addStart, n });
+  } else {
+    // split the piece around the insertion
+    Piece right = seq[i];
+    right.start += offset;
+    right.length -= offset;
+    seq[i].length = offset;
+    Piece added = { true, addStart, n };
+    seq.insert(seq.begin() + i + 1, { added, right });
+    mHintPiece = i + 1;
+    mHintStart = pos;
+  }
+  mSize += n;
+
+  // line starts ...
+  const std::size_t next = upperLine(pos);
+  std::vector<std::size_t> starts;
+  for (std::size_t k = 0; k < n; k++) {
+    if (s[k] == CharT('\n')) {
+      starts.push_back(pos + k + 1);
+    }
+  }
+  if (starts.empty()) {
+    shiftLines(next, n);
+  } else {
+    flushLines();
+    for (std::size_t k = next; k < mLines.size(); k++) {
+      mLines[k] += n;
+    }
+    mLines.insert(mLines.begin() + next, starts.begin(), starts.end());
+  }
+}
+
+/// @param[in] pos ~ offset of the first erased character
+/// @param[in] n ~ number of characters (clamped to the end of the text)
+template <typename CharT>
+void BasicPieceTable<CharT>::erase(std::size_t pos, std::size_t n) {
+
+  if (pos >= mSize) {
+    return;
+  }
+  n = std::min(n, mSize - pos);
+  if (n == 0) {
+    return;
+  }
+
+  std::vector<Piece>& seq = pieces();
+
+  std::size_t start;
+  std::size_t i = locate(pos, start);
+  const std::size_t offset = pos - start;
+
+  if (offset > 0) {
+    // split off the part kept before the erased range
+    Piece right = seq[i];
+    right.start += offset;
+    right.length -= offset;
+    seq[i].length = offset;
+    seq.insert(seq.begin() + i + 1, right);
+    i++;
+  }
+
+  // remove the pieces covered entirely, trim the last one
+  std::size_t remaining = n;
+  std::size_t last = i;
+  while (last < seq.size() && remaining >= seq[last].length) {
+    remaining -= seq[last++].length;
+  }
+  seq.erase(seq.begin() + i, seq.begin() + last);
+  if (remaining > 0) {
+    seq[i].start += remaining;
+    seq[i].length -= remaining;
+  }
+  mSize -= n;
+
+  mHintPiece = i;
+  mHintStart = pos;
+
+  // line starts ...
+  const std::size_t first = upperLine(pos);
+  const std::size_t end = upperLine(pos + n);
+  if (end == first) {
+    shiftLines(first, static_cast<std::size_t>(0) - n);
+  } else {
+    flushLines();
+    mLines.erase(mLines.begin() + first, mLines.begin() + end);
+    for (std::size_t k = first; k < mLines.size(); k++) {
+      mLines[k] -= n;
+    }
+  }
+}
+
+/// @param[in] offsets ~ offsets of the replaced ranges, ascending & not overlapping
+/// @param[in] n ~ number of characters of each range
+/// @param[in] s ~ replacement characters
+/// @param[in] count ~ number of replacement characters
+/// @details   O(pieces + lines + ranges) ~ a single pass builds the new piece sequence
+///            (every range referring to the same replacement characters in the add buffer)
+///            & the new line starts, rather than editing (& locating) once per range
+template <typename CharT>
+void BasicPieceTable<CharT>::replaceAll(const std::vector<std::size_t>& offsets, std::size_t n, const CharT* s, std::size_t count) {
+
+  if (offsets.empty() || n == 0) {
+    return;
+  }
+  flushLines();
+
+  const std::size_t addStart = mAdded->size();
+  mAdded->append(s, count);
+
+  // pieces ...
+  std::vector<Piece> out;
+  out.reserve(mPieces->size() + 2 * offsets.size());
+  std::size_t pos = 0;  // offset of `piece` in the text
+  std::size_t skip = 0; // characters of the current range left to skip
+  std::size_t k = 0;
+  for (Piece piece : *mPieces) {
+    while (piece.length > 0) {
+      if (skip > 0) {
+        const std::size_t d = std::min(skip, piece.length);
+        piece.start += d;
+        piece.length -= d;
+        pos += d;
+        skip -= d;
+      } else if (k < offsets.size() && offsets[k] < pos + piece.length) {
+        const std::size_t d = offsets[k] - pos;
+        if (d > 0) {
+          out.push_back(Piece{ piece.added, piece.start, d });
+          piece.start += d;
+          piece.length -= d;
+          pos += d;
+        }
+        if (count > 0) {
+          out.push_back(Piece{ true, addStart, count });
+        }
+        skip = n;
+        k++;
+      } else {
+        out.push_back(piece);
+        pos += piece.length;
+        piece.length = 0;
+      }
+    }
+  }
+
+  // line starts ...
+  std::vector<std::size_t> breaks;
+  for (std::size_t i = 0; i < count; i++) {
+    if (s[i] == CharT('\n')) {
+      breaks.push_back(i + 1);
+    }
+  }
+  std::vector<std::size_t> lines;
+  lines.reserve(mLines.size() + breaks.size() * offsets.size());
+  lines.push_back(0);
+  std::size_t delta = 0; // modulo `size_t`, i.e. negative shifts wrap around
+  std::size_t line = 1;
+  for (std::size_t offset : offsets) {
+    while (line < mLines.size() && mLines[line] <= offset) {
+      lines.push_back(mLines[line++] + delta);
+    }
+    while (line < mLines.size() && mLines[line] <= offset + n) {
+      line++; // line break replaced
+    }
+    for (std::size_t b : breaks) {
+      lines.push_back(offset + delta + b);
+    }
+    delta += count - n;
+  }
+  while (line < mLines.size()) {
+    lines.push_back(mLines[line++] + delta);
+  }
+
+  mPieces = std::make_shared<std::vector<Piece>>(std::move(out));
+  mLines.swap(lines);
+  mSize += offsets.size() * count - offsets.size() * n;
+  mHintPiece = mHintStart = 0;
+}
+
+/// @param[in] pieces ~ piece sequence
+/// @param[in] original ~ original buffer
+/// @param[in] added ~ add buffer
+/// @param[in] pos ~ offset of the first copied character
+/// @param[in] n ~ number of characters
+/// @param[out] out ~ receives the characters (appended)
+template <typename CharT>
+void BasicPieceTable<CharT>::copy(
+  const std::vector<Piece>& pieces,
+  const string_type& original, const string_type& added,
+  std::size_t pos, std::size_t n,
+  string_type& out
+) {
+  std::size_t at = 0;
+  for (const Piece& piece : pieces) {
+    if (n == 0) {
+      break;
+    }
+    if (pos < at + piece.length) {
+      const std::size_t offset = pos - at;
+      const std::size_t count = std::min(n, piece.length - offset);
+      const string_type& buffer = piece.added ? added : original;
+      out.append(buffer.data() + piece.start + offset, count);
+      pos += count;
+      n -= count;
+    }
+    at += piece.length;
+  }
+}
+
+/// @param[in] pos ~ offset of the first character
+/// @param[in] n ~ number of characters (clamped to the end of the text)
+/// @return    the characters
+template <typename CharT>
+typename BasicPieceTable<CharT>::string_type BasicPieceTable<CharT>::substr(std::size_t pos, std::size_t n) const {
+
+  string_type out;
+  if (pos >= mSize) {
+    return out;
+  }
+  n = std::min(n, mSize - pos);
+  out.reserve(n);
+
+  // start from the located piece rather than the first one
+  std::size_t start;
+  std::size_t i = locate(pos, start);
+  const std::vector<Piece>& seq = *mPieces;
+  for (; i < seq.size() && n > 0; i++) {
+    const std::size_t offset = pos - start;
+    const std::size_t count = std::min(n, seq[i].length - offset);
+    out.append(data(seq[i]) + offset, count);
+    pos += count;
+    n -= count;
+    start += seq[i].length;
+  }
+  return out;
+}
+
+/// @param[in] pos ~ offset of the character, MUST be less than `size()`
+template <typename CharT>
+CharT BasicPieceTable<CharT>::at(std::size_t pos) const {
+  std::size_t start;
+  const std::size_t i = locate(pos, start);
+  return data((*mPieces)[i])[pos - start];
+}
+
+/// @return a view of the text, valid whatever edits follow
+template <typename CharT>
+typename BasicPieceTable<CharT>::Snapshot BasicPieceTable<CharT>::snapshot() const {
+  Snapshot snap;
+  snap.mPieces = mPieces;
+  snap.mOriginal = mOriginal;
+  snap.mAdded = mAdded;
+  snap.mSize = mSize;
+  return snap;
+}
+
+/// @param[in] pos ~ offset of the first character
+/// @param[in] n ~ number of characters (clamped to the end of the text)
+/// @return    the characters
+template <typename CharT>
+typename BasicPieceTable<CharT>::string_type BasicPieceTable<CharT>::Snapshot::substr(std::size_t pos, std::size_t n) const {
+  string_type out;
+  if (pos >= mSize) {
+    return out;
+  }
+  n = std::min(n, mSize - pos);
+  out.reserve(n);
+  copy(*mPieces, *mOriginal, *mAdded, pos, n, out);
+  return out;
+}
+
+/// @param[in] i ~ index of the line
+/// @return    the characters of the line, without its line break
+template <typename CharT>
+typename BasicPieceTable<CharT>::string_type BasicPieceTable<CharT>::line(std::size_t i) const {
+  const std::size_t first = lineStart(i);
+  std::size_t last = (i + 1 < mLines.size()) ? lineStart(i + 1) : mSize;
+  if (last > first && at(last - 1) == CharT('\n')) {
+    last--;
+  }
+  if (last > first && at(last - 1) == CharT('\r')) {
+    last--;
+  }
+  return substr(first, last - first);
+}
+
+/// @param[in] pos ~ offset of a character
+/// @return    index of the first line starting after `pos` (`lineCount()` if none)
+template <typename CharT>
+std::size_t BasicPieceTable<CharT>::upperLine(std::size_t pos) const {
+  std::size_t first = 0;
+  std::size_t count = mLines.size();
+  while (count > 0) {
+    const std::size_t step = count / 2;
+    const std::size_t i = first + step;
+    if (lineStart(i) <= pos) {
+      first = i + 1;
+      count -= step + 1;
+    } else {
+      count = step;
+    }
+  }
+  return first;
+}
+
+/// @param[in] from ~ first shifted line
+/// @param[in] by ~ shift (modulo `size_t`, i.e. negative shifts wrap around)
+template <typename CharT>
+void BasicPieceTable<CharT>::shiftLines(std::size_t from, std::size_t by) {
+  if (from >= mLines.size()) {
+    return;
+  }
+  if (mShiftBy != 0 && mShiftFrom != from) {
+    flushLines();
+  }
+  mShiftFrom = from;
+  mShiftBy += by;
+}
+
+/// @details O(lines) ~ only when editing another line than the previous edit
+template <typename CharT>
+void BasicPieceTable<CharT>::flushLines() {
+  if (mShiftBy != 0) {
+    for (std::size_t k = mShiftFrom; k < mLines.size(); k++) {
+      mLines[k] += mShiftBy;
+    }
+    mShiftBy = 0;
+  }
+}
+
+template class BasicPieceTable<char>;
+template class BasicPieceTable<wchar_t>;
+
+#endif // end of PIECETABLE_CPP
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
@@ -0,0 +1,214 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		PieceTable.h
+  * @brief 		Declaration of BasicPieceTable utility class template
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the method signatures for the `BasicPieceTable` class template,
+  *           a text buffer applying edits in place of copying the whole text, with cheap
+  *           snapshots & an index of line starts <br/>
+  *           Instantiated for `char` (`PieceTable`) & `wchar_t` (`WPieceTable`) in PieceTable.cpp
+  */
+
+#pragma once
+
+/// @brief begin of PIECETABLE_H declaration
+#ifndef PIECETABLE_H
+#define PIECETABLE_H
+
+#include <cstddef> // std::size_t
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @class   BasicPieceTable
+ * @brief   piece-table text buffer
+ * @details The text is a sequence of pieces, each a range of either the original text
+ *          (never modified) or the add buffer (append only). An edit splits at most one
+ *          piece & appends to the add buffer, whatever the size of the text; typing at
+ *          the same place extends the last piece rather than adding one. <br/>
+ *          Pieces are located from the last edited piece, so that edits close to each
+ *          other do not scan the whole sequence. <br/>
+ *          The start of every line (offset following a `\n`) is maintained as edits are
+ *          applied: edits without line breaks only defer a shift of the following lines
+ *          (applied once an edit happens on another line)
+ * @note    not thread-safe, a `Snapshot` included (it shares the buffers of the table)
+ */
+template <typename CharT>
+class BasicPieceTable {
+
+public:
+
+  /// @brief the string type of the text
+  typedef std::basic_string<CharT> string_type;
+
+  /// @brief a range of one of the buffers
+  struct Piece {
+    bool added;          ///< `true` for the add buffer, `false` for the original text
+    std::size_t start;   ///< offset in the buffer
+    std::size_t length;  ///< number of characters
+  };
+
+  /**
+   * @class   Snapshot
+   * @brief   immutable view of the text at the time it was taken
+   * @details Taking a snapshot copies no text (nor pieces): the piece sequence is
+   *          copied by the table on its next edit, only if a snapshot still holds it
+   */
+  class Snapshot {
+
+  public:
+
+    /// @brief default constructor ~ empty text
+    Snapshot() = default;
+
+    /// @brief method to retrieve the number of characters
+    std::size_t size() const { return mSize; }
+
+    /// @brief method to check whether the text is empty
+    bool empty() const { return mSize == 0; }
+
+    /// @brief method to retrieve a copy of the whole text
+    string_type str() const { return substr(0, mSize); }
+
+    /// @brief method to retrieve a copy of (part of) the text
+    string_type substr(std::size_t pos, std::size_t n) const;
+
+  private:
+
+    friend class BasicPieceTable;
+
+    std::shared_ptr<const std::vector<Piece>> mPieces;
+    std::shared_ptr<const string_type> mOriginal;
+    std::shared_ptr<const string_type> mAdded;
+    std::size_t mSize = 0;
+  };
+
+public:
+
+  /// @brief default constructor ~ empty text
+  BasicPieceTable() { assign(string_type()); }
+
+  /// @brief constructor ~ `text` becomes the original buffer
+  explicit BasicPieceTable(string_type text) { assign(std::move(text)); }
+
+  /// @brief method to replace the whole text (discards the edit history)
+  void assign(string_type text);
+
+  /// @brief method to insert `n` characters at `pos`
+  void insert(std::size_t pos, const CharT* s, std::size_t n);
+  /// @brief method to insert a string at `pos`
+  void insert(std::size_t pos, const string_type& s) { insert(pos, s.data(), s.size()); }
+
+  /// @brief method to erase `n` characters from `pos`
+  void erase(std::size_t pos, std::size_t n);
+
+  /// @brief method to replace `n` characters from `pos` with `count` characters
+  void replace(std::size_t pos, std::size_t n, const CharT* s, std::size_t count) {
+    erase(pos, n);
+    insert(pos, s, count);
+  }
+
+  /// @brief method to replace `n` characters at each of `offsets` with `count` characters
+  void replaceAll(const std::vector<std::size_t>& offsets, std::size_t n, const CharT* s, std::size_t count);
+
+  /// @brief method to retrieve the number of characters
+  std::size_t size() const { return mSize; }
+
+  /// @brief method to check whether the text is empty
+  bool empty() const { return mSize == 0; }
+
+  /// @brief method to retrieve a copy of the whole text
+  string_type str() const { return substr(0, mSize); }
+
+  /// @brief method to retrieve a copy of (part of) the text
+  string_type substr(std::size_t pos, std::size_t n) const;
+
+  /// @brief method to retrieve the character at `pos`
+  CharT at(std::size_t pos) const;
+
+  /// @brief method to take an immutable view of the current text
+  Snapshot snapshot() const;
+
+  /// @brief method to retrieve the number of lines (at least one)
+  std::size_t lineCount() const { return mLines.size(); }
+
+  /// @brief method to retrieve the offset of the first character of a line
+  std::size_t lineStart(std::size_t line) const {
+    return mLines[line] + ((mShiftBy != 0 && line >= mShiftFrom) ? mShiftBy : 0);
+  }
+
+  /// @brief method to retrieve the line holding the character at `pos`
+  std::size_t lineOf(std::size_t pos) const { return upperLine(pos) - 1; }
+
+  /// @brief method to retrieve a copy of a line, without its line break (`\n` or `\r\n`)
+  string_type line(std::size_t line) const;
+
+  /// @brief method to retrieve the number of pieces
+  std::size_t pieceCount() const { return mPieces->size(); }
+
+  /// @brief method to merge all pieces into a new original buffer (O(text))
+  void compact() { assign(str()); }
+
+private:
+
+  /// @brief the original (immutable) text
+  std::shared_ptr<const string_type> mOriginal;
+  /// @brief the inserted text, append only
+  std::shared_ptr<string_type> mAdded;
+  /// @brief the piece sequence, shared with snapshots until the next edit
+  std::shared_ptr<std::vector<Piece>> mPieces;
+
+  /// @brief number of characters
+  std::size_t mSize = 0;
+
+  /// @brief index of the last located piece
+  mutable std::size_t mHintPiece = 0;
+  /// @brief offset of the first character of `mHintPiece`
+  mutable std::size_t mHintStart = 0;
+
+  /// @brief offset of every line start (before the pending shift)
+  std::vector<std::size_t> mLines;
+  /// @brief first line of the pending shift
+  std::size_t mShiftFrom = 0;
+  /// @brief pending shift of the lines from `mShiftFrom`
+  std::size_t mShiftBy = 0;
+
+  /// @brief helper method to retrieve the piece sequence for modification
+  std::vector<Piece>& pieces();
+
+  /// @brief helper method to find the piece holding `pos` & the offset of its first character
+  std::size_t locate(std::size_t pos, std::size_t& start) const;
+
+  /// @brief helper method to retrieve the buffer of a piece
+  const CharT* data(const Piece& piece) const {
+    return (piece.added ? mAdded->data() : mOriginal->data()) + piece.start;
+  }
+
+  /// @brief helper method to find the first line starting after `pos`
+  std::size_t upperLine(std::size_t pos) const;
+
+  /// @brief helper method to shift the starts of the lines from `from` by `by`
+  void shiftLines(std::size_t from, std::size_t by);
+
+  /// @brief helper method to apply the pending shift
+  void flushLines();
+
+  /// @brief helper method to copy a range of a piece sequence
+  static void copy(
+    const std::vector<Piece>& pieces,
+    const string_type& original, const string_type& added,
+    std::size_t pos, std::size_t n,
+    string_type& out
+  );
+};
+
+/// @brief piece table of narrow (i.e. UTF-8) text
+typedef BasicPieceTable<char> PieceTable;
+/// @brief piece table of wide (i.e. UTF-16) text
+typedef BasicPieceTable<wchar_t> WPieceTable;
+
+#endif // end of PIECETABLE_H
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
@@ -0,0 +1,361 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		TextMetrics.cpp
+  * @brief 		Implemenation of the HeadlessGlyphSource & TextMetrics utility classes
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the definition/implemenation
+  *           for the `HeadlessGlyphSource` & `TextMetrics` classes' functionality
+  */
+
+/// @brief begin of TEXTMETRICS_CPP implementation
+#ifndef TEXTMETRICS_CPP
+#define TEXTMETRICS_CPP
+
+#include "./TextMetrics.h"
+#include "./Utf.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+  /// @brief helper function to check whether a codepoint is a break opportunity (white space)
+  inline bool isSpace(std::uint32_t cp) {
+    return cp == ' ' || cp == '\t' || cp == 0x3000;
+  }
+
+  /// @brief helper function to retrieve the synthetic advance of a codepoint (in 1/1000 em)
+  int headlessUnits(std::uint32_t cp) {
+    if (cp < 0x20 || cp == 0x7F) {
+      return 0;
+    }
+    if (cp == ' ') {
+      return 278;
+    }
+    if (
+         (cp >= 0x2E80 && cp <= 0x9FFF)   // CJK
+      || (cp >= 0xAC00 && cp <= 0xD7A3)   // Hangul
+      || (cp >= 0xFF00 && cp <= 0xFF60)   // full-width forms
+      || cp == 0x3000
+    ) {
+      return 1000;
+    }
+    if (cp >= 0x80) {
+      return 556;
+    }
+    const char c = static_cast<char>(cp);
+    if (std::strchr("ijl.,:;'!|", c)) {
+      return 222;
+    }
+    if (std::strchr("ftrI()[]{}/\\-\"`", c)) {
+      return 333;
+    }
+    if (std::strchr("mwMW@", c)) {
+      return 833;
+    }
+    if (c >= 'A' && c <= 'Z') {
+      return 667;
+    }
+    if (c >= '0' && c <= '9') {
+      return 556;
+    }
+    if (c >= 'a' && c <= 'z') {
+      return 500;
+    }
+    return 584;
+  }
+}
+
+/*%*%*%*%*%*%*%*%*%*%*%*%*/
+/* HeadlessGlyphSource   */
+/*%*%*%*%*%*%*%*%*%*%*%*%*/
+
+/// @param[in]  first ~ first codepoint
+/// @param[in]  count ~ number of consecutive codepoints
+/// @param[out] out ~ receives `count` advances (in pixels)
+void HeadlessGlyphSource::advances(std::uint32_t first, std::size_t count, int* out) {
+  for (std::size_t i = 0; i < count; i++) {
+    out[i] = (headlessUnits(first + static_cast<std::uint32_t>(i)) * mSize + 500) / 1000;
+  }
+}
+
+/// @return ascent, descent & line gap of a typical sans-serif font at `mSize`
+GlyphSource::LineMetrics HeadlessGlyphSource::lineMetrics() {
+  LineMetrics line;
+  line.ascent = (905 * mSize + 500) / 1000;
+  line.descent = (212 * mSize + 500) / 1000;
+  line.lineGap = (33 * mSize + 500) / 1000;
+  return line;
+}
+
+/// @param[out] pairs ~ receives the classic (Latin capital) kerning pairs
+void HeadlessGlyphSource::kerning(std::vector<KerningPair>& pairs) {
+  static const char* const PAIRS[] = {
+    "AV", "AW", "AY", "AT", "LT", "LV", "LW", "LY", "To", "Te", "Ta", "Vo",
+    "Ve", "Va", "Yo", "Ye", "Ya", "Wo", "We", "Wa", "P.", "P,", "F.", "F,"
+  };
+  const int amount = -(74 * mSize + 500) / 1000;
+  pairs.clear();
+  if (amount == 0) {
+    return;
+  }
+  for (const char* pair : PAIRS) {
+    pairs.push_back(KerningPair{
+      static_cast<std::uint32_t>(pair[0]), static_cast<std::uint32_t>(pair[1]), amount
+    });
+  }
+}
+
+/*%*%*%*%*%*%*%*/
+/* TextMetrics   */
+/*%*%*%*%*%*%*%*/
+
+/// @param[in] source ~ font data, queried for the line metrics & kerning pairs right away
+TextMetrics::TextMetrics(std::unique_ptr<GlyphSource> source)
+  : mSource(std::move(source)) {
+
+  std::memset(mKernFirst, 0, sizeof(mKernFirst));
+
+  mLine = mSource->lineMetrics();
+
+  std::vector<GlyphSource::KerningPair> pairs;
+  mSource->kerning(pairs);
+  mSourceCalls += 2;
+
+  std::sort(pairs.begin(), pairs.end(), [](const GlyphSource::KerningPair& a, const GlyphSource::KerningPair& b) {
+    return a.first != b.first ? a.first < b.first : a.second < b.second;
+  });
+
+  mKernKeys.reserve(pairs.size());
+  mKernAmounts.reserve(pairs.size());
+  for (const GlyphSource::KerningPair& pair : pairs) {
+    if (pair.amount == 0) {
+      continue;
+    }
+    std::uint64_t key = (static_cast<std::uint64_t>(pair.first) << 32) | pair.second;
+    if (!mKernKeys.empty() && mKernKeys.back() == key) {
+      continue; // duplicate pair
+    }
+    mKernKeys.push_back(key);
+    mKernAmounts.push_back(pair.amount);
+    if (pair.first < 256) {
+      mKernFirst[pair.first >> 6] |= std::uint64_t(1) << (pair.first & 63);
+    } else {
+      mKernHigh = true;
+    }
+  }
+}
+
+/// @param[in] cp ~ any codepoint of the page
+/// @return    the (loaded) page of advances holding `cp`
+const int* TextMetrics::page(std::uint32_t cp) {
+  const std::size_t index = cp / PAGE_SIZE;
+  if (index >= mPages.size()) {
+    mPages.resize(index + 1);
+  }
+  std::unique_ptr<int[]>& slot = mPages[index];
+  if (!slot) {
+    slot.reset(new int[PAGE_SIZE]);
+    mSource->advances(static_cast<std::uint32_t>(index * PAGE_SIZE), PAGE_SIZE, slot.get());
+    mSourceCalls++;
+    mPageCount++;
+  }
+  return slot.get();
+}
+
+/// @param[in] cp ~ codepoint
+/// @return    advance (in pixels) of the codepoint
+int TextMetrics::advance(std::uint32_t cp) {
+  if (cp > Utf::MAX_CODEPOINT) {
+    cp = Utf::REPLACEMENT;
+  }
+  return page(cp)[cp % PAGE_SIZE];
+}
+
+/// @param[in] cp ~ codepoint
+/// @return    advance of the codepoint, with tabs expanded & line breaks taking no space
+int TextMetrics::step(std::uint32_t cp) {
+  if (cp == '\t') {
+    return TAB_SIZE * advance(' ');
+  }
+  if (cp == '\r' || cp == '\n') {
+    return 0;
+  }
+  return advance(cp);
+}
+
+/// @param[in] first ~ codepoint on the left
+/// @param[in] second ~ codepoint on the right
+/// @return    adjustment (in pixels) to add between the two codepoints, usually negative
+int TextMetrics::kerning(std::uint32_t first, std::uint32_t second) const {
+  // most codepoints start no pair at all => reject without searching
+  if (first < 256 ? !((mKernFirst[first >> 6] >> (first & 63)) & 1) : !mKernHigh) {
+    return 0;
+  }
+  const std::uint64_t key = (static_cast<std::uint64_t>(first) << 32) | second;
+  auto it = std::lower_bound(mKernKeys.begin(), mKernKeys.end(), key);
+  if (it == mKernKeys.end() || *it != key) {
+    return 0;
+  }
+  return mKernAmounts[it - mKernKeys.begin()];
+}
+
+/// @param[in] first ~ first codepoint to load
+/// @param[in] last ~ last codepoint to load (inclusive)
+void TextMetrics::warm(std::uint32_t first, std::uint32_t last) {
+  last = std::min(last, Utf::MAX_CODEPOINT);
+  for (std::uint32_t cp = first - first % PAGE_SIZE; cp <= last; cp += PAGE_SIZE) {
+    page(cp);
+  }
+}
+
+template <typename CharT>
+TextMetrics::Size TextMetrics::measureImpl(const CharT* s, std::size_t n) {
+
+  Size size;
+  int lineWidth = 0;
+  int lines = 1;
+  std::uint32_t prev = 0;
+
+  for (std::size_t i = 0; i < n; ) {
+    const std::uint32_t cp = Utf::next(s, n, i);
+    if (cp == '\n') {
+      size.width = std::max(size.width, lineWidth);
+      lineWidth = 0;
+      prev = 0;
+      lines++;
+      continue;
+    }
+    if (cp == '\r') {
+      continue;
+    }
+    lineWidth += step(cp) + (prev ? kerning(prev, cp) : 0);
+    prev = cp;
+  }
+
+  size.width = std::max(size.width, lineWidth);
+  size.height = lines * lineHeight();
+  return size;
+}
+
+/// @param[in] text ~ UTF-8 text
+/// @return    width of the widest line & height of all lines
+TextMetrics::Size TextMetrics::measure(const std::string& text) {
+  return measureImpl(text.data(), text.size());
+}
+
+/// @param[in] text ~ UTF-16 (UTF-32) text
+/// @return    width of the widest line & height of all lines
+TextMetrics::Size TextMetrics::measure(const std::wstring& text) {
+  return measureImpl(text.data(), text.size());
+}
+
+/// @details Greedy word-wrap: a line is broken after the last run of white space
+///          that fits, or before the first character that does not fit when a word
+///          is wider than `maxWidth`. White space at the end of a line hangs
+///          (it is not counted & does not force a break)
+template <typename CharT>
+std::vector<TextMetrics::Line> TextMetrics::breakImpl(const CharT* s, std::size_t n, int maxWidth) {
+
+  std::vector<Line> lines;
+
+  std::size_t lineBegin = 0;
+  int width = 0;
+  std::uint32_t prev = 0;
+
+  // end of the last visible character of the line
+  std::size_t wordEnd = 0;
+  int wordEndWidth = 0;
+
+  // last break opportunity (a run of white space after a visible character)
+  bool inSpaces = false;
+  bool canBreak = false;
+  std::size_t breakEnd = 0;
+  int breakWidth = 0;
+  std::size_t nextBegin = 0;
+  int nextBeginWidth = 0;
+
+  std::size_t i = 0;
+  while (i < n) {
+
+    const std::size_t at = i;
+    const std::uint32_t cp = Utf::next(s, n, i);
+
+    if (cp == '\r') {
+      continue;
+    }
+
+    if (cp == '\n') {
+      lines.push_back(Line{ lineBegin, wordEnd, wordEndWidth });
+      lineBegin = wordEnd = i;
+      width = wordEndWidth = 0;
+      prev = 0;
+      inSpaces = canBreak = false;
+      continue;
+    }
+
+    int adv = step(cp) + (prev ? kerning(prev, cp) : 0);
+
+    if (isSpace(cp)) {
+      width += adv;
+      prev = cp;
+      inSpaces = inSpaces || wordEnd > lineBegin;
+      continue;
+    }
+
+    if (inSpaces) {
+      // the white space just ended => the line may break here
+      canBreak = true;
+      breakEnd = wordEnd;
+      breakWidth = wordEndWidth;
+      nextBegin = at;
+      nextBeginWidth = width;
+      inSpaces = false;
+    }
+
+    while (maxWidth > 0 && width + adv > maxWidth && at > lineBegin) {
+      if (canBreak) {
+        // move the current word onto the next line ...
+        lines.push_back(Line{ lineBegin, breakEnd, breakWidth });
+        lineBegin = nextBegin;
+        width -= nextBeginWidth;
+        wordEndWidth -= nextBeginWidth; // relative to the new line (if the word breaks next)
+        canBreak = false;
+      } else {
+        // the word alone is too wide => break it before this character
+        lines.push_back(Line{ lineBegin, wordEnd, wordEndWidth });
+        lineBegin = at;
+        width = 0;
+        prev = 0;
+        adv = step(cp);
+      }
+    }
+
+    width += adv;
+    prev = cp;
+    wordEnd = i;
+    wordEndWidth = width;
+  }
+
+  lines.push_back(Line{ lineBegin, std::max(wordEnd, lineBegin), wordEndWidth });
+  return lines;
+}
+
+/// @param[in] text ~ UTF-8 text
+/// @param[in] maxWidth ~ maximum width (in pixels) of a line, `0` to only break at `\n`
+/// @return    the lines, with byte offsets into `text`
+std::vector<TextMetrics::Line> TextMetrics::breakLines(const std::string& text, int maxWidth) {
+  return breakImpl(text.data(), text.size(), maxWidth);
+}
+
+/// @param[in] text ~ UTF-16 (UTF-32) text
+/// @param[in] maxWidth ~ maximum width (in pixels) of a line, `0` to only break at `\n`
+/// @return    the lines, with code unit offsets into `text`
+std::vector<TextMetrics::Line> TextMetrics::breakLines(const std::wstring& text, int maxWidth) {
+  return breakImpl(text.data(), text.size(), maxWidth);
+}
+
+#endif // end of TEXTMETRICS_CPP
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
@@ -0,0 +1,211 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		TextMetrics.h
+  * @brief 		Declaration of the GlyphSource, HeadlessGlyphSource & TextMetrics utility classes
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the method signatures for the `TextMetrics` class,
+  *           which measures & line-breaks text from cached, flat tables of glyph advances,
+  *           kerning pairs & line metrics, i.e. without querying the font once warmed up <br/>
+  *           The font data is supplied by a `GlyphSource`: GDI on Windows (see `xGlyphSource`),
+  *           or the synthetic `HeadlessGlyphSource` anywhere else (i.e. benchmarks)
+  */
+
+#pragma once
+
+/// @brief begin of TEXTMETRICS_H declaration
+#ifndef TEXTMETRICS_H
+#define TEXTMETRICS_H
+
+#include <cstddef> // std::size_t
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @class   GlyphSource
+ * @brief   interface supplying the metrics of a font to `TextMetrics`
+ * @details Every method is invoked at most once per page/font by `TextMetrics`
+ */
+class GlyphSource {
+
+public:
+
+  /// @brief vertical metrics of a font (in pixels)
+  struct LineMetrics {
+    int ascent = 0;   ///< height above the baseline
+    int descent = 0;  ///< depth below the baseline
+    int lineGap = 0;  ///< recommended extra space between lines (external leading)
+  };
+
+  /// @brief kerning adjustment of a pair of codepoints (in pixels)
+  struct KerningPair {
+    std::uint32_t first;
+    std::uint32_t second;
+    int amount;
+  };
+
+  /// @brief virtual destructor
+  virtual ~GlyphSource() = default;
+
+  /// @brief method to retrieve the advances of `count` consecutive codepoints
+  virtual void advances(std::uint32_t first, std::size_t count, int* out) = 0;
+
+  /// @brief method to retrieve the vertical metrics of the font
+  virtual LineMetrics lineMetrics() = 0;
+
+  /// @brief method to retrieve all the kerning pairs of the font
+  virtual void kerning(std::vector<KerningPair>& pairs) = 0;
+};
+
+/**
+ * @class   HeadlessGlyphSource
+ * @brief   synthetic, proportional font requiring no graphics API
+ * @details Advances loosely follow a sans-serif font (narrow `i`/`l`, wide `m`/`W`,
+ *          full-width CJK) scaled by the pixel size, with a handful of kerning pairs. <br/>
+ *          Meant for measuring on platforms without GDI, i.e. tests & benchmarks
+ */
+class HeadlessGlyphSource : public GlyphSource {
+
+public:
+
+  /// @brief constructor ~ `size` is the em size (in pixels)
+  explicit HeadlessGlyphSource(int size = 16) : mSize(size) {}
+
+  void advances(std::uint32_t first, std::size_t count, int* out) override;
+  LineMetrics lineMetrics() override;
+  void kerning(std::vector<KerningPair>& pairs) override;
+
+private:
+
+  /// @brief em size (in pixels)
+  int mSize;
+};
+
+/**
+ * @class   TextMetrics
+ * @brief   measures text from cached per-font tables
+ * @details Advances are cached in pages of `PAGE_SIZE` codepoints, loaded from the
+ *          `GlyphSource` the first time a codepoint of the page is measured. Kerning pairs
+ *          are loaded once into a sorted flat table. <br/>
+ *          Narrow strings are UTF-8, wide strings UTF-16 (UTF-32 where `wchar_t` is 32-bit).
+ *          `\n` starts a new line, `\r` is ignored & `\t` advances by `TAB_SIZE` spaces
+ * @note    not thread-safe ~ meant to be used from the UI thread
+ */
+class TextMetrics {
+
+public:
+
+  /// @brief number of codepoints per cached page of advances
+  static const std::uint32_t PAGE_SIZE = 256;
+  /// @brief number of spaces a tab advances by (as `DT_EXPANDTABS`)
+  static const int TAB_SIZE = 8;
+
+  /// @brief size (in pixels) of measured text
+  struct Size {
+    int width = 0;   ///< width of the widest line
+    int height = 0;  ///< number of lines times `lineHeight()`
+  };
+
+  /// @brief a line produced by `breakLines(...)`
+  struct Line {
+    std::size_t begin;  ///< offset (in code units) of the first character
+    std::size_t end;    ///< offset (in code units) past the last visible character
+    int width;          ///< width (in pixels), trailing spaces excluded
+  };
+
+public:
+
+  /// @brief constructor ~ takes ownership of the glyph source
+  explicit TextMetrics(std::unique_ptr<GlyphSource> source);
+
+  /// @brief deleted copy constructor ~ owns its source & tables
+  TextMetrics(const TextMetrics&) = delete;
+  /// @brief deleted copy assignment operator ~ owns its source & tables
+  TextMetrics& operator = (const TextMetrics&) = delete;
+
+  /// @brief method to retrieve the advance (in pixels) of a codepoint
+  int advance(std::uint32_t cp);
+
+  /// @brief method to retrieve the kerning adjustment (in pixels) of a pair of codepoints
+  int kerning(std::uint32_t first, std::uint32_t second) const;
+
+  /// @brief method to measure the widest line of a string
+  int width(const std::string& text) { return measure(text).width; }
+  /// @brief method to measure the widest line of a wide string
+  int width(const std::wstring& text) { return measure(text).width; }
+
+  /// @brief method to measure the height of a string (all lines)
+  int height(const std::string& text) { return measure(text).height; }
+  /// @brief method to measure the height of a wide string (all lines)
+  int height(const std::wstring& text) { return measure(text).height; }
+
+  /// @brief method to measure a string
+  Size measure(const std::string& text);
+  /// @brief method to measure a wide string
+  Size measure(const std::wstring& text);
+
+  /// @brief method to word-wrap a string to `maxWidth` pixels (`0` => no wrapping)
+  std::vector<Line> breakLines(const std::string& text, int maxWidth);
+  /// @brief method to word-wrap a wide string to `maxWidth` pixels (`0` => no wrapping)
+  std::vector<Line> breakLines(const std::wstring& text, int maxWidth);
+
+  /// @brief method to retrieve the vertical metrics of the font
+  const GlyphSource::LineMetrics& lineMetrics() const { return mLine; }
+
+  /// @brief method to retrieve the height of a line (ascent + descent)
+  int lineHeight() const { return mLine.ascent + mLine.descent; }
+
+  /// @brief method to load the advances of the codepoints [first, last] ahead of time
+  void warm(std::uint32_t first, std::uint32_t last);
+
+  /// @brief method to retrieve the number of queries made to the glyph source
+  std::size_t sourceCalls() const { return mSourceCalls; }
+
+  /// @brief method to retrieve the number of cached pages of advances
+  std::size_t pages() const { return mPageCount; }
+
+private:
+
+  /// @brief the font data
+  std::unique_ptr<GlyphSource> mSource;
+
+  /// @brief pages of advances, indexed by `codepoint / PAGE_SIZE` (`nullptr` until loaded)
+  std::vector<std::unique_ptr<int[]>> mPages;
+
+  /// @brief vertical metrics of the font
+  GlyphSource::LineMetrics mLine;
+
+  /// @brief kerning pairs (`first << 32 | second`), sorted
+  std::vector<std::uint64_t> mKernKeys;
+  /// @brief kerning adjustments, in the order of `mKernKeys`
+  std::vector<int> mKernAmounts;
+  /// @brief bitmap of the codepoints below 256 that start a kerning pair
+  std::uint64_t mKernFirst[4];
+  /// @brief flag indicating that codepoints from 256 start kerning pairs
+  bool mKernHigh = false;
+
+  /// @brief number of queries made to the glyph source
+  std::size_t mSourceCalls = 0;
+  /// @brief number of cached pages
+  std::size_t mPageCount = 0;
+
+  /// @brief helper method to load the page holding `cp`
+  const int* page(std::uint32_t cp);
+
+  /// @brief helper method to retrieve the advance of a codepoint, tabs expanded
+  int step(std::uint32_t cp);
+
+  /// @brief shared implementation of `measure(...)`
+  template <typename CharT>
+  Size measureImpl(const CharT* s, std::size_t n);
+
+  /// @brief shared implementation of `breakLines(...)`
+  template <typename CharT>
+  std::vector<Line> breakImpl(const CharT* s, std::size_t n, int maxWidth);
+};
+
+#endif // end of TEXTMETRICS_H
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
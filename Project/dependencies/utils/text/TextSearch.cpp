@@ -0,0 +1,352 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		TextSearch.cpp
+  * @brief 		Implemenation of BasicTextSearch utility class template
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the definition/implemenation
+  *           for the `BasicTextSearch` class template's functionality,
+  *           explicitly instantiated for `char` & `wchar_t`
+  */
+
+/// @brief begin of TEXTSEARCH_CPP implementation
+#ifndef TEXTSEARCH_CPP
+#define TEXTSEARCH_CPP
+
+#include "./TextSearch.h"
+#include "../str/CaseMap.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+/// @brief SSE2 candidate filter available
+#define TEXTSEARCH_SSE2
+#include <emmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h> // _BitScanForward
+#endif
+#endif
+
+namespace {
+
+  /// @brief maximum number of characters comparing equal to an end of the pattern
+  ///        for the SIMD filter (i.e. `k`, `K` & `U+212A` KELVIN SIGN)
+  const std::size_t MAX_VARIANTS = 4;
+
+  #ifdef TEXTSEARCH_SSE2
+  /// @brief SSE2 operations on lanes of `Size` bytes
+  template <std::size_t Size> struct Lanes;
+
+  template <> struct Lanes<1> {
+    static __m128i set(std::uint32_t c) { return _mm_set1_epi8(static_cast<char>(c)); }
+    static __m128i eq(__m128i a, __m128i b) { return _mm_cmpeq_epi8(a, b); }
+    static const unsigned MASK = 0xFFFF; ///< one `movemask` bit per lane
+  };
+
+  template <> struct Lanes<2> {
+    static __m128i set(std::uint32_t c) { return _mm_set1_epi16(static_cast<short>(c)); }
+    static __m128i eq(__m128i a, __m128i b) { return _mm_cmpeq_epi16(a, b); }
+    static const unsigned MASK = 0x5555;
+  };
+
+  template <> struct Lanes<4> {
+    static __m128i set(std::uint32_t c) { return _mm_set1_epi32(static_cast<int>(c)); }
+    static __m128i eq(__m128i a, __m128i b) { return _mm_cmpeq_epi32(a, b); }
+    static const unsigned MASK = 0x1111;
+  };
+
+  /// @brief helper function to retrieve the index of the lowest set bit (`mask != 0`)
+  inline unsigned lowestBit(unsigned mask) {
+    #ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<unsigned>(index);
+    #else
+    return static_cast<unsigned>(__builtin_ctz(mask));
+    #endif
+  }
+  #endif
+}
+
+/// @param[in] c ~ character
+/// @return    the lowercase character (ASCII only for `char`, i.e. UTF-8 bytes)
+template <>
+char BasicTextSearch<char>::fold(char c) {
+  return (c >= 'A' && c <= 'Z') ? static_cast<char>(c + 0x20) : c;
+}
+
+/// @param[in] c ~ character
+/// @return    the lowercase character (BMP, surrogates excluded)
+template <>
+wchar_t BasicTextSearch<wchar_t>::fold(wchar_t c) {
+  const std::uint32_t u = static_cast<std::uint32_t>(c);
+  if (u < 0x80) {
+    return (c >= L'A' && c <= L'Z') ? static_cast<wchar_t>(c + 0x20) : c;
+  }
+  if (u > 0xFFFF || (u >= 0xD800 && u <= 0xDFFF)) {
+    return c;
+  }
+  return static_cast<wchar_t>(CaseMap::lower(u));
+}
+
+/// @param[in] c ~ character
+template <typename CharT>
+bool BasicTextSearch<CharT>::isWord(CharT c) {
+  const std::uint32_t u = static_cast<std::uint32_t>(c) & ((sizeof(CharT) == 1) ? 0xFFu : 0xFFFFFFFFu);
+  return (u >= '0' && u <= '9') || (u >= 'A' && u <= 'Z') || (u >= 'a' && u <= 'z') || u == '_' || u >= 0x80;
+}
+
+/// @param[in] pattern ~ the searched characters
+/// @param[in] flags ~ `Flags` combined with `|`
+template <typename CharT>
+BasicTextSearch<CharT>::BasicTextSearch(string_type pattern, unsigned flags)
+  : mPattern(std::move(pattern)), mFlags(flags) {
+
+  mFolded = mPattern;
+  if (mFlags & IGNORE_CASE) {
+    for (CharT& c : mFolded) {
+      c = fold(c);
+    }
+  }
+  if (mPattern.empty()) {
+    return;
+  }
+
+  // characters comparing equal to each end of the pattern ...
+  const CharT ends[2] = { mFolded.front(), mFolded.back() };
+  std::vector<CharT>* variants[2] = { &mFirst, &mLast };
+  for (int e = 0; e < 2; e++) {
+    if (!(mFlags & IGNORE_CASE)) {
+      variants[e]->push_back(mPattern[e == 0 ? 0 : mPattern.size() - 1]);
+      continue;
+    }
+    const std::uint32_t limit = (sizeof(CharT) == 1) ? 0x100 : 0x10000;
+    for (std::uint32_t u = 0; u < limit; u++) {
+      const CharT c = static_cast<CharT>(u);
+      if (fold(c) == ends[e]) {
+        variants[e]->push_back(c);
+      }
+    }
+    if (variants[e]->empty()) {
+      variants[e]->push_back(ends[e]); // i.e. outside the BMP
+    }
+  }
+}
+
+/// @param[in] s ~ the text
+/// @param[in] n ~ number of characters of the text
+/// @param[in] pos ~ offset of the candidate, `pos + pattern().size() <= n`
+template <typename CharT>
+bool BasicTextSearch<CharT>::matches(const CharT* s, std::size_t n, std::size_t pos) const {
+
+  const std::size_t m = mPattern.size();
+  if (mFlags & IGNORE_CASE) {
+    for (std::size_t k = 0; k < m; k++) {
+      if (fold(s[pos + k]) != mFolded[k]) {
+        return false;
+      }
+    }
+  } else if (std::char_traits<CharT>::compare(s + pos, mPattern.data(), m) != 0) {
+    return false;
+  }
+
+  if (mFlags & WHOLE_WORD) {
+    if ((pos > 0 && isWord(s[pos - 1])) || (pos + m < n && isWord(s[pos + m]))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// @param[in] s ~ the text
+/// @param[in] n ~ number of characters of the text (neighbours of the matches included)
+/// @param[in] from ~ first candidate offset
+/// @param[in] to ~ past the last candidate offset
+/// @param[in] onMatch ~ invoked with the offset of each match, returning the next
+///                      candidate offset (i.e. past the match) or `npos` to stop
+template <typename CharT>
+template <typename F>
+void BasicTextSearch<CharT>::scan(const CharT* s, std::size_t n, std::size_t from, std::size_t to, F onMatch) const {
+
+  const std::size_t m = mPattern.size();
+  if (m == 0 || n < m) {
+    return;
+  }
+  to = std::min(to, n - m + 1);
+
+  std::size_t i = from;
+  std::size_t next = from;
+
+  #ifdef TEXTSEARCH_SSE2
+  if (mFirst.size() <= MAX_VARIANTS && mLast.size() <= MAX_VARIANTS) {
+
+    typedef Lanes<sizeof(CharT)> L;
+    const std::size_t lanes = 16 / sizeof(CharT);
+
+    __m128i first[MAX_VARIANTS], last[MAX_VARIANTS];
+    for (std::size_t k = 0; k < mFirst.size(); k++) {
+      first[k] = L::set(static_cast<std::uint32_t>(mFirst[k]));
+    }
+    for (std::size_t k = 0; k < mLast.size(); k++) {
+      last[k] = L::set(static_cast<std::uint32_t>(mLast[k]));
+    }
+
+    // positions whose first & last characters both match ...
+    for (; i < to && i + m - 1 + lanes <= n; i += lanes) {
+
+      const __m128i head = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+      const __m128i tail = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i + m - 1));
+
+      __m128i eqFirst = L::eq(head, first[0]);
+      for (std::size_t k = 1; k < mFirst.size(); k++) {
+        eqFirst = _mm_or_si128(eqFirst, L::eq(head, first[k]));
+      }
+      __m128i eqLast = L::eq(tail, last[0]);
+      for (std::size_t k = 1; k < mLast.size(); k++) {
+        eqLast = _mm_or_si128(eqLast, L::eq(tail, last[k]));
+      }
+
+      unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_and_si128(eqFirst, eqLast))) & L::MASK;
+      while (mask) {
+        const std::size_t pos = i + lowestBit(mask) / sizeof(CharT);
+        mask &= mask - 1;
+        if (pos >= to) {
+          return;
+        }
+        if (pos >= next && matches(s, n, pos)) {
+          next = onMatch(pos);
+          if (next == npos) {
+            return;
+          }
+        }
+      }
+    }
+  }
+  #endif
+
+  // the remaining candidates, one at a time ...
+  for (i = std::max(i, next); i < to; i++) {
+    if (i >= next && matches(s, n, i)) {
+      next = onMatch(i);
+      if (next == npos) {
+        return;
+      }
+    }
+  }
+}
+
+/// @param[in] text ~ the piece table
+/// @param[in] from ~ first candidate offset
+/// @param[in] onMatch ~ invoked with the offset of each match, returning the next
+///                      candidate offset (i.e. past the match) or `npos` to stop
+template <typename CharT>
+template <typename F>
+void BasicTextSearch<CharT>::scan(const BasicPieceTable<CharT>& text, std::size_t from, F onMatch) const {
+
+  const std::size_t m = mPattern.size();
+  const std::size_t n = text.size();
+  if (m == 0 || n < m) {
+    return;
+  }
+
+  std::size_t next = from;
+  for (std::size_t chunk = from; chunk + m <= n; chunk += CHUNK) {
+
+    // the chunk, the character preceding it & those of a match starting at its end ...
+    const std::size_t base = (chunk > 0) ? chunk - 1 : 0;
+    const string_type window = text.substr(base, (chunk - base) + CHUNK + m);
+
+    bool stop = false;
+    scan(window.data(), window.size(), std::max(next, chunk) - base, chunk - base + CHUNK,
+      [&](std::size_t pos) -> std::size_t {
+        next = onMatch(base + pos);
+        if (next == npos) {
+          stop = true;
+          return npos;
+        }
+        return next - base;
+      }
+    );
+    if (stop) {
+      return;
+    }
+  }
+}
+
+/// @param[in] s ~ the text
+/// @param[in] n ~ number of characters of the text
+/// @param[in] from ~ first candidate offset
+/// @return    offset of the match, `npos` if none
+template <typename CharT>
+std::size_t BasicTextSearch<CharT>::find(const CharT* s, std::size_t n, std::size_t from) const {
+  std::size_t found = npos;
+  scan(s, n, from, n, [&](std::size_t pos) -> std::size_t {
+    found = pos;
+    return npos;
+  });
+  return found;
+}
+
+/// @param[in] s ~ the text
+/// @param[in] n ~ number of characters of the text
+/// @return    the matches, in order
+template <typename CharT>
+std::vector<typename BasicTextSearch<CharT>::Match> BasicTextSearch<CharT>::findAll(const CharT* s, std::size_t n) const {
+  std::vector<Match> found;
+  const std::size_t m = mPattern.size();
+  scan(s, n, 0, n, [&](std::size_t pos) -> std::size_t {
+    found.push_back(Match{ pos, m });
+    return pos + m;
+  });
+  return found;
+}
+
+/// @param[in] text ~ the piece table
+/// @param[in] from ~ first candidate offset
+/// @return    offset of the match, `npos` if none
+template <typename CharT>
+std::size_t BasicTextSearch<CharT>::find(const BasicPieceTable<CharT>& text, std::size_t from) const {
+  std::size_t found = npos;
+  scan(text, from, [&](std::size_t pos) -> std::size_t {
+    found = pos;
+    return npos;
+  });
+  return found;
+}
+
+/// @param[in] text ~ the piece table
+/// @return    the matches, in order
+template <typename CharT>
+std::vector<typename BasicTextSearch<CharT>::Match> BasicTextSearch<CharT>::findAll(const BasicPieceTable<CharT>& text) const {
+  std::vector<Match> found;
+  const std::size_t m = mPattern.size();
+  scan(text, 0, [&](std::size_t pos) -> std::size_t {
+    found.push_back(Match{ pos, m });
+    return pos + m;
+  });
+  return found;
+}
+
+/// @param[in,out] text ~ the piece table
+/// @param[in]     with ~ the replacement characters
+/// @return        number of matches replaced
+/// @details       the table is edited once for all matches (see `BasicPieceTable::replaceAll`)
+template <typename CharT>
+std::size_t BasicTextSearch<CharT>::replaceAll(BasicPieceTable<CharT>& text, const string_type& with) const {
+  std::vector<std::size_t> offsets;
+  const std::size_t m = mPattern.size();
+  scan(text, 0, [&](std::size_t pos) -> std::size_t {
+    offsets.push_back(pos);
+    return pos + m;
+  });
+  text.replaceAll(offsets, m, with.data(), with.size());
+  return offsets.size();
+}
+
+template class BasicTextSearch<char>;
+template class BasicTextSearch<wchar_t>;
+
+#endif // end of TEXTSEARCH_CPP
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
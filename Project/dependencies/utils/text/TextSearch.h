@@ -0,0 +1,127 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		TextSearch.h
+  * @brief 		Declaration of BasicTextSearch utility class template
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file contains the method signatures for the `BasicTextSearch` class template,
+  *           a substring search (case-insensitive & whole-word modes) over plain buffers
+  *           & piece tables, with find-all & replace-all <br/>
+  *           Instantiated for `char` (`TextSearch`) & `wchar_t` (`WTextSearch`) in TextSearch.cpp
+  */
+
+#pragma once
+
+/// @brief begin of TEXTSEARCH_H declaration
+#ifndef TEXTSEARCH_H
+#define TEXTSEARCH_H
+
+#include "./PieceTable.h"
+
+#include <cstddef> // std::size_t
+#include <string>
+#include <vector>
+
+/**
+ * @class   BasicTextSearch
+ * @brief   compiled search pattern
+ * @details Candidates are filtered 16 bytes at a time (SSE2) by comparing both the first
+ *          & the last character of the pattern, only positions matching both being compared
+ *          in full, so that most of the text is skipped without a per-character branch. <br/>
+ *          Case-insensitive comparison folds ASCII for `char` (UTF-8) text & every BMP
+ *          character through `CaseMap` for `wchar_t` text. Whole words are delimited by
+ *          characters other than ASCII letters, digits, `_` & non-ASCII characters. <br/>
+ *          Piece tables are searched in chunks of `CHUNK` characters, copied from the table
+ *          (matches spanning pieces included), rather than copying the whole text
+ */
+template <typename CharT>
+class BasicTextSearch {
+
+public:
+
+  /// @brief the string type of the pattern
+  typedef std::basic_string<CharT> string_type;
+
+  /// @brief a match ~ range of the text
+  struct Match {
+    std::size_t offset;  ///< offset of the first character
+    std::size_t length;  ///< number of characters
+  };
+
+  /// @brief search options (combined with `|`)
+  enum Flags {
+    NONE = 0,
+    IGNORE_CASE = 1,  ///< case-insensitive comparison
+    WHOLE_WORD = 2,   ///< matches delimited by non-word characters (or the text edges)
+  };
+
+  /// @brief value returned by `find(...)` when there is no match
+  static const std::size_t npos = static_cast<std::size_t>(-1);
+
+  /// @brief number of characters of a piece table searched per chunk
+  static const std::size_t CHUNK = 1 << 20;
+
+public:
+
+  /// @brief constructor ~ compiles the pattern
+  explicit BasicTextSearch(string_type pattern, unsigned flags = NONE);
+
+  /// @brief method to retrieve the pattern
+  const string_type& pattern() const { return mPattern; }
+
+  /// @brief method to retrieve the options
+  unsigned flags() const { return mFlags; }
+
+  /// @brief method to find the first match starting at or after `from`
+  std::size_t find(const CharT* s, std::size_t n, std::size_t from = 0) const;
+
+  /// @brief method to find every (non-overlapping) match
+  std::vector<Match> findAll(const CharT* s, std::size_t n) const;
+
+  /// @brief method to find the first match of a piece table starting at or after `from`
+  std::size_t find(const BasicPieceTable<CharT>& text, std::size_t from = 0) const;
+
+  /// @brief method to find every (non-overlapping) match of a piece table
+  std::vector<Match> findAll(const BasicPieceTable<CharT>& text) const;
+
+  /// @brief method to replace every match of a piece table (in a single pass)
+  std::size_t replaceAll(BasicPieceTable<CharT>& text, const string_type& with) const;
+
+private:
+
+  /// @brief the pattern
+  string_type mPattern;
+  /// @brief the pattern, case-folded (`IGNORE_CASE`)
+  string_type mFolded;
+  /// @brief the search options
+  unsigned mFlags;
+
+  /// @brief characters comparing equal to the first/last character of the pattern
+  std::vector<CharT> mFirst, mLast;
+
+  /// @brief helper method to fold a character (`IGNORE_CASE`)
+  static CharT fold(CharT c);
+
+  /// @brief helper method to check whether a character belongs to a word
+  static bool isWord(CharT c);
+
+  /// @brief helper method to compare the pattern with the text at `pos`
+  bool matches(const CharT* s, std::size_t n, std::size_t pos) const;
+
+  /// @brief helper method to report the matches starting in [`from`, `to`) to `onMatch`
+  template <typename F>
+  void scan(const CharT* s, std::size_t n, std::size_t from, std::size_t to, F onMatch) const;
+
+  /// @brief helper method to report the matches of a piece table starting at or after `from`
+  template <typename F>
+  void scan(const BasicPieceTable<CharT>& text, std::size_t from, F onMatch) const;
+};
+
+/// @brief search of narrow (i.e. UTF-8) text
+typedef BasicTextSearch<char> TextSearch;
+/// @brief search of wide (i.e. UTF-16) text
+typedef BasicTextSearch<wchar_t> WTextSearch;
+
+#endif // end of TEXTSEARCH_H
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
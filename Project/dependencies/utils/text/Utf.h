@@ -0,0 +1,112 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		Utf.h
+  * @brief 		Defines inline UTF-8 & UTF-16 decoding (& encoding) helpers
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	This file defines the `Utf::next(...)` functions shared by the text
+  *           utilities, which decode one codepoint at a time from narrow (UTF-8)
+  *           or wide (UTF-16, UTF-32 where `wchar_t` is 32-bit) strings, & the
+  *           `Utf::append(...)` functions encoding them back <br/>
+  *           Header only, so that the decoding inlines into the measuring/drawing loops
+  */
+
+#pragma once
+
+/// @brief begin of UTF_H global interface
+#ifndef UTF_H
+#define UTF_H
+
+#include <cstddef> // std::size_t
+#include <cstdint>
+#include <string>
+
+namespace Utf {
+
+  /// @brief replacement character, substituted for malformed input
+  const std::uint32_t REPLACEMENT = 0xFFFD;
+  /// @brief largest Unicode codepoint
+  const std::uint32_t MAX_CODEPOINT = 0x10FFFF;
+
+  /// @brief helper function to decode the UTF-8 codepoint at `i` (advancing `i`)
+  inline std::uint32_t next(const char* s, std::size_t n, std::size_t& i) {
+    const unsigned char c = static_cast<unsigned char>(s[i++]);
+    if (c < 0x80) {
+      return c;
+    }
+    int extra;
+    std::uint32_t cp;
+    if ((c & 0xE0) == 0xC0) {
+      extra = 1;
+      cp = c & 0x1F;
+    } else if ((c & 0xF0) == 0xE0) {
+      extra = 2;
+      cp = c & 0x0F;
+    } else if ((c & 0xF8) == 0xF0) {
+      extra = 3;
+      cp = c & 0x07;
+    } else {
+      return REPLACEMENT; // stray continuation byte
+    }
+    for (int k = 0; k < extra; k++) {
+      if (i >= n || (static_cast<unsigned char>(s[i]) & 0xC0) != 0x80) {
+        return REPLACEMENT; // truncated sequence
+      }
+      cp = (cp << 6) | (static_cast<unsigned char>(s[i++]) & 0x3F);
+    }
+    return cp > MAX_CODEPOINT ? REPLACEMENT : cp;
+  }
+
+  /// @brief helper function to decode the UTF-16 (or UTF-32) codepoint at `i` (advancing `i`)
+  inline std::uint32_t next(const wchar_t* s, std::size_t n, std::size_t& i) {
+    const std::uint32_t mask = (sizeof(wchar_t) == 2) ? 0xFFFFu : 0xFFFFFFFFu;
+    const std::uint32_t c = static_cast<std::uint32_t>(s[i++]) & mask;
+    if (sizeof(wchar_t) == 2 && c >= 0xD800 && c <= 0xDBFF && i < n) {
+      const std::uint32_t low = static_cast<std::uint32_t>(s[i]) & mask;
+      if (low >= 0xDC00 && low <= 0xDFFF) {
+        i++;
+        return 0x10000 + ((c - 0xD800) << 10) + (low - 0xDC00);
+      }
+    }
+    return c > MAX_CODEPOINT ? REPLACEMENT : c;
+  }
+
+  /// @brief helper function to append the UTF-8 encoding of a codepoint
+  inline void append(std::string& s, std::uint32_t cp) {
+    if (cp > MAX_CODEPOINT) {
+      cp = REPLACEMENT;
+    }
+    if (cp < 0x80) {
+      s.push_back(static_cast<char>(cp));
+    } else if (cp < 0x800) {
+      s.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+      s.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    } else if (cp < 0x10000) {
+      s.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+      s.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+      s.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    } else {
+      s.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+      s.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+      s.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+      s.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    }
+  }
+
+  /// @brief helper function to append the UTF-16 (or UTF-32) encoding of a codepoint
+  inline void append(std::wstring& s, std::uint32_t cp) {
+    if (cp > MAX_CODEPOINT) {
+      cp = REPLACEMENT;
+    }
+    if (sizeof(wchar_t) == 2 && cp >= 0x10000) {
+      s.push_back(static_cast<wchar_t>(0xD800 + ((cp - 0x10000) >> 10)));
+      s.push_back(static_cast<wchar_t>(0xDC00 + ((cp - 0x10000) & 0x3FF)));
+    } else {
+      s.push_back(static_cast<wchar_t>(cp));
+    }
+  }
+}
+
+#endif // end of UTF_H
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
@@ -54,6 +54,12 @@ public:
     IMPLICIT(uIdSubclass); // suppress unused param
     IMPLICIT(dwRefData); // suppress unused param
 
+    // i.e. `xMultiLineTextBox` scrolling a file view itself ...
+    LRESULT result = 0;
+    if (pWidget && pWidget->InterceptMessage(msg, wParam, lParam, result)) {
+      return result;
+    }
+
     switch(msg) {
 
       // redirect all the below cases to `xControl`s
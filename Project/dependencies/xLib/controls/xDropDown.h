@@ -68,9 +68,9 @@ public:
         // setBackgroundColor(parent->colorBG);
 
         #if defined(UNICODE) && defined(_UNICODE)
-        itemsList = StrConverter::VectorToWideString(items);
+        indexItems(StrConverter::VectorToWideString(items));
         #else
-        itemsList = items;
+        indexItems(items);
         #endif
 
         selectedItemIndex = index;
@@ -100,14 +100,19 @@ public:
         // setBackgroundColor(parent->colorBG);
 
         #if defined(UNICODE) && defined(_UNICODE)
-        itemsList = StrConverter::VectorToWideString(items);
+        indexItems(StrConverter::VectorToWideString(items));
         #else
-        itemsList = items;
+        indexItems(items);
         #endif
 
         selectedItemIndex = index;
     }
 
+    /// @brief destructor ~ stops following the bound view (see `bind(...)`)
+    ~xDropDown() {
+        bind(nullptr);
+    }
+
     /// @brief interface override method to attach
     ///        on-selection-change callback action
     ///        `WM_COMMAND` => `CBN_SELCHANGE`
@@ -117,14 +122,231 @@ public:
         mOnSelectionChange = std::move(callback);
     }
 
+    /// @brief method to attach on-selection-change callback action
+    ///        delivered according to a policy, i.e. `EventPolicy::debounce(150)`
+    ///        for listeners filtering/loading upon selection
+    /// @param callback ~ function pointer of the action
+    /// @param policy ~ delivery policy (a burst of changes is delivered once)
+    void setOnSelectionChange(event_onSelectionChange callback, EventPolicy policy) {
+        setOnSelectionChange(std::move(callback));
+        selectionGate.setPolicy(policy);
+    }
+
+    /// @brief method to retrieve the gate delivering selection-change events,
+    ///        i.e. for the delivered/dropped counters or to `flush()` a pending event
+    xEventGate& getSelectionGate() {
+        return selectionGate;
+    }
+
+protected:
+
+    /// @brief delivers selection-change events according to a policy (immediate by default),
+    ///        the listener receiving the selection at the time of delivery
+    xEventGate selectionGate{ [this]() {
+        if (mOnSelectionChange) {
+            mOnSelectionChange(this, selectedItemIndex);
+        }
+    } };
+
+public:
+
+    /// @brief alias for the views of an item model the control shows (see `bind(...)`)
+    #if defined(UNICODE) && defined(_UNICODE)
+    using item_view = WItemView;
+    #else
+    using item_view = ItemView;
+    #endif
+
 protected:
 
     /// @brief container storing the items of the dropdown/combobox menu ...
+    ///        (one contiguous arena, see `BasicStrArena`)
+    #if defined(UNICODE) && defined(_UNICODE)
+    WStrArena itemsList; // arena of wide strings ...
+    #else
+    StrArena itemsList; // arena of narrow strings ...
+    #endif
+
+    /// @brief position of every item of `itemsList` by text,
+    ///        maintained upon insert/remove (O(1) membership, O(log n) positions)
+    #if defined(UNICODE) && defined(_UNICODE)
+    WItemIndex itemIndex;
+    #else
+    ItemIndex itemIndex;
+    #endif
+
+    /// @brief helper method to replace & index `itemsList`, repeated items being dropped
     #if defined(UNICODE) && defined(_UNICODE)
-    std::vector<std::wstring> itemsList; // vector of wide strings ...
+    void indexItems(const std::vector<std::wstring>& items)
     #else
-    std::vector<std::string> itemsList; // vector of narrow strings ...
+    void indexItems(const std::vector<std::string>& items)
     #endif
+    {
+        itemIndex.assign(items);
+        if (itemIndex.size() == items.size()) {
+            itemsList.assign(items);
+        } else {
+            itemsList.clear();
+            itemsList.reserve(itemIndex.size());
+            for (size_t i = 0; i < itemIndex.size(); i++) {
+                itemsList.push_back(itemIndex.at(i));
+            }
+        }
+        prefixDirty = true;
+    }
+
+    /// @brief the view shown by the control, `nullptr` if the items are added to the control
+    item_view* boundView = nullptr;
+
+    /// @brief   helper method to apply a change of `boundView` to the control
+    /// @details inserts & removes are pushed for the changed row only,
+    ///          a reset (i.e. new order/filter) populating the control again
+    void viewChanged(const item_view::Change& change) {
+
+        switch (change.kind) {
+
+            case item_view::Change::INSERT: {
+                const size_t row = change.pos;
+                itemIndex.insert(row, *change.item);
+                itemsList.insert(row, *change.item);
+                SendMessage(mhWnd, CB_INSERTSTRING, (WPARAM) row, (LPARAM) change.item->c_str());
+                prefixDirty = true;
+                if (selectedItemIndex >= (int) row) {
+                    selectedItemIndex++;
+                }
+                break;
+            }
+
+            case item_view::Change::REMOVE: {
+                // shifts `selectedItemIndex` as the insert above does
+                remove((int) change.pos);
+                break;
+            }
+
+            case item_view::Change::RESET: {
+                #if defined(UNICODE) && defined(_UNICODE)
+                std::vector<std::wstring> rows;
+                #else
+                std::vector<std::string> rows;
+                #endif
+                rows.reserve(boundView->size());
+                for (size_t i = 0; i < boundView->size(); i++) {
+                    rows.push_back(boundView->at(i));
+                }
+                indexItems(rows);
+                if (exists) {
+                    SendMessage(mhWnd, CB_RESETCONTENT, 0, 0);
+                    insertItems(0);
+                }
+                selectedItemIndex = -1;
+                break;
+            }
+        }
+    }
+
+    /// @brief sorted (case-insensitive) copy of the items for prefix searches,
+    ///        built upon the first search following a change of the items
+    ///        ~ UTF-8 in `UNICODE` builds (see `toIndexText(...)`)
+    StrTable prefixIndex;
+    /// @brief flag indicating whether `prefixIndex` is to be built again
+    bool prefixDirty = true;
+
+    /// @brief flag indicating whether typed characters select the items by prefix
+    bool typeAhead = true;
+    /// @brief the characters typed so far (encoded as `prefixIndex`)
+    std::string typedText;
+    /// @brief the range of `prefixIndex` starting with `typedText`
+    std::pair<size_t, size_t> typedRange;
+    /// @brief time of the last typed character (see `xTimer::now()`)
+    unsigned long long typedTime = 0;
+    /// @brief idle time (in milliseconds) after which typing starts over
+    unsigned long long typeAheadTimeout = 1000;
+
+    /// @brief helper method to convert the text of an item to the text of `prefixIndex`,
+    ///        i.e. UTF-8 (lossless) rather than narrowed in `UNICODE` builds
+    static std::string toIndexText(const std::basic_string<TCHAR>& text) {
+        #if defined(UNICODE) && defined(_UNICODE)
+        std::string utf8;
+        utf8.reserve(text.size());
+        for (size_t i = 0; i < text.size(); ) {
+            Utf::append(utf8, Utf::next(text.data(), text.size(), i));
+        }
+        return utf8;
+        #else
+        return text;
+        #endif
+    }
+
+    /// @brief helper method to convert the text of `prefixIndex` back to the text of an item
+    static std::basic_string<TCHAR> fromIndexText(const std::string& text) {
+        #if defined(UNICODE) && defined(_UNICODE)
+        std::wstring wide;
+        wide.reserve(text.size());
+        for (size_t i = 0; i < text.size(); ) {
+            Utf::append(wide, Utf::next(text.data(), text.size(), i));
+        }
+        return wide;
+        #else
+        return text;
+        #endif
+    }
+
+    /// @brief helper method to retrieve `prefixIndex`, built again if the items changed
+    const StrTable& getPrefixIndex() {
+        if (prefixDirty) {
+            std::vector<std::string> names;
+            names.reserve(itemsList.size());
+            for (size_t i = 0; i < itemsList.size(); i++) {
+                names.push_back(toIndexText(itemsList.str(i)));
+            }
+            prefixIndex.assign(std::move(names));
+            prefixDirty = false;
+            // the range refers to the previous table ...
+            typedText.clear();
+        }
+        return prefixIndex;
+    }
+
+    /// @brief   helper method to select the first item starting with the typed characters
+    /// @param[in] c ~ the typed character (`VK_BACK` to drop the last one)
+    /// @details every character narrows the range of the previous ones (O(log n)),
+    ///          typing after `typeAheadTimeout` of idle time starts over
+    void typeAheadChar(TCHAR c) {
+
+        const StrTable& table = getPrefixIndex();
+        const unsigned long long now = xTimer::now();
+
+        if (typedText.empty() || now - typedTime > typeAheadTimeout) {
+            typedText.clear();
+            typedRange = std::make_pair((size_t) 0, table.size());
+        }
+        typedTime = now;
+
+        if (c == VK_BACK) {
+            if (typedText.empty()) { return; }
+            // the range of a shorter prefix is wider ~ search it again
+            #if defined(UNICODE) && defined(_UNICODE)
+            // ... the whole (multi-byte) character
+            while (typedText.size() > 1 && (typedText.back() & 0xC0) == 0x80) {
+                typedText.pop_back();
+            }
+            #endif
+            typedText.pop_back();
+            typedRange = table.prefixRange(typedText);
+        } else {
+            typedText += toIndexText(std::basic_string<TCHAR>(1, c));
+            typedRange = table.prefixRange(typedText, typedRange);
+        }
+
+        if (typedText.empty() || typedRange.first >= typedRange.second) {
+            return;
+        }
+
+        const size_t idx = itemIndex.find(fromIndexText(table.str(typedRange.first)));
+        if (idx < itemsList.size() && (int) idx != selectedItemIndex) {
+            select((int) idx);
+        }
+    }
 
     /// @brief protected method to retrieve the type name
     virtual LPCTSTR TypeName() const override { return WC_COMBOBOX; }
@@ -134,6 +356,8 @@ protected:
     /// @brief protected override method to update the font
     ///        since additional logic is to be performed
     virtual void updateFont() override {
+        // the rows rendered with the former font go (its handle may be reused) ...
+        rowCache.clear();
         // ensure that the control exists ...
         if (exists) {
             // get the font hight/size ...
@@ -146,6 +370,42 @@ protected:
         }
     }
 
+    /// @brief flag indicating whether the items are drawn by the control (see `setOwnerDraw()`)
+    bool ownerDraw = false;
+    /// @brief the rendered items (owner-drawn mode)
+    xRowCache rowCache;
+
+    /// @brief   helper method to draw an item (owner-drawn mode, `WM_DRAWITEM`)
+    /// @details items are rendered once & blitted from `rowCache` afterwards
+    void drawRow(LPDRAWITEMSTRUCT lpDIS) {
+
+        // no item (i.e. empty selection field) => background & focus only ...
+        if (lpDIS->itemID == (UINT) -1 || lpDIS->itemID >= itemsList.size()) {
+            HBRUSH hBrush = CreateSolidBrush(rowStyle().background);
+            FillRect(lpDIS->hDC, &lpDIS->rcItem, hBrush);
+            DeleteObject(hBrush);
+            if (lpDIS->itemState & ODS_FOCUS) {
+                DrawFocusRect(lpDIS->hDC, &lpDIS->rcItem);
+            }
+            return;
+        }
+
+        const bool selected = (lpDIS->itemState & ODS_SELECTED) != 0;
+        rowCache.draw(lpDIS, itemsList.str(lpDIS->itemID), selected, rowStyle());
+    }
+
+    /// @brief helper method to retrieve the colours & font of the (owner-drawn) rows,
+    ///        the widget colours if set, otherwise the system ones
+    xRowCache::Style rowStyle() {
+        xRowCache::Style style;
+        style.font = pFont ? pFont->hFont : (HFONT) GetStockObject(DEFAULT_GUI_FONT);
+        style.background = colorBG ? colorBG : GetSysColor(COLOR_WINDOW);
+        style.text = colorFG ? colorFG : GetSysColor(COLOR_WINDOWTEXT);
+        style.selectedBackground = GetSysColor(COLOR_HIGHLIGHT);
+        style.selectedText = GetSysColor(COLOR_HIGHLIGHTTEXT);
+        return style;
+    }
+
     /// @brief method to programatically show the dropdown menu, i.e. expand
     void show() {
         if (exists) {
@@ -163,14 +423,28 @@ protected:
     /// @brief method to initialize the dropdown items
     /// by inserting the vector elements into the view
     void init() {
+        insertItems(0);
+    }
 
-        for (size_t i = 0; i < itemsList.size(); i++) {
-            
-            SendMessage(
-                mhWnd, CB_INSERTSTRING, (WPARAM) NULL,
-                (LPARAM)itemsList[itemsList.size()-i-1].c_str()
-            );
+    /// @brief   helper method to append the items of `itemsList` from `first` to the view
+    /// @details storage is reserved up front (`CB_INITSTORAGE`) & redraw is suspended
+    ///          for the batch, the control being repainted once
+    void insertItems(size_t first) {
+
+        if (!exists || first >= itemsList.size()) { return; }
+
+        size_t bytes = 0;
+        for (size_t i = first; i < itemsList.size(); i++) {
+            bytes += (itemsList.length(i) + 1) * sizeof(TCHAR);
+        }
+
+        SendMessage(mhWnd, WM_SETREDRAW, FALSE, 0);
+        SendMessage(mhWnd, CB_INITSTORAGE, (WPARAM) (itemsList.size() - first), (LPARAM) bytes);
+        for (size_t i = first; i < itemsList.size(); i++) {
+            SendMessage(mhWnd, CB_INSERTSTRING, (WPARAM) -1, (LPARAM) itemsList.c_str(i));
         }
+        SendMessage(mhWnd, WM_SETREDRAW, TRUE, 0);
+        InvalidateRect(mhWnd, NULL, TRUE);
     }
 
 public:
@@ -186,11 +460,9 @@ public:
         std::string temp = text;
         #endif
         
-        for (size_t idx = 0; idx < itemsList.size(); idx++) {
-            if (itemsList[idx] == temp) {
-                select(idx);
-                break;
-            }
+        const size_t idx = itemIndex.find(temp);
+        if (idx < itemsList.size()) {
+            select((int) idx);
         }
     }
 
@@ -227,7 +499,7 @@ public:
 
         // invoke on-selection-change callback trigger action ...
         if (mOnSelectionChange) {
-            mOnSelectionChange(this, selectedItemIndex);
+            selectionGate.post(); // now or deferred (see `setOnSelectionChange(..., policy)`)
         }
     }
 
@@ -239,9 +511,9 @@ public:
     /// @brief method to retrieve the selected item string text
     std::string getSelectedItem() {        
         #if defined(UNICODE) && defined(_UNICODE)
-        return StrConverter::WStringToString(itemsList[selectedItemIndex]);
+        return StrConverter::WStringToString(itemsList.str(selectedItemIndex));
         #else
-        return itemsList[selectedItemIndex];
+        return itemsList.str(selectedItemIndex);
         #endif
     }
 
@@ -352,20 +624,10 @@ public:
     bool checkItem(const std::string& item) {
 
         #if defined(UNICODE) && defined(_UNICODE)
-        std::wstring temp = StrConverter::StringToWString(item);
-        std::vector<std::wstring>::iterator i;
+        return itemIndex.contains(StrConverter::StringToWString(item));
         #else
-        std::string temp = item;
-        std::vector<std::string>::iterator i;
+        return itemIndex.contains(item);
         #endif
-
-        i = std::find(itemsList.begin(), itemsList.end(), temp);
-
-        if (i != itemsList.end()) {
-            return true;
-        }
-
-        return false;
     }
 
     /// @brief method to add/insert new items into the dropdown menu
@@ -387,26 +649,17 @@ public:
 
         // std::cout << "index: " << i << std::endl;
 
-        #if defined(UNICODE) && defined(_UNICODE)
-        if (
-            !checkItem(
-                StrConverter::WStringToString(temp)
-            )
-        ) {
-            // insert the item at the specified index 
-            itemsList.insert(itemsList.begin() + i, temp);
-        }
-        #else
-        if (!checkItem(temp)) {
-            // insert the item at the specified index 
-            itemsList.insert(itemsList.begin() + i, temp);
+        // skip an item already listed (i.e. also contained in the view) ...
+        if (!itemIndex.insert(i, temp)) {
+            return;
         }
-        #endif
 
-        // also ensure the item is not contained in the view ...
+        // insert the item at the specified index 
+        itemsList.insert(i, temp);
 
         // insert into the control's view ...
         SendMessage(mhWnd, CB_INSERTSTRING, (WPARAM) i, (LPARAM) temp.c_str());
+        prefixDirty = true;
 
         // if (index == selectedItemIndex) {
         //     select(selectedItemIndex);
@@ -418,14 +671,28 @@ public:
     /// @brief method to insert/add new items into the dropdown/combox control
     /// @param items ~ vector container of the items to insert
     /// @param index ~ integer representative of the selected item index
+    /// @details items already listed (or repeated in `items`) are skipped through `itemIndex`,
+    ///          the others appended to the view in a single batch (see `insertItems(...)`)
     void add(const std::vector<std::string>& items, int index = - 1) {
 
-        // ... 
+        const size_t first = itemsList.size();
+        itemsList.reserve(items.size());
 
         // add the items to the combobox/dropdown's vector container ...
         for (size_t i = 0; i < items.size(); i++) {
-            add(items[i]);
+            #if defined(UNICODE) && defined(_UNICODE)
+            std::wstring temp = StrConverter::StringToWString(items[i]);
+            #else
+            const std::string& temp = items[i];
+            #endif
+            if (itemIndex.push_back(temp)) {
+                itemsList.push_back(temp);
+            }
         }
+        prefixDirty = prefixDirty || itemsList.size() != first;
+
+        // ... then to the view, at once
+        insertItems(first);
         select(index);
     }
 
@@ -439,11 +706,9 @@ public:
         std::string temp = item;
         #endif
 
-        for (size_t i = 0; i < itemsList.size(); i++) {
-            if (temp == itemsList[i]) {
-                remove(i); // remove by index found ...
-                break;
-            }
+        const size_t i = itemIndex.find(temp);
+        if (i < itemsList.size()) {
+            remove((int) i); // remove by index found ...
         }
     }
 
@@ -452,7 +717,7 @@ public:
     ///            the position for the item to removed
     void remove(int index) {
 
-        if (index < 0 || index > count()) {
+        if (index < 0 || index >= count()) {
             // throw exception, index out of range ...
             return;
         };
@@ -463,13 +728,18 @@ public:
         // check whether the item was remove from the combobox ...
         if (result != CB_ERR) {
             // remove the item from the vector container
-            itemsList.erase(itemsList.begin() + index);
+            itemsList.erase(index);
+            itemIndex.eraseAt(index);
+            prefixDirty = true;
         }
 
         // ensure that if the removed item was selected,
         // then select the first item in the list ...
         if (index == selectedItemIndex) {
             select(0);
+        } else if (result != CB_ERR && index < selectedItemIndex) {
+            // ... otherwize the selected item moved up a row
+            selectedItemIndex--;
         }
     }
 
@@ -479,9 +749,109 @@ public:
     std::string getItemByIndex(int index) {
 
         #if defined(UNICODE) && defined(_UNICODE)
-        return StrConverter::WStringToString(itemsList[index]);
+        return StrConverter::WStringToString(itemsList.str(index));
+        #else
+        return itemsList.str(index);
+        #endif
+    }
+
+    /// @brief     method to show the rows of a view of an item model, the control being
+    ///            kept up to date as the model changes (see `BasicItemView`)
+    /// @param[in] view ~ the view to show (`nullptr` to stop following the view)
+    /// @details   only the changed rows are pushed to the control; the items are those
+    ///            of the view, i.e. not to be added/removed through the control
+    /// @note      the view is to outlive the control (or to be unbound)
+    void bind(item_view* view) {
+
+        if (boundView) {
+            boundView->setOnChange(nullptr);
+        }
+        boundView = view;
+        if (boundView) {
+            boundView->setOnChange([this](const item_view::Change& change) { viewChanged(change); });
+            viewChanged(item_view::Change{ item_view::Change::RESET, 0, nullptr });
+        }
+    }
+
+    /// @brief method to retrieve the view shown by the control, `nullptr` if none
+    item_view* getView() {
+        return boundView;
+    }
+
+    /// @brief   method to switch the dropdown to owner-drawn mode, the items being drawn
+    ///          with the widget colours & font (see `rowStyle()`)
+    /// @details every item is rendered once per text, state, size & style, then blitted
+    ///          from `rowCache`, i.e. scrolling back & (de)selecting items mostly blit
+    /// @note    to be invoked before `create()`
+    void setOwnerDraw() {
+
+        if (exists) {
+            LOG("xDropDown::setOwnerDraw() ~ to be invoked before create()");
+            return;
+        }
+
+        appendWindowStyle(CBS_OWNERDRAWFIXED | CBS_HASSTRINGS);
+        ownerDraw = true;
+    }
+
+    /// @brief method to check whether the dropdown is owner-drawn
+    bool isOwnerDraw() {
+        return ownerDraw;
+    }
+
+    /// @brief method to retrieve the cache of rendered items (owner-drawn mode),
+    ///        i.e. for its counters or to change its capacity
+    xRowCache& getRowCache() {
+        return rowCache;
+    }
+
+    /// @brief method to retrieve the items starting with `prefix` (ignoring case),
+    ///        e.g. the suggestions of an auto-complete popup
+    /// @param[in] prefix ~ string representative of the typed prefix
+    /// @param[in] max ~ maximum number of items to retrieve
+    /// @return    vector of the items found, in (case-insensitive) alphabetical order
+    std::vector<std::string> getCompletions(const std::string& prefix, size_t max = 16) {
+
+        const StrTable& table = getPrefixIndex();
+        #if defined(UNICODE) && defined(_UNICODE)
+        const std::pair<size_t, size_t> range = table.prefixRange(toIndexText(StrConverter::StringToWString(prefix)));
         #else
-        return itemsList[index];
+        const std::pair<size_t, size_t> range = table.prefixRange(prefix);
+        #endif
+
+        std::vector<std::string> completions;
+        for (size_t i = range.first; i < range.second && completions.size() < max; i++) {
+            #if defined(UNICODE) && defined(_UNICODE)
+            completions.push_back(StrConverter::WStringToString(fromIndexText(table.str(i))));
+            #else
+            completions.push_back(table.str(i));
+            #endif
+        }
+        return completions;
+    }
+
+    /// @brief method to enable/disable selecting items by typing their first characters
+    void setTypeAhead(bool flag) {
+        typeAhead = flag;
+        typedText.clear();
+    }
+
+    /// @brief method to check whether typing selects items by their first characters
+    bool getTypeAhead() {
+        return typeAhead;
+    }
+
+    /// @brief method to set the idle time (in milliseconds) after which typing starts over
+    void setTypeAheadTimeout(unsigned long long timeout) {
+        typeAheadTimeout = timeout;
+    }
+
+    /// @brief method to retrieve the characters typed so far
+    std::string getTypeAheadText() {
+        #if defined(UNICODE) && defined(_UNICODE)
+        return StrConverter::WStringToString(fromIndexText(typedText));
+        #else
+        return typedText;
         #endif
     }
 
@@ -495,18 +865,42 @@ public:
     }
     #endif
 
-    /// @todo  override custom drawing to be implemented
-    ///        when background color & text color
-    ///        is to be dynamically changed/adjusted
+    /// @brief override custom drawing of the items (owner-drawn mode, see `setOwnerDraw()`)
     virtual LRESULT CustomDraw(UINT msg, WPARAM wParam, LPARAM lParam) override {
         
-        IMPLICIT(msg);
         IMPLICIT(wParam);
-        IMPLICIT(lParam);
+
+        if (msg == WM_DRAWITEM && ownerDraw) {
+            drawRow((LPDRAWITEMSTRUCT) lParam);
+            return TRUE;
+        }
 
         return 0;
     }
 
+    /// @brief   override method selecting items by the typed characters (see `typeAheadChar(...)`)
+    /// @details consumes printable characters & backspace, in place of the
+    ///          control's own (first character only) search, except the halves of
+    ///          surrogate pairs, which cannot be indexed one at a time
+    virtual bool InterceptMessage(UINT msg, WPARAM wParam, LPARAM lParam, LRESULT& result) override {
+
+        UNUSED(lParam);
+
+        if (!typeAhead || msg != WM_CHAR || (wParam < 0x20 && wParam != VK_BACK)) {
+            return false;
+        }
+
+        #if defined(UNICODE) && defined(_UNICODE)
+        if (wParam >= 0xD800 && wParam <= 0xDFFF) {
+            return false; // i.e. the control's own search
+        }
+        #endif
+
+        typeAheadChar((TCHAR) wParam);
+        result = 0;
+        return true;
+    }
+
     /// @brief `xDropDown` derived class main message loop ...
     virtual LRESULT HandleMessage(UINT msg, WPARAM wParam, LPARAM lParam) override {
 
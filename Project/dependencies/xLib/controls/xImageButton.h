@@ -108,7 +108,7 @@ public:
         if (m_w == -1 || m_h == -1) {
 
             // check whether image was loaded ...
-            if (pImage->img != nullptr) {
+            if (pImage && pImage->ensureLoaded()) {
 
                 m_w = pImage->width();
                 m_h = pImage->height();
@@ -240,6 +240,21 @@ public:
         return pGif->isAnimating();
     }
 
+    /// @todo do some safety checks to prevent crash for non-gif images ...
+    /// @brief method to retrieve the number of pixels repainted per second of animation
+    double getPixelsPerSecond() {
+        xGif* pGif = static_cast<xGif*>(pImage);
+        return pGif->pixelsPerSecond();
+    }
+
+    /// @todo do some safety checks to prevent crash for non-gif images ...
+    /// @brief method to retrieve the number of pixels per second of animation
+    ///        that repainting every frame in full would have cost
+    double getFullPixelsPerSecond() {
+        xGif* pGif = static_cast<xGif*>(pImage);
+        return pGif->fullPixelsPerSecond();
+    }
+
 protected:
 
     /// @brief variable to toggle whether the text appears
@@ -263,8 +278,8 @@ void xImageButton::draw(xWidget* pWidget) {
     /// for preserving the borders, etc ...
     xButton::draw(this);
 
-    // draw the image if not `nullptr`
-    if (pImage->img != nullptr) {
+    // draw the image if loaded (`drawImage(...)` re-decodes an evicted image)
+    if (pImage && !pImage->loadFailed) {
         // if the image exists ...
         pImage->drawImage(this);
     }
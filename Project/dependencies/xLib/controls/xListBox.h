@@ -33,11 +33,53 @@ protected:
     #define HEIGHT_DEFAULT_LISTBOX 18
     /// @brief default width for listbox controls
     #define WIDTH_DEFAULT_LISTBOX  150
+    /// @brief message posted (by the producer thread) once a page of rows is ready
+    #define WM_LISTBOX_PAGE (WM_APP + 0x41)
 
     /// @brief variables storing the selected item index
     /// @note -1 indicates no item selected ...
     int selectedItemIndex = -1;
 
+public:
+
+    /// @brief alias for the function providing the text of a row (virtual mode)
+    using row_source = std::function<std::string(size_t row)>;
+
+    /// @brief alias for the function reporting whether a row is selected (virtual mode)
+    using row_selection = std::function<bool(size_t row)>;
+
+    /// @brief alias for the views of an item model the control shows (see `bind(...)`)
+    #if defined(UNICODE) && defined(_UNICODE)
+    using item_view = WItemView;
+    #else
+    using item_view = ItemView;
+    #endif
+
+    /// @brief alias for the producer streaming the rows (see `setSource(...)`)
+    using page_producer = PageQueue::producer_type;
+
+protected:
+
+    /// @brief flag indicating whether the rows are provided by `rowSource`
+    ///        rather than stored by the control (see `setVirtual(...)`)
+    bool virtualMode = false;
+    /// @brief number of rows in virtual mode
+    size_t virtualRows = 0;
+    /// @brief function providing the text of a row (virtual mode)
+    row_source rowSource = nullptr;
+    /// @brief function reporting the selection of a row (virtual mode, optional)
+    row_selection rowSelection = nullptr;
+
+    /// @brief number of rows drawn (virtual mode)
+    size_t rowsDrawn = 0;
+    /// @brief time taken by the last `init()` to populate the control (in microseconds)
+    long long populateTime = 0;
+
+    /// @brief flag indicating whether the rows are drawn by the control (see `setOwnerDraw()`)
+    bool ownerDraw = false;
+    /// @brief the rendered rows (owner-drawn & virtual modes)
+    xRowCache rowCache;
+
 public:
 
     /// @brief public default/parameterless constructor
@@ -76,9 +118,9 @@ public:
         // setBackgroundColor(parent->colorBG);
 
         #if defined(UNICODE) && defined(_UNICODE)
-        itemsList = StrConverter::VectorToWideString(items);
+        indexItems(StrConverter::VectorToWideString(items));
         #else
-        itemsList = items;
+        indexItems(items);
         #endif
 
         selectedItemIndex = index;
@@ -108,14 +150,21 @@ public:
         // setBackgroundColor(parent->colorBG);
 
         #if defined(UNICODE) && defined(_UNICODE)
-        itemsList = StrConverter::VectorToWideString(items);
+        indexItems(StrConverter::VectorToWideString(items));
         #else
-        itemsList = items;
+        indexItems(items);
         #endif
 
         selectedItemIndex = index;
     }
 
+    /// @brief destructor ~ stops the producer (see `setSource(...)`)
+    ///        & following the bound view (see `bind(...)`)
+    ~xListBox() {
+        cancelSource();
+        bind(nullptr);
+    }
+
     /// @brief interface override method to attach
     ///        on-selection-change callback action
     ///        `WM_COMMAND` => `LBN_SELCHANGE`
@@ -127,15 +176,209 @@ public:
         mOnSelectionChange = std::move(callback);
     }
 
+    /// @brief method to attach on-selection-change callback action
+    ///        delivered according to a policy, i.e. `EventPolicy::debounce(150)`
+    ///        for listeners filtering/loading upon selection
+    /// @param callback ~ function pointer of the action
+    /// @param policy ~ delivery policy (a burst of changes is delivered once)
+    void setOnSelectionChange(event_onSelectionChange callback, EventPolicy policy) {
+        setOnSelectionChange(std::move(callback));
+        selectionGate.setPolicy(policy);
+    }
+
+    /// @brief method to retrieve the gate delivering selection-change events,
+    ///        i.e. for the delivered/dropped counters or to `flush()` a pending event
+    xEventGate& getSelectionGate() {
+        return selectionGate;
+    }
+
 protected:
 
-    /// @brief container storing the items of the dropdown/combobox menu ...
+    /// @brief delivers selection-change events according to a policy (immediate by default),
+    ///        the listener receiving the selection at the time of delivery
+    xEventGate selectionGate{ [this]() {
+        if (mOnSelectionChange) {
+            mOnSelectionChange(this, selectedItemIndex);
+        }
+    } };
+
+protected:
+
+    /// @brief container storing the items of the listbox ...
+    ///        (one contiguous arena, see `BasicStrArena`)
     #if defined(UNICODE) && defined(_UNICODE)
-    std::vector<std::wstring> itemsList; // vector of wide strings ...
+    WStrArena itemsList; // arena of wide strings ...
     #else
-    std::vector<std::string> itemsList; // vector of narrow strings ...
+    StrArena itemsList; // arena of narrow strings ...
     #endif
 
+    /// @brief position of every item of `itemsList` by text,
+    ///        maintained upon insert/remove (O(1) membership, O(log n) positions)
+    #if defined(UNICODE) && defined(_UNICODE)
+    WItemIndex itemIndex;
+    #else
+    ItemIndex itemIndex;
+    #endif
+
+    /// @brief helper method to replace & index `itemsList`, repeated items being dropped
+    #if defined(UNICODE) && defined(_UNICODE)
+    void indexItems(const std::vector<std::wstring>& items)
+    #else
+    void indexItems(const std::vector<std::string>& items)
+    #endif
+    {
+        itemIndex.assign(items);
+        if (itemIndex.size() == items.size()) {
+            itemsList.assign(items);
+        } else {
+            itemsList.clear();
+            itemsList.reserve(itemIndex.size());
+            for (size_t i = 0; i < itemIndex.size(); i++) {
+                itemsList.push_back(itemIndex.at(i));
+            }
+        }
+    }
+
+    /// @brief protected method invoked once a row is inserted at `row` (not appended in bulk),
+    ///        i.e. for derived classes keeping state per row
+    virtual void rowInserted(size_t row) { IMPLICIT(row); }
+
+    /// @brief protected method invoked once the row at `row` is removed
+    virtual void rowRemoved(size_t row) { IMPLICIT(row); }
+
+    /// @brief protected method invoked once every row is replaced (see `viewChanged(...)`)
+    virtual void rowsReset() { }
+
+    /// @brief the view shown by the control, `nullptr` if the items are added to the control
+    item_view* boundView = nullptr;
+
+    /// @brief   helper method to apply a change of `boundView` to the control
+    /// @details inserts & removes are pushed for the changed row only,
+    ///          a reset (i.e. new order/filter) populating the control again
+    void viewChanged(const item_view::Change& change) {
+
+        switch (change.kind) {
+
+            case item_view::Change::INSERT: {
+                const size_t row = change.pos;
+                itemIndex.insert(row, *change.item);
+                itemsList.insert(row, *change.item);
+                SendMessage(mhWnd, LB_INSERTSTRING, (WPARAM) row, (LPARAM) change.item->c_str());
+                if (selectedItemIndex >= (int) row) {
+                    selectedItemIndex++;
+                }
+                rowInserted(row);
+                break;
+            }
+
+            case item_view::Change::REMOVE: {
+                // shifts `selectedItemIndex` as the insert above does
+                remove((int) change.pos);
+                break;
+            }
+
+            case item_view::Change::RESET: {
+                #if defined(UNICODE) && defined(_UNICODE)
+                std::vector<std::wstring> rows;
+                #else
+                std::vector<std::string> rows;
+                #endif
+                rows.reserve(boundView->size());
+                for (size_t i = 0; i < boundView->size(); i++) {
+                    rows.push_back(boundView->at(i));
+                }
+                indexItems(rows);
+                if (exists) {
+                    SendMessage(mhWnd, LB_RESETCONTENT, 0, 0);
+                    insertItems(0);
+                }
+                selectedItemIndex = -1;
+                rowsReset();
+                break;
+            }
+        }
+    }
+
+    /// @brief the pages streamed by the producer of `setSource(...)`, `nullptr` if none
+    std::unique_ptr<PageQueue> pageQueue;
+    /// @brief number of pages requested ahead of the rows in view
+    size_t pagesAhead = 2;
+
+    /// @brief helper method (UI thread) appending the pages ready to the control,
+    ///        each page in a single batch (see `insertItems(...)`)
+    void receivePages() {
+
+        PageQueue::page_type page;
+        while (pageQueue->pop(page)) {
+            const size_t first = itemsList.size();
+            itemsList.reserve(page.size());
+            for (size_t i = 0; i < page.size(); i++) {
+                #if defined(UNICODE) && defined(_UNICODE)
+                std::wstring temp = StrConverter::StringToWString(page[i]);
+                #else
+                const std::string& temp = page[i];
+                #endif
+                if (itemIndex.push_back(temp)) {
+                    itemsList.push_back(temp);
+                }
+            }
+            insertItems(first);
+        }
+    }
+
+    /// @brief helper method requesting pages once the rows in view near the last row received,
+    ///        i.e. less than a screen of rows is left below the view
+    void requestPages() {
+
+        if (pageQueue->finished()) { return; }
+
+        size_t top = 0;
+        size_t visible = 1;
+        if (exists) {
+            top = (size_t) SendMessage(mhWnd, LB_GETTOPINDEX, 0, 0);
+            const LRESULT height = SendMessage(mhWnd, LB_GETITEMHEIGHT, 0, 0);
+            RECT rect;
+            GetClientRect(mhWnd, &rect);
+            if (height > 0) {
+                visible = (size_t) ((rect.bottom - rect.top) / height) + 1;
+            }
+        }
+
+        if (top + 2 * visible >= itemsList.size()) {
+            pageQueue->request(pagesAhead);
+        }
+    }
+
+    /// @brief   override method receiving the pages of the producer (`WM_LISTBOX_PAGE`)
+    /// @details scrolling (scrollbar, wheel & keys) requests pages, but is not consumed
+    virtual bool InterceptMessage(UINT msg, WPARAM wParam, LPARAM lParam, LRESULT& result) override {
+
+        UNUSED(wParam);
+        UNUSED(lParam);
+
+        if (!pageQueue) {
+            return false;
+        }
+
+        switch(msg) {
+
+            case WM_LISTBOX_PAGE: {
+                receivePages();
+                requestPages();
+                result = 0;
+                return true;
+            }
+
+            case WM_VSCROLL:
+            case WM_MOUSEWHEEL:
+            case WM_KEYDOWN: {
+                requestPages();
+                break;
+            }
+        }
+        return false;
+    }
+
     /// @brief protected method to retrieve the type name
     virtual LPCTSTR TypeName() const override { return WC_LISTBOX; }
     /// @brief protected method to retrieve the class name
@@ -144,6 +387,8 @@ protected:
     /// @brief protected override method to update the font
     ///        since additional logic is to be performed
     virtual void updateFont() override {
+        // the rows rendered with the former font go (its handle may be reused) ...
+        rowCache.clear();
         // ensure that the control exists ...
         if (exists) {
             // get the font hight/size ...
@@ -172,15 +417,87 @@ protected:
 
     /// @brief method to initialize the listbox items
     /// by inserting the vector elements into the view
+    /// @note  in virtual mode only the number of rows is set
     void init() {
 
-        for (size_t i = 0; i < itemsList.size(); i++) {
-            
-            SendMessage(
-                mhWnd, LB_INSERTSTRING, (WPARAM) NULL,
-                (LPARAM)itemsList[itemsList.size()-i-1].c_str()
-            );
+        auto start = std::chrono::steady_clock::now();
+
+        if (virtualMode) {
+            SendMessage(mhWnd, LB_SETCOUNT, (WPARAM) virtualRows, 0);
+        } else {
+            insertItems(0);
+        }
+
+        populateTime = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start
+        ).count();
+    }
+
+    /// @brief   helper method to append the items of `itemsList` from `first` to the view
+    /// @details storage is reserved up front (`LB_INITSTORAGE`) & redraw is suspended
+    ///          for the batch, the control being repainted once
+    void insertItems(size_t first) {
+
+        if (!exists || first >= itemsList.size()) { return; }
+
+        size_t bytes = 0;
+        for (size_t i = first; i < itemsList.size(); i++) {
+            bytes += (itemsList.length(i) + 1) * sizeof(TCHAR);
+        }
+
+        SendMessage(mhWnd, WM_SETREDRAW, FALSE, 0);
+        SendMessage(mhWnd, LB_INITSTORAGE, (WPARAM) (itemsList.size() - first), (LPARAM) bytes);
+        for (size_t i = first; i < itemsList.size(); i++) {
+            SendMessage(mhWnd, LB_INSERTSTRING, (WPARAM) -1, (LPARAM) itemsList.c_str(i));
+        }
+        SendMessage(mhWnd, WM_SETREDRAW, TRUE, 0);
+        InvalidateRect(mhWnd, NULL, TRUE);
+    }
+
+    /// @brief   helper method to draw a row (owner-drawn & virtual modes, `WM_DRAWITEM`)
+    /// @details only the rows in view are requested from `rowSource` (virtual mode),
+    ///          the selection being read from `rowSelection` if provided <br/>
+    ///          rows are rendered once & blitted from `rowCache` afterwards
+    void drawRow(LPDRAWITEMSTRUCT lpDIS) {
+
+        HDC hDC = lpDIS->hDC;
+
+        // empty list => focus rectangle only ...
+        if (lpDIS->itemID == (UINT) -1) {
+            if (lpDIS->itemAction & ODA_FOCUS) {
+                DrawFocusRect(hDC, &lpDIS->rcItem);
+            }
+            return;
+        }
+
+        const size_t row = lpDIS->itemID;
+        if (!virtualMode && row >= itemsList.size()) {
+            return;
         }
+        const bool selected = rowSelection
+            ? rowSelection(row)
+            : (lpDIS->itemState & ODS_SELECTED) != 0;
+
+        #if defined(UNICODE) && defined(_UNICODE)
+        std::wstring text = virtualMode ? StrConverter::StringToWString(rowSource(row)) : itemsList.str(row);
+        #else
+        std::string text = virtualMode ? rowSource(row) : itemsList.str(row);
+        #endif
+
+        rowCache.draw(lpDIS, text, selected, rowStyle());
+        rowsDrawn++;
+    }
+
+    /// @brief helper method to retrieve the colours & font of the (owner-drawn) rows,
+    ///        the widget colours if set, otherwise the system ones
+    xRowCache::Style rowStyle() {
+        xRowCache::Style style;
+        style.font = pFont ? pFont->hFont : (HFONT) GetStockObject(DEFAULT_GUI_FONT);
+        style.background = colorBG ? colorBG : GetSysColor(COLOR_WINDOW);
+        style.text = colorFG ? colorFG : GetSysColor(COLOR_WINDOWTEXT);
+        style.selectedBackground = GetSysColor(COLOR_HIGHLIGHT);
+        style.selectedText = GetSysColor(COLOR_HIGHLIGHTTEXT);
+        return style;
     }
 
 protected:
@@ -195,6 +512,173 @@ protected:
 
 public:
 
+    /// @brief     method to switch the listbox to virtual (owner-data) mode
+    /// @param[in] rows ~ number of rows
+    /// @param[in] source ~ function providing the text of a row, invoked for the rows in view only
+    /// @param[in] selection ~ function reporting whether a row is selected (optional),
+    ///            i.e. the selection kept by the model rather than the control
+    /// @details   the control stores no strings (`LBS_NODATA`) & draws the rows itself
+    ///            (`LBS_OWNERDRAWFIXED`), so populating is independent of the number of rows
+    /// @note      to be invoked before `create()`, the items of the list being discarded
+    void setVirtual(size_t rows, row_source source, row_selection selection = nullptr) {
+
+        if (exists) {
+            LOG("xListBox::setVirtual(...) ~ to be invoked before create()");
+            return;
+        }
+
+        appendWindowStyle(LBS_NODATA | LBS_OWNERDRAWFIXED);
+        itemsList.clear();
+        itemIndex.clear();
+
+        virtualMode = true;
+        virtualRows = rows;
+        rowSource = std::move(source);
+        rowSelection = std::move(selection);
+    }
+
+    /// @brief   method to switch the listbox to owner-drawn mode, the rows being drawn
+    ///          with the widget colours & font (see `rowStyle()`)
+    /// @details every row is rendered once per text, state, size & style, then blitted
+    ///          from `rowCache`, i.e. scrolling back & (de)selecting rows mostly blit
+    /// @note    to be invoked before `create()`; virtual mode is owner-drawn already
+    void setOwnerDraw() {
+
+        if (exists) {
+            LOG("xListBox::setOwnerDraw() ~ to be invoked before create()");
+            return;
+        }
+
+        appendWindowStyle(LBS_OWNERDRAWFIXED | LBS_HASSTRINGS);
+        ownerDraw = true;
+    }
+
+    /// @brief method to check whether the listbox is owner-drawn
+    bool isOwnerDraw() {
+        return ownerDraw || virtualMode;
+    }
+
+    /// @brief method to retrieve the cache of rendered rows (owner-drawn & virtual modes),
+    ///        i.e. for its counters or to change its capacity
+    xRowCache& getRowCache() {
+        return rowCache;
+    }
+
+    /// @brief     method to update the number of rows (virtual mode)
+    /// @param[in] rows ~ number of rows
+    /// @note      the selection is cleared by the control
+    void setRowCount(size_t rows) {
+
+        if (!virtualMode) { return; }
+
+        virtualRows = rows;
+        if (exists) {
+            SendMessage(mhWnd, LB_SETCOUNT, (WPARAM) virtualRows, 0);
+        }
+    }
+
+    /// @brief method to redraw the rows in view,
+    ///        i.e. after the model changed the text or selection of rows (virtual mode)
+    void refreshRows() {
+        if (exists) {
+            InvalidateRect(mhWnd, NULL, FALSE);
+        }
+    }
+
+    /// @brief method to check whether the listbox is in virtual mode
+    bool isVirtual() {
+        return virtualMode;
+    }
+
+    /// @brief method to retrieve the number of rows drawn (virtual mode)
+    size_t getRowsDrawn() {
+        return rowsDrawn;
+    }
+
+    /// @brief method to retrieve the time taken to populate the control (in microseconds)
+    long long getPopulateTime() {
+        return populateTime;
+    }
+
+    #ifndef NDEBUG
+    /// @brief method to Log the population & drawing counters (DEBUG)
+    void LogListBoxData() {
+        LOG(("List rows: " + std::to_string(count())).c_str());
+        LOG(("List virtual: " + std::string(virtualMode ? "true" : "false")).c_str());
+        LOG(("List populate time (us): " + std::to_string(populateTime)).c_str());
+        LOG(("List rows drawn: " + std::to_string(rowsDrawn)).c_str());
+    }
+    #endif
+
+    /// @brief     method to show the rows of a view of an item model, the control being
+    ///            kept up to date as the model changes (see `BasicItemView`)
+    /// @param[in] view ~ the view to show (`nullptr` to stop following the view)
+    /// @details   only the changed rows are pushed to the control; the items are those
+    ///            of the view, i.e. not to be added/removed through the control
+    /// @note      the view is to outlive the control (or to be unbound)
+    void bind(item_view* view) {
+
+        if (virtualMode) { return; }
+
+        if (boundView) {
+            boundView->setOnChange(nullptr);
+        }
+        boundView = view;
+        if (boundView) {
+            boundView->setOnChange([this](const item_view::Change& change) { viewChanged(change); });
+            viewChanged(item_view::Change{ item_view::Change::RESET, 0, nullptr });
+        }
+    }
+
+    /// @brief method to retrieve the view shown by the control, `nullptr` if none
+    item_view* getView() {
+        return boundView;
+    }
+
+    /// @brief     method to stream the rows from a producer thread, appended page by page
+    /// @param[in] producer ~ function (run on a thread of its own) appending at most `size` rows
+    ///            to `page`, returning `false` once no row is left (see `PageQueue`)
+    /// @param[in] pageSize ~ number of rows per page
+    /// @param[in] capacity ~ maximum number of pages produced ahead of the control (back-pressure)
+    /// @details   the first pages are requested at once & show as they arrive; the next ones
+    ///            are requested as the view nears the last row (scrolling) <br/>
+    ///            pages are handed over through `WM_LISTBOX_PAGE`, i.e. the rows are only
+    ///            added to the control on the UI thread
+    /// @note      to be invoked after `create()`; not applicable in virtual mode
+    void setSource(page_producer producer, size_t pageSize = 256, size_t capacity = 4) {
+
+        if (virtualMode) { return; }
+
+        if (!exists) {
+            LOG("xListBox::setSource(...) ~ to be invoked after create()");
+            return;
+        }
+
+        cancelSource();
+
+        const HWND hWnd = mhWnd;
+        pageQueue.reset(new PageQueue(pageSize, capacity));
+        pageQueue->start(std::move(producer), [hWnd]() {
+            PostMessage(hWnd, WM_LISTBOX_PAGE, 0, 0);
+        });
+        pageQueue->request(pagesAhead);
+    }
+
+    /// @brief method to stop the producer of `setSource(...)`, the rows received being kept
+    void cancelSource() {
+        pageQueue.reset(); // cancels & waits for the producer thread
+    }
+
+    /// @brief method to check whether rows are still to come from the producer
+    bool isStreaming() {
+        return pageQueue && !pageQueue->finished();
+    }
+
+    /// @brief method to set the number of pages requested ahead of the rows in view
+    void setPagesAhead(size_t pages) {
+        pagesAhead = pages ? pages : 1;
+    }
+
     /// @brief method to toggle the listbox "unselectable" attribute
     void setUnselectable(bool flag) {
         unselectable = flag;
@@ -216,7 +700,7 @@ public:
 
         // invoke on-selection-change callback trigger action ...
         if (mOnSelectionChange) {
-            mOnSelectionChange(this, selectedItemIndex); // -1
+            selectionGate.post(); // now or deferred (see `setOnSelectionChange(..., policy)`)
         }
     }
 
@@ -231,11 +715,9 @@ public:
         std::string temp = text;
         #endif
         
-        for (size_t idx = 0; idx < itemsList.size(); idx++) {
-            if (itemsList[idx] == temp) {
-                select(idx);
-                break;
-            }
+        const size_t idx = itemIndex.find(temp);
+        if (idx < itemsList.size()) {
+            select((int) idx);
         }
     }
 
@@ -287,7 +769,7 @@ public:
 
         // invoke on-selection-change callback trigger action ...
         if (mOnSelectionChange) {
-            mOnSelectionChange(this, selectedItemIndex);
+            selectionGate.post(); // now or deferred (see `setOnSelectionChange(..., policy)`)
         }
     }
 
@@ -298,10 +780,13 @@ public:
 
     /// @brief method to retrieve the selected item string text
     std::string getSelectedItem() {        
+        if (virtualMode) {
+            return rowSource(selectedItemIndex);
+        }
         #if defined(UNICODE) && defined(_UNICODE)
-        return StrConverter::WStringToString(itemsList[selectedItemIndex]);
+        return StrConverter::WStringToString(itemsList.str(selectedItemIndex));
         #else
-        return itemsList[selectedItemIndex];
+        return itemsList.str(selectedItemIndex);
         #endif
     }
 
@@ -417,6 +902,9 @@ public:
     /// @brief  method to retrieve the number of items in the listbox
     /// @return integer representative of the number of items in the listbox menu
     int count() {
+        if (virtualMode) {
+            return (int) virtualRows;
+        }
         return itemsList.size();
     }
 
@@ -426,28 +914,21 @@ public:
     bool checkItem(const std::string& item) {
 
         #if defined(UNICODE) && defined(_UNICODE)
-        std::wstring temp = StrConverter::StringToWString(item);
-        std::vector<std::wstring>::iterator i;
+        return itemIndex.contains(StrConverter::StringToWString(item));
         #else
-        std::string temp = item;
-        std::vector<std::string>::iterator i;
+        return itemIndex.contains(item);
         #endif
-
-        i = std::find(itemsList.begin(), itemsList.end(), temp);
-
-        if (i != itemsList.end()) {
-            return true;
-        }
-
-        return false;
     }
 
     /// @brief method to add/insert new items into the listbox menu
     /// @param item ~ string representative of the new item to be inserted
     /// @param index ~ position/index at which to insert the item <br/>
     ///        If none specified, then default position is at the end!
+    /// @note  not applicable in virtual mode (see `setRowCount(...)`)
     void add(const std::string& item, int index = -1) {
 
+        if (virtualMode) { return; }
+
         #if defined(UNICODE) && defined(_UNICODE)
         std::wstring temp = StrConverter::StringToWString(item);
         #else
@@ -461,26 +942,17 @@ public:
 
         // std::cout << "index: " << i << std::endl;
 
-        #if defined(UNICODE) && defined(_UNICODE)
-        if (
-            !checkItem(
-                StrConverter::WStringToString(temp)
-            )
-        ) {
-            // insert the item at the specified index 
-            itemsList.insert(itemsList.begin() + i, temp);
-        }
-        #else
-        if (!checkItem(temp)) {
-            // insert the item at the specified index 
-            itemsList.insert(itemsList.begin() + i, temp);
+        // skip an item already listed (i.e. also contained in the view) ...
+        if (!itemIndex.insert(i, temp)) {
+            return;
         }
-        #endif
 
-        // also ensure the item is not contained in the view ...
+        // insert the item at the specified index 
+        itemsList.insert(i, temp);
 
         // insert into the control's view ...
         SendMessage(mhWnd, LB_INSERTSTRING, (WPARAM) i, (LPARAM) temp.c_str());
+        rowInserted((size_t) i);
 
         if (index == selectedItemIndex) {
             select(selectedItemIndex);
@@ -490,14 +962,32 @@ public:
     /// @brief method to insert/add new items into the listbox control
     /// @param items ~ vector container of the items to insert
     /// @param index ~ integer representative of the selected item index
+    /// @details items already listed (or repeated in `items`) are skipped through `itemIndex`,
+    ///          the others appended to the view in a single batch (see `insertItems(...)`)
     void add(const std::vector<std::string>& items, int index = - 1) {
 
-        // ... 
+        if (virtualMode) {
+            select(index);
+            return;
+        }
+
+        const size_t first = itemsList.size();
+        itemsList.reserve(items.size());
 
-        // add the items to the combobox/dropdown's vector container ...
+        // add the items to the listbox's vector container ...
         for (size_t i = 0; i < items.size(); i++) {
-            add(items[i]);
+            #if defined(UNICODE) && defined(_UNICODE)
+            std::wstring temp = StrConverter::StringToWString(items[i]);
+            #else
+            const std::string& temp = items[i];
+            #endif
+            if (itemIndex.push_back(temp)) {
+                itemsList.push_back(temp);
+            }
         }
+
+        // ... then to the view, at once
+        insertItems(first);
         select(index);
     }
 
@@ -511,11 +1001,9 @@ public:
         std::string temp = item;
         #endif
 
-        for (size_t i = 0; i < itemsList.size(); i++) {
-            if (temp == itemsList[i]) {
-                remove(i); // remove by index found ...
-                break;
-            }
+        const size_t i = itemIndex.find(temp);
+        if (i < itemsList.size()) {
+            remove((int) i); // remove by index found ...
         }
     }
 
@@ -524,7 +1012,9 @@ public:
     ///            the position for the item to removed
     void remove(int index) {
 
-        if (index < 0 || index > count()) {
+        if (virtualMode) { return; }
+
+        if (index < 0 || index >= count()) {
             // throw exception, index out of range ...
             return;
         };
@@ -535,13 +1025,18 @@ public:
         // check whether the item was remove from the combobox ...
         if (result != LB_ERR) {
             // remove the item from the vector container
-            itemsList.erase(itemsList.begin() + index);
+            itemsList.erase(index);
+            itemIndex.eraseAt(index);
+            rowRemoved((size_t) index);
         }
 
         // ensure that if the removed item was selected,
         // then select the first item in the list ...
         if (index == selectedItemIndex) {
             select(0); // triggers redraw ...
+        } else if (result != LB_ERR && index < selectedItemIndex) {
+            // ... otherwize the selected item moved up a row
+            selectedItemIndex--;
         }
     }
 
@@ -550,10 +1045,14 @@ public:
     /// @return string representative of the item in the listbox found
     std::string getItemByIndex(int index) {
 
+        if (virtualMode) {
+            return rowSource(index);
+        }
+
         #if defined(UNICODE) && defined(_UNICODE)
-        return StrConverter::WStringToString(itemsList[index]);
+        return StrConverter::WStringToString(itemsList.str(index));
         #else
-        return itemsList[index];
+        return itemsList.str(index);
         #endif
     }
 
@@ -563,12 +1062,8 @@ public:
     int getIndex(const std::string& item)
     #endif
     {
-        for (size_t i = 0; i < itemsList.size(); i++) {
-            if (itemsList[i] == item) {
-                return i;
-            }
-        }
-        return -1;
+        const size_t i = itemIndex.find(item);
+        return (i < itemsList.size()) ? (int) i : -1;
     }
 
     #ifndef NDEBUG
@@ -581,14 +1076,19 @@ public:
     }
     #endif
 
+    /// @brief override custom drawing, i.e. the rows of the virtual mode
+    ///        (`WM_DRAWITEM` routed by the parent `xWindow`)
     /// @todo  override custom drawing to be implemented
     ///        when background color & text color
     ///        is to be dynamically changed/adjusted
     virtual LRESULT CustomDraw(UINT msg, WPARAM wParam, LPARAM lParam) override {
         
-        IMPLICIT(msg);
         IMPLICIT(wParam);
-        IMPLICIT(lParam);
+
+        if (msg == WM_DRAWITEM && ((virtualMode && rowSource) || ownerDraw)) {
+            drawRow((LPDRAWITEMSTRUCT) lParam);
+            return TRUE;
+        }
 
         return 0;
     }
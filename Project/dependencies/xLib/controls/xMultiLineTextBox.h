@@ -24,8 +24,44 @@
  */
 class xMultiLineTextBox : public xTextBox {
 
+public:
+
+    /// @brief maximum number of bytes of a file line shown in the view
+    static const size_t VIEW_COLUMNS = 1024;
+
+    /// @brief ID of the timer polling the line index (& the file, when tailing)
+    static const UINT_PTR VIEW_TIMER = 0x7F11;
+
+    /// @brief period (in milliseconds) of `VIEW_TIMER`
+    static const UINT VIEW_POLL = 100;
+
 protected:
 
+    /// @brief   the mapped file of the viewer mode (see `openFile(...)`)
+    /// @details declared before `viewIndex`, which scans it, so that it is unmapped last
+    MappedFile viewFile;
+
+    /// @brief the line index of `viewFile`, built in the background
+    LineIndex viewIndex;
+
+    /// @brief flag indicating whether a file is viewed
+    bool viewing = false;
+
+    /// @brief flag indicating whether the viewed file is followed as it grows
+    bool tailing = false;
+
+    /// @brief index of the first visible line of the file
+    size_t topLine = 0;
+
+    /// @brief `restore` (default text) flag, saved while viewing a file
+    bool viewRestore = true;
+
+    /// @brief the text of the visible lines (storage re-used between renders)
+    std::basic_string<TCHAR> viewText;
+
+    /// @brief duration (in microseconds) of the last render of the visible lines
+    long long viewRender = 0;
+
     /// @brief method to initialize the multiline textbox control
     /// specifically, for adjusting multiline parameters & character limit!
     void init() {
@@ -60,7 +96,385 @@ public:
         init();
     }
 
-    // ...
+    /// @brief  method to retrieve the number of lines of the text
+    /// @return number of lines (at least one), from the line index of the text model,
+    ///         or the number of lines of the viewed file indexed so far
+    size_t getLineCount() {
+        if (viewing) {
+            return viewIndex.lineCount();
+        }
+        return mBuffer.lineCount();
+    }
+
+    /// @brief     method to retrieve a line of the text
+    /// @param[in] line ~ index of the line (`0` ~ `getLineCount() - 1`)
+    /// @return    the line, without its line break
+    std::string getLine(size_t line) {
+        if (viewing) {
+            // the (UTF-8) bytes of the file line ...
+            if (line >= viewIndex.lineCount()) {
+                return std::string();
+            }
+            size_t first, last;
+            lineRange(line, first, last);
+            return std::string(reinterpret_cast<const char*>(viewFile.data()) + first, last - first);
+        }
+        if (line >= mBuffer.lineCount()) {
+            return std::string();
+        }
+        #if defined(UNICODE) && defined(_UNICODE)
+        return StrConverter::WStringToString(mBuffer.line(line));
+        #else
+        return mBuffer.line(line);
+        #endif
+    }
+
+    /// @brief     method to retrieve the line holding a character
+    /// @param[in] pos ~ offset of the character (i.e. the caret)
+    size_t getLineOf(size_t pos) {
+        return mBuffer.lineOf(pos);
+    }
+
+    /**
+     * @brief     method to view a (large) file, read-only
+     * @param[in] path ~ path of the (UTF-8) file to view
+     * @param[in] tail ~ whether to follow the file as it grows (see `setTail(...)`)
+     * @details   The file is memory-mapped & its lines indexed in the background,
+     *            only the lines fitting the control being copied into it, so that
+     *            opening & scrolling do not depend on the size of the file. <br/>
+     *            The text model (& text-change events) is left untouched until `closeFile()`
+     * @remark    the control MUST be created, the file MUST NOT be empty
+     * @return    `true` if the file is viewed, otherwize `false`
+     */
+    bool openFile(const std::string& path, bool tail = false) {
+
+        if (!exists) {
+            return false;
+        }
+        closeFile();
+
+        if (!viewFile.open(path)) {
+            return false;
+        }
+        viewIndex.build(viewFile.data(), viewFile.size());
+
+        viewing = true;
+        tailing = tail;
+        topLine = 0;
+
+        // no default text while viewing ...
+        viewRestore = restore;
+        restore = false;
+
+        SendMessage(mhWnd, EM_SETREADONLY, TRUE, 0);
+        SetTimer(mhWnd, VIEW_TIMER, VIEW_POLL, NULL);
+        renderView();
+        return true;
+    }
+
+    /// @brief method to stop viewing the file, restoring the text of the textbox
+    void closeFile() {
+
+        if (!viewing) {
+            return;
+        }
+        KillTimer(mhWnd, VIEW_TIMER);
+        viewIndex.cancel();
+        viewFile.close();
+
+        viewing = false;
+        tailing = false;
+        restore = viewRestore;
+
+        SendMessage(mhWnd, EM_SETREADONLY, readonlyField ? TRUE : FALSE, 0);
+        updateText();
+    }
+
+    /// @brief method to check whether a file is viewed
+    bool isViewing() {
+        return viewing;
+    }
+
+    /// @brief   method to toggle whether the viewed file is followed as it grows
+    /// @details while the last line is visible, appended lines scroll into view
+    void setTail(bool flag) {
+        tailing = flag;
+        if (viewing && tailing) {
+            SetTimer(mhWnd, VIEW_TIMER, VIEW_POLL, NULL);
+        }
+    }
+
+    /// @brief method to check whether the viewed file is followed as it grows
+    bool getTail() {
+        return tailing;
+    }
+
+    /// @brief     method to scroll the viewed file
+    /// @param[in] line ~ index of the first visible line (clamped to the last page)
+    void scrollToLine(size_t line) {
+        if (!viewing) {
+            return;
+        }
+        topLine = line;
+        renderView();
+    }
+
+    /// @brief method to retrieve the first visible line of the viewed file
+    size_t getTopLine() {
+        return topLine;
+    }
+
+    /// @brief method to retrieve the duration (in microseconds) of the last render of the view
+    long long getRenderTime() {
+        return viewRender;
+    }
+
+    /// @brief method to retrieve the duration (in microseconds) of the last indexing scan
+    long long getIndexTime() {
+        return viewIndex.elapsed();
+    }
+
+    #ifndef NDEBUG
+    /// @brief method to Log the viewed file data (DEBUG)
+    void LogViewData() {
+        LOG(("View file: " + viewFile.path()).c_str());
+        LOG(("View bytes: " + std::to_string(viewFile.size())).c_str());
+        LOG(("View bytes indexed: " + std::to_string(viewIndex.scanned())).c_str());
+        LOG(("View lines: " + std::to_string(viewIndex.lineCount())).c_str());
+        LOG(("View index time (us): " + std::to_string(viewIndex.elapsed())).c_str());
+        LOG(("View render time (us): " + std::to_string(viewRender)).c_str());
+    }
+    #endif
+
+    /// @brief `xMultiLineTextBox` derived class message handler
+    virtual LRESULT HandleMessage(UINT msg, WPARAM wParam, LPARAM lParam) override {
+        // the view is not the text model ~ no text-change events while viewing
+        if (viewing && msg == WM_COMMAND && HIWORD(wParam) == EN_CHANGE) {
+            return 0;
+        }
+        return xTextBox::HandleMessage(msg, wParam, lParam);
+    }
+
+    /// @brief   override method scrolling the viewed file (instead of the control)
+    /// @details consumes scrolling (scrollbar, wheel & navigation keys) & `VIEW_TIMER`
+    virtual bool InterceptMessage(UINT msg, WPARAM wParam, LPARAM lParam, LRESULT& result) override {
+
+        UNUSED(lParam);
+
+        if (!viewing) {
+            return xTextBox::InterceptMessage(msg, wParam, lParam, result);
+        }
+
+        switch(msg) {
+
+            case WM_VSCROLL: {
+                const size_t rows = visibleRows();
+                switch(LOWORD(wParam)) {
+                    case SB_LINEUP:   { scrollBy(-1); break; }
+                    case SB_LINEDOWN: { scrollBy(1); break; }
+                    case SB_PAGEUP:   { scrollBy(-static_cast<long long>(rows)); break; }
+                    case SB_PAGEDOWN: { scrollBy(static_cast<long long>(rows)); break; }
+                    case SB_TOP:      { scrollToLine(0); break; }
+                    case SB_BOTTOM:   { scrollToLine(static_cast<size_t>(-1)); break; }
+                    case SB_THUMBTRACK:
+                    case SB_THUMBPOSITION: {
+                        SCROLLINFO si = {};
+                        si.cbSize = sizeof(SCROLLINFO);
+                        si.fMask = SIF_TRACKPOS;
+                        GetScrollInfo(mhWnd, SB_VERT, &si);
+                        scrollToLine(static_cast<size_t>(si.nTrackPos));
+                        break;
+                    }
+                }
+                result = 0;
+                return true;
+            }
+
+            case WM_MOUSEWHEEL: {
+                UINT lines = 3;
+                SystemParametersInfo(SPI_GETWHEELSCROLLLINES, 0, &lines, 0);
+                if (lines == WHEEL_PAGESCROLL) {
+                    lines = static_cast<UINT>(visibleRows());
+                }
+                const long long delta = GET_WHEEL_DELTA_WPARAM(wParam);
+                scrollBy(-delta * static_cast<long long>(lines) / WHEEL_DELTA);
+                result = 0;
+                return true;
+            }
+
+            case WM_KEYDOWN: {
+                const bool control = (GetKeyState(VK_CONTROL) & 0x8000) != 0;
+                const long long rows = static_cast<long long>(visibleRows());
+                switch(wParam) {
+                    case VK_UP:    { scrollBy(-1); break; }
+                    case VK_DOWN:  { scrollBy(1); break; }
+                    case VK_PRIOR: { scrollBy(-rows); break; }
+                    case VK_NEXT:  { scrollBy(rows); break; }
+                    case VK_HOME:  { if (!control) { return false; } scrollToLine(0); break; }
+                    case VK_END:   { if (!control) { return false; } scrollToLine(static_cast<size_t>(-1)); break; }
+                    default: {
+                        return false;
+                    }
+                }
+                if (mOnKeyPress) {
+                    mOnKeyPress(this, Key(static_cast<UINT>(wParam)));
+                }
+                result = 0;
+                return true;
+            }
+
+            case WM_TIMER: {
+                if (wParam != VIEW_TIMER) {
+                    return false;
+                }
+                pollView();
+                result = 0;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+protected:
+
+    /// @brief     helper method to retrieve the byte range of a file line
+    /// @param[in] line ~ index of the line, less than `viewIndex.lineCount()`
+    /// @param[out] first ~ receives the offset of the first byte of the line
+    /// @param[out] last ~ receives the offset past the line, without its line break
+    void lineRange(size_t line, size_t& first, size_t& last) {
+        first = viewIndex.lineStart(line);
+        last = viewIndex.lineEnd(line);
+        if (last > first && viewFile.data()[last - 1] == '\r') {
+            last--;
+        }
+    }
+
+    /// @brief     helper method to append (the first `VIEW_COLUMNS` bytes of) a file line
+    /// @param[in] line ~ index of the line
+    /// @param[out] out ~ receives the characters of the line (appended)
+    void appendLine(size_t line, std::basic_string<TCHAR>& out) {
+
+        size_t first, last;
+        lineRange(line, first, last);
+
+        const size_t n = std::min(last - first, static_cast<size_t>(VIEW_COLUMNS));
+        if (n == 0) {
+            return;
+        }
+        const char* bytes = reinterpret_cast<const char*>(viewFile.data()) + first;
+
+        #if defined(UNICODE) && defined(_UNICODE)
+        // at most one UTF-16 unit per UTF-8 byte ...
+        const size_t at = out.size();
+        out.resize(at + n);
+        const int count = MultiByteToWideChar(CP_UTF8, 0, bytes, static_cast<int>(n), &out[at], static_cast<int>(n));
+        out.resize(at + (count > 0 ? static_cast<size_t>(count) : 0));
+        #else
+        out.append(bytes, n);
+        #endif
+    }
+
+    /// @brief helper method to retrieve the number of lines fitting the control
+    size_t visibleRows() {
+
+        RECT rc = {};
+        SendMessage(mhWnd, EM_GETRECT, 0, (LPARAM) &rc);
+
+        HFONT hWndFont = (HFONT) SendMessage(mhWnd, WM_GETFONT, 0, 0);
+        if (hWndFont == NULL) {
+            hWndFont = (HFONT) GetStockObject(SYSTEM_FONT);
+        }
+        const int lineHeight = xFontCache::get().metrics(hWndFont).lineHeight();
+
+        const int rows = (lineHeight > 0) ? (rc.bottom - rc.top) / lineHeight : 0;
+        return rows > 0 ? static_cast<size_t>(rows) : 1;
+    }
+
+    /// @brief     helper method to scroll the viewed file by a number of lines
+    /// @param[in] delta ~ number of lines (negative upwards)
+    void scrollBy(long long delta) {
+        if (delta < 0) {
+            const size_t up = static_cast<size_t>(-delta);
+            scrollToLine(topLine > up ? topLine - up : 0);
+        } else {
+            scrollToLine(topLine + static_cast<size_t>(delta));
+        }
+    }
+
+    /// @brief   helper method to copy the visible lines into the control
+    /// @details O(visible lines) ~ the scrollbar reflects the lines indexed so far
+    void renderView() {
+
+        auto start = std::chrono::steady_clock::now();
+
+        const size_t count = viewIndex.lineCount();
+        const size_t rows = visibleRows();
+        const size_t last = (count > rows) ? count - rows : 0;
+        if (topLine > last) {
+            topLine = last;
+        }
+
+        viewText.clear();
+        for (size_t i = topLine; i < count && i < topLine + rows; i++) {
+            if (i > topLine) {
+                viewText += TEXT("\r\n");
+            }
+            appendLine(i, viewText);
+        }
+        SetWindowText(mhWnd, viewText.c_str());
+
+        // the control only holds the visible lines => own scrollbar range ...
+        SCROLLINFO si = {};
+        si.cbSize = sizeof(SCROLLINFO);
+        si.fMask = SIF_RANGE | SIF_PAGE | SIF_POS | SIF_DISABLENOSCROLL;
+        si.nMin = 0;
+        si.nMax = static_cast<int>(std::min<size_t>(count ? count - 1 : 0, MAXLONG));
+        si.nPage = static_cast<UINT>(rows);
+        si.nPos = static_cast<int>(std::min<size_t>(topLine, MAXLONG));
+        SetScrollInfo(mhWnd, SB_VERT, &si, TRUE);
+
+        viewRender = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start
+        ).count();
+    }
+
+    /// @brief   helper method run upon `VIEW_TIMER`
+    /// @details refreshes the view as lines are indexed &, when tailing,
+    ///          re-maps the file once grown & indexes the appended bytes only
+    void pollView() {
+
+        const size_t before = viewIndex.lineCount();
+        const bool atEnd = topLine + visibleRows() >= before;
+
+        if (tailing) {
+            WIN32_FILE_ATTRIBUTE_DATA data;
+            if (GetFileAttributesExA(viewFile.path().c_str(), GetFileExInfoStandard, &data)) {
+                const unsigned long long size =
+                    (static_cast<unsigned long long>(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+                if (size != viewFile.size()) {
+                    // the index scans the mapping => stop it before re-mapping ...
+                    viewIndex.cancel();
+                    const std::string path = viewFile.path();
+                    if (!viewFile.open(path)) {
+                        closeFile();
+                        return;
+                    }
+                    viewIndex.extend(viewFile.data(), viewFile.size());
+                }
+            }
+        } else if (viewIndex.done()) {
+            KillTimer(mhWnd, VIEW_TIMER);
+        }
+
+        const size_t after = viewIndex.lineCount();
+        if (after != before) {
+            if (tailing && atEnd) {
+                topLine = static_cast<size_t>(-1); // follow ~ clamped to the last page
+            }
+            renderView();
+        }
+    }
 };
 
 #endif // end of xMULTILINETEXTBOX_H
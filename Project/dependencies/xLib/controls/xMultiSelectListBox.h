@@ -47,7 +47,11 @@ public:
     ) : xListBox(x, y, items, -1, w, h) {
         appendWindowStyle(LBS_MULTIPLESEL);
         unselectable = true;
-        selectedIndices = indices;
+        for (size_t i = 0; i < indices.size(); i++) {
+            if (indices[i] >= 0) {
+                selection.insert(indices[i]);
+            }
+        }
     }
 
     /// @brief parametrized constructor taking parent widget as first argument
@@ -63,56 +67,86 @@ public:
     ) : xListBox(parent, x, y, items, -1, w, h) {
         appendWindowStyle(LBS_MULTIPLESEL);
         unselectable = true;
-        selectedIndices = indices;
+        for (size_t i = 0; i < indices.size(); i++) {
+            if (indices[i] >= 0) {
+                selection.insert(indices[i]);
+            }
+        }
     }
 
 protected:
     
-    /// @brief variable to keep track of number of selected items ...
-    int selectedIndicesCount = 0;
-
-    /// @brief container to store the indices of the selected items ...
-    std::vector<int> selectedIndices = { /* initially empty */ };
+    /// @brief the selected items (one bit per item, see `SelectionSet`)
+    SelectionSet selection;
 
     /// @brief internal (protected) helper method
     /// to update the container of selected items ...
     void select(int* indices, int count) {
 
-        selectedIndicesCount = count;
-
-        std::vector<int> indexList;
-        indexList.reserve(count);
+        selection.clear();
+        selection.resize(this->count());
 
         for (int i = 0; i < count; i++) {
-            indexList.push_back(indices[i]);
+            selection.insert(indices[i]);
         }
-
-        selectedIndices = indexList;
         // #ifndef NDEBUG // for debugging
         // EnumerateSelectedIndices();
         // #endif
     }
 
+    /// @brief internal (protected) helper method to reflect `selection`
+    ///        in the control, one message per run of selected items
+    void applySelection() {
+
+        if (!exists) { return; }
+
+        SendMessage(mhWnd, WM_SETREDRAW, FALSE, 0);
+        SendMessage(mhWnd, LB_SETSEL, (WPARAM) FALSE, (LPARAM) -1);
+
+        size_t first = selection.next(0);
+        while (first != SelectionSet::npos) {
+            size_t last = selection.nextClear(first);
+            SendMessage(mhWnd, LB_SELITEMRANGEEX, (WPARAM) first, (LPARAM) (last - 1));
+            first = selection.next(last);
+        }
+
+        SendMessage(mhWnd, WM_SETREDRAW, TRUE, 0);
+        InvalidateRect(mhWnd, NULL, TRUE);
+    }
+
+    /// @brief protected override method moving the selection of the rows below an inserted row
+    void rowInserted(size_t row) override {
+        if (row < selection.size()) {
+            selection.insertAt(row);
+        }
+    }
+
+    /// @brief protected override method moving the selection of the rows below a removed row
+    void rowRemoved(size_t row) override {
+        selection.eraseAt(row);
+    }
+
+    /// @brief protected override method dropping the selection of the replaced rows
+    void rowsReset() override {
+        selection.clear();
+        selection.resize(this->count());
+    }
+
+    /// @brief internal (protected) helper method to notify
+    ///        the listener of a programmatic selection change
+    void selectionChanged() {
+        if (mOnSelectionChange) {
+            selectionGate.post(); // now or deferred (see `setOnSelectionChange(..., policy)`)
+        }
+    }
+
 public:
 
     /// @brief method to check whether an item is in a "select" state
     /// @param index ~ integer representative of the item's index to check
     /// @return boolean flag (true/false) whether an item is selected
     bool isSelected(int index) {
-
-        std::vector<int>::iterator i;
-        
-        i = std::find(
-            selectedIndices.begin(),
-            selectedIndices.end(),
-            index
-        );
-
-        if (i != selectedIndices.end()) {
-            return true;
-        }
-
-        return false;
+        return index >= 0 && selection.contains(index);
     }
 
     /// @brief method to check whether an item is in a "select" state
@@ -132,7 +166,14 @@ public:
     /// @brief  method to retrieve the number of selected items
     /// @return integer representative of the number of selected items
     int getSelectedCount() {
-        return selectedIndicesCount;
+        return (int) selection.count();
+    }
+
+    /// @brief   method to retrieve the selected items as a set of positions
+    /// @details i.e. for iterating the selection without copying it,
+    ///          or as the selection of the rows in virtual mode (see `setVirtual(...)`)
+    const SelectionSet& getSelection() {
+        return selection;
     }
 
     /// @brief public override create method to initialize
@@ -142,7 +183,8 @@ public:
     bool create() override {
         bool success = xListBox::create();
 
-        select(selectedIndices);
+        selection.resize(count());
+        applySelection();
 
         return success;
     }
@@ -150,7 +192,15 @@ public:
     /// @brief method to retrieve the list/vector of selected indices
     /// @return vector of integers, representing the selected indices
     std::vector<int> getSelectedIndices() {
-        return selectedIndices;
+
+        std::vector<int> indices;
+        indices.reserve(selection.count());
+
+        for (size_t i = selection.next(0); i != SelectionSet::npos; i = selection.next(i + 1)) {
+            indices.push_back((int) i);
+        }
+
+        return indices;
     }
 
     /// @brief method to retrieve the list/vector of selected items
@@ -158,9 +208,10 @@ public:
     std::vector<std::string> getSelectedItems() {
         
         std::vector<std::string> filter;
+        filter.reserve(selection.count());
 
-        for (size_t i = 0; i < selectedIndices.size(); i++) {
-            filter.push_back(getItemByIndex(selectedIndices[i]));
+        for (size_t i = selection.next(0); i != SelectionSet::npos; i = selection.next(i + 1)) {
+            filter.push_back(getItemByIndex((int) i));
         }
 
         return filter;
@@ -198,16 +249,57 @@ public:
     /// of the item's position/index in the list
     void select(int index) {
         
-        if (index < -1 || index > count()) { return; }
+        if (index < -1 || index >= count()) { return; }
 
         if (index == -1) {
             // deselect all ...
-            SendMessage(mhWnd, LB_SETCURSEL, (LPARAM) -1, (WPARAM) FALSE);
+            SendMessage(mhWnd, LB_SETSEL, (WPARAM) FALSE, (LPARAM) -1);
+            selection.clear();
             return;
         }
 
         // if index valid, send message to select item ...
-        SendMessage(mhWnd, LB_SETSEL, (LPARAM) TRUE, (WPARAM) index);
+        SendMessage(mhWnd, LB_SETSEL, (WPARAM) TRUE, (LPARAM) index);
+        selection.insert(index);
+    }
+
+    /// @brief method to select every item at once
+    void selectAll() {
+        selection.resize(count());
+        selection.fill();
+        applySelection();
+        selectionChanged();
+    }
+
+    /// @brief method to deselect every item at once
+    void deselectAll() {
+        selection.clear();
+        applySelection();
+        selectionChanged();
+    }
+
+    /// @brief method to invert the "select" state of every item at once
+    void invertSelection() {
+        selection.resize(count());
+        selection.invert();
+        applySelection();
+        selectionChanged();
+    }
+
+    /// @brief method to select the items in [`first`, `last`) at once
+    void selectRange(int first, int last) {
+        if (first < 0 || last > count() || first >= last) { return; }
+        selection.insert(first, last);
+        applySelection();
+        selectionChanged();
+    }
+
+    /// @brief method to deselect the items in [`first`, `last`) at once
+    void deselectRange(int first, int last) {
+        if (first < 0 || last > count() || first >= last) { return; }
+        selection.erase(first, last);
+        applySelection();
+        selectionChanged();
     }
 
     /// @brief method to deselect a multi-select
@@ -217,7 +309,7 @@ public:
         // std::cout << "xMultiSelectListBox::deselect(...)" << std::endl;
         // std::cout << "index: " << index << std::endl;
         
-        if (index < -1 || index > count()) {
+        if (index < -1 || index >= count()) {
             return;
         }
 
@@ -234,12 +326,16 @@ public:
             selectedItemIndex = -1;
 
             // deselect all ...
-            SendMessage(mhWnd, LB_SETSEL, (LPARAM) FALSE, (WPARAM) -1);
+            SendMessage(mhWnd, LB_SETSEL, (WPARAM) FALSE, (LPARAM) -1);
+            selection.clear();
 
             return; // should still reveive `mOnSelectionChange` ...
 
         } // otherwize ...
 
+        SendMessage(mhWnd, LB_SETSEL, (WPARAM) FALSE, (LPARAM) index);
+        selection.erase(index);
+
         // if (unselectable) {
         //     // invoke select(index);
         //     // this will trigger `mOnSelectionChange` ...
@@ -249,7 +345,7 @@ public:
 
         // invoke on-selection-change callback trigger action ...
         if (mOnSelectionChange) {
-            mOnSelectionChange(this, selectedItemIndex); // -1
+            selectionGate.post(); // now or deferred (see `setOnSelectionChange(..., policy)`)
         }
     }
 
@@ -290,23 +386,19 @@ public:
     /// in the multi-select listbox control
     void EnumerateSelectedIndices() {
 
-        if (selectedIndicesCount == 0) {
+        if (selection.empty()) {
             std::cout << "[ ]" << std::endl;
             return; // escape ...
         }
 
         std::stringstream ss;
-        size_t s = selectedIndices.size();
-        // std::cout << "s: " << s << std::endl;
 
         ss << "["; // open bracket ...
-        // enumerate till second last item ...
-        for (size_t i = 0; i < s-1; i++) {
-            // don't close until last item ...
-            ss << selectedIndices[i] << ", ";
-            // don't append comman for last item ...
+        const char* separator = ""; // no comma before the first item ...
+        for (size_t i = selection.next(0); i != SelectionSet::npos; i = selection.next(i + 1)) {
+            ss << separator << i;
+            separator = ", ";
         }
-        ss << selectedIndices[s-1]; // last item ...
         ss << "]"; // close bracket
 
         // stream the data to the console ...
@@ -319,23 +411,18 @@ public:
     /// in the multi-select listbox control
     void Enumerate() {
 
-        if (selectedIndicesCount == 0) {
+        if (selection.empty()) {
             std::cout << "no selected items ... " << std::endl;
             return; // escape ...
         }
 
         std::stringstream ss;
-        size_t s = selectedIndices.size();
-        // std::cout << "s: " << s << std::endl;
 
-        // enumerate till second last item ...
-        for (size_t i = 0; i < s; i++) {
-            // don't close until last item ...
+        for (size_t i = selection.next(0); i != SelectionSet::npos; i = selection.next(i + 1)) {
             ss
-            << "index: " << selectedIndices[i]
+            << "index: " << i
             << " => "
-            << "item: " << getItemByIndex(selectedIndices[i]) << std::endl;
-            // don't append comman for last item ...
+            << "item: " << getItemByIndex((int) i) << std::endl;
         }
 
         // stream the data to the console ...
@@ -366,7 +453,7 @@ public:
                         // // i.e. count can only go up, i.e. increase only ...
                         // if (unselectable && count < c) {
                         //     // just select all the items again ...
-                        //     select(selectedIndices);
+                        //     applySelection();
                         //     break; // don't allow further processing
                         // }
 
@@ -0,0 +1,519 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 	  xTable.h
+  * @author   &lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  * @brief 	  contains `xTable` class declaration & implemenation
+  * @details  xTable.h defines the `xTable` class
+  */
+
+#pragma once
+
+/// @brief begin of xTABLE_H implementation
+#ifndef xTABLE_H
+#define xTABLE_H
+
+/**
+ * @class      xTable
+ * @brief     `xTable` provides the interface for creating multi-column table controls
+ * @details   `xTable` is a virtual list-view (`LVS_OWNERDATA`): the rows are stored by
+ *             columns in a `ColumnStore` & the control requests the text of the cells
+ *             in view only (`LVN_GETDISPINFO`), so that scrolling costs the same for
+ *             a hundred or ten million rows <br/>
+ *             Sorting (clicking a column header) orders a permutation of the rows,
+ *             the rows themselves being left in place
+ * @implements iSelectionChangeEventListener
+ */
+class xTable : public xControl, public iSelectionChangeEventListener {
+
+protected:
+
+    /// @brief default heigth for table controls
+    #define HEIGHT_DEFAULT_TABLE 200
+    /// @brief default width for table controls
+    #define WIDTH_DEFAULT_TABLE  300
+    /// @brief default width for the columns of table controls
+    #define WIDTH_DEFAULT_TABLE_COLUMN 100
+
+    /// @brief the view row selected
+    /// @note -1 indicates no row selected ...
+    int selectedRow = -1;
+
+protected:
+
+    /// @brief the rows of the table, stored by columns
+    ColumnStore data;
+    /// @brief the data row shown at every view row (sorted by `sortColumn`)
+    std::vector<ColumnStore::row_type> order;
+    /// @brief the width of every column
+    std::vector<int> columnWidths;
+
+    /// @brief the column the rows are sorted by (-1 for the data order)
+    int sortColumn = -1;
+    /// @brief whether the rows are sorted in ascending or descending order
+    bool sortAscending = true;
+    /// @brief number of threads sorting the rows (0 for the number of cores)
+    size_t sortThreads = 0;
+
+    /// @brief number of cells requested by the control
+    size_t cellsRequested = 0;
+    /// @brief time taken by the last sort (in microseconds)
+    long long sortTime = 0;
+
+public:
+
+    /// @brief public default/parameterless constructor
+    xTable() : xControl() {
+        appendWindowStyle(
+              WS_CHILD         | WS_TABSTOP
+            | WS_CLIPSIBLINGS  | LVS_REPORT
+            | LVS_OWNERDATA    | LVS_SINGLESEL
+            | LVS_SHOWSELALWAYS
+        );
+        m_h = HEIGHT_DEFAULT_TABLE;
+        m_w = WIDTH_DEFAULT_TABLE;
+    }
+
+    /// @brief parametrized constructor
+    /// @note  columns & rows are added after construction
+    xTable(
+        int x, int y,
+        int w = WIDTH_DEFAULT_TABLE,
+        int h = HEIGHT_DEFAULT_TABLE
+    ) : xControl(" ", w, h, x, y) {
+
+        appendWindowStyle(
+              WS_CHILD         | WS_TABSTOP
+            | WS_CLIPSIBLINGS  | LVS_REPORT
+            | LVS_OWNERDATA    | LVS_SINGLESEL
+            | LVS_SHOWSELALWAYS
+        );
+    }
+
+    /// @brief parametrized constructor taking parent widget as first argument
+    /// @note  columns & rows are added after construction
+    xTable(
+        xWidget* parent,
+        int x, int y,
+        int w = WIDTH_DEFAULT_TABLE,
+        int h = HEIGHT_DEFAULT_TABLE
+    ) : xControl(parent, " ", w, h, x, y) {
+
+        appendWindowStyle(
+              WS_CHILD         | WS_TABSTOP
+            | WS_CLIPSIBLINGS  | LVS_REPORT
+            | LVS_OWNERDATA    | LVS_SINGLESEL
+            | LVS_SHOWSELALWAYS
+        );
+    }
+
+    /// @brief interface override method to attach
+    ///        on-selection-change callback action
+    ///        `WM_NOTIFY` => `LVN_ITEMCHANGED`
+    /// @param callback ~ function pointer of the action
+    /// to invoke upon selection-change event detected (with the view row)
+    virtual void setOnSelectionChange(
+        event_onSelectionChange callback
+    ) override {
+        mOnSelectionChange = std::move(callback);
+    }
+
+    /// @brief method to attach on-selection-change callback action
+    ///        delivered according to a policy, i.e. `EventPolicy::debounce(150)`
+    /// @param callback ~ function pointer of the action
+    /// @param policy ~ delivery policy (a burst of changes is delivered once)
+    void setOnSelectionChange(event_onSelectionChange callback, EventPolicy policy) {
+        setOnSelectionChange(std::move(callback));
+        selectionGate.setPolicy(policy);
+    }
+
+protected:
+
+    /// @brief delivers selection-change events according to a policy (immediate by default)
+    xEventGate selectionGate{ [this]() {
+        if (mOnSelectionChange) {
+            mOnSelectionChange(this, selectedRow);
+        }
+    } };
+
+protected:
+
+    /// @brief protected method to retrieve the type name
+    virtual LPCTSTR TypeName() const override { return WC_LISTVIEW; }
+    /// @brief protected method to retrieve the class name
+    virtual LPCTSTR ClassName() const override { return TEXT("xTable"); }
+
+    /// @brief helper method to insert a column into the control
+    void insertColumn(size_t col) {
+
+        #if defined(UNICODE) && defined(_UNICODE)
+        std::wstring name = StrConverter::StringToWString(data.name(col));
+        #else
+        std::string name = data.name(col);
+        #endif
+
+        LVCOLUMN column { };
+        column.mask = LVCF_TEXT | LVCF_WIDTH | LVCF_SUBITEM;
+        column.cx = columnWidths[col];
+        column.pszText = const_cast<LPTSTR>(name.c_str());
+        column.iSubItem = (int) col;
+        SendMessage(mhWnd, LVM_INSERTCOLUMN, (WPARAM) col, (LPARAM) &column);
+    }
+
+    /// @brief helper method to show the sort arrow on the header of `sortColumn`
+    void updateHeader() {
+
+        HWND hHeader = (HWND) SendMessage(mhWnd, LVM_GETHEADER, 0, 0);
+        if (!hHeader) {
+            return;
+        }
+
+        for (size_t col = 0; col < data.columns(); col++) {
+            HDITEM item { };
+            item.mask = HDI_FORMAT;
+            SendMessage(hHeader, HDM_GETITEM, (WPARAM) col, (LPARAM) &item);
+            item.fmt &= ~(HDF_SORTUP | HDF_SORTDOWN);
+            if ((int) col == sortColumn) {
+                item.fmt |= sortAscending ? HDF_SORTUP : HDF_SORTDOWN;
+            }
+            SendMessage(hHeader, HDM_SETITEM, (WPARAM) col, (LPARAM) &item);
+        }
+    }
+
+    /// @brief helper method to fill the text of a cell requested by the control
+    void fillCell(NMLVDISPINFO* pDispInfo) {
+
+        LVITEM& item = pDispInfo->item;
+        if (!(item.mask & LVIF_TEXT) || item.cchTextMax <= 0) {
+            return;
+        }
+        if (item.iItem < 0 || (size_t) item.iItem >= order.size()
+            || item.iSubItem < 0 || (size_t) item.iSubItem >= data.columns()) {
+            item.pszText[0] = TEXT('\0');
+            return;
+        }
+
+        const char* text = data.text(order[item.iItem], item.iSubItem);
+        #if defined(UNICODE) && defined(_UNICODE)
+        lstrcpyn(item.pszText, StrConverter::StringToWString(text).c_str(), item.cchTextMax);
+        #else
+        lstrcpyn(item.pszText, text, item.cchTextMax);
+        #endif
+        cellsRequested++;
+    }
+
+public:
+
+    /// @brief     method to add a column (empty cells for the rows added already)
+    /// @param[in] name ~ the header of the column
+    /// @param[in] width ~ the width of the column
+    /// @param[in] type ~ how the cells of the column are sorted
+    /// @return    the index of the column
+    size_t addColumn(
+        const std::string& name,
+        int width = WIDTH_DEFAULT_TABLE_COLUMN,
+        ColumnStore::Type type = ColumnStore::TEXT
+    ) {
+        const size_t col = data.addColumn(name, type);
+        columnWidths.push_back(width);
+        if (exists) {
+            insertColumn(col);
+        }
+        return col;
+    }
+
+    /// @brief method to reserve the storage of `rows` rows (see `ColumnStore::reserve(...)`)
+    void reserve(size_t rows, size_t chars = 8) {
+        data.reserve(rows, chars);
+        order.reserve(rows);
+    }
+
+    /// @brief     method to append a row (missing cells are empty)
+    /// @param[in] cells ~ the cells of the row, by column
+    /// @note      the control shows the new rows upon `refresh()`,
+    ///            i.e. once a batch of rows is appended
+    void appendRow(const std::vector<std::string>& cells) {
+        data.appendRow(cells);
+    }
+
+    /// @brief method to discard every row (the columns are kept)
+    void clearRows() {
+        data.clearRows();
+        order.clear();
+        selectedRow = -1;
+        refresh();
+    }
+
+    /// @brief method to show the rows appended/discarded, sorted by the sort column
+    void refresh() {
+
+        if (sortColumn >= 0) {
+            sort(sortColumn, sortAscending);
+            return;
+        }
+        ColumnStore::identity(order, data.rows());
+
+        if (exists) {
+            SendMessage(mhWnd, LVM_SETITEMCOUNT, (WPARAM) order.size(), LVSICF_NOSCROLL);
+            InvalidateRect(mhWnd, NULL, FALSE);
+        }
+    }
+
+    /// @brief     method to sort the rows by a column
+    /// @param[in] col ~ the column (-1 for the data order)
+    /// @param[in] ascending ~ whether the rows go in ascending or descending order
+    /// @details   the selected row stays selected (at its new position)
+    void sort(int col, bool ascending = true) {
+
+        const int dataRow = getSelectedDataRow();
+
+        auto start = std::chrono::steady_clock::now();
+        if (col >= 0 && (size_t) col < data.columns()) {
+            data.sort((size_t) col, ascending, order, sortThreads);
+            sortColumn = col;
+            sortAscending = ascending;
+        } else {
+            ColumnStore::identity(order, data.rows());
+            sortColumn = -1;
+            sortAscending = true;
+        }
+        sortTime = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start
+        ).count();
+
+        // the view row of the selected data row ...
+        selectedRow = -1;
+        if (dataRow >= 0) {
+            for (size_t row = 0; row < order.size(); row++) {
+                if (order[row] == (ColumnStore::row_type) dataRow) {
+                    selectedRow = (int) row;
+                    break;
+                }
+            }
+        }
+
+        if (exists) {
+            SendMessage(mhWnd, LVM_SETITEMCOUNT, (WPARAM) order.size(), LVSICF_NOSCROLL);
+            if (selectedRow >= 0) {
+                LVITEM item { };
+                item.stateMask = LVIS_SELECTED | LVIS_FOCUSED;
+                item.state = LVIS_SELECTED | LVIS_FOCUSED;
+                SendMessage(mhWnd, LVM_SETITEMSTATE, (WPARAM) selectedRow, (LPARAM) &item);
+                SendMessage(mhWnd, LVM_ENSUREVISIBLE, (WPARAM) selectedRow, FALSE);
+            }
+            updateHeader();
+            InvalidateRect(mhWnd, NULL, FALSE);
+        }
+    }
+
+    /// @brief method to set the number of threads sorting the rows (0 for the number of cores)
+    void setSortThreads(size_t threads) {
+        sortThreads = threads;
+    }
+
+    /// @brief method to retrieve the column the rows are sorted by (-1 for the data order)
+    int getSortColumn() {
+        return sortColumn;
+    }
+
+    /// @brief method to retrieve the text of a cell
+    /// @param row ~ the view row
+    /// @param col ~ the column
+    std::string getCell(int row, int col) {
+        if (row < 0 || (size_t) row >= order.size() || col < 0 || (size_t) col >= data.columns()) {
+            return "";
+        }
+        return data.text(order[row], col);
+    }
+
+    /// @brief method to retrieve the number of rows
+    size_t getRowCount() {
+        return data.rows();
+    }
+
+    /// @brief method to retrieve the number of columns
+    size_t getColumnCount() {
+        return data.columns();
+    }
+
+    /// @brief method to retrieve the selected view row (-1 if none)
+    int getSelectedRow() {
+        return selectedRow;
+    }
+
+    /// @brief method to retrieve the data row (i.e. order of appending) of the selected row
+    int getSelectedDataRow() {
+        if (selectedRow < 0 || (size_t) selectedRow >= order.size()) {
+            return -1;
+        }
+        return (int) order[selectedRow];
+    }
+
+    /// @brief method to retrieve the rows of the table
+    const ColumnStore& getData() {
+        return data;
+    }
+
+    /// @brief method to retrieve the number of cells requested by the control
+    size_t getCellsRequested() {
+        return cellsRequested;
+    }
+
+    /// @brief method to retrieve the time taken by the last sort (in microseconds)
+    long long getSortTime() {
+        return sortTime;
+    }
+
+    #ifndef NDEBUG
+    /// @brief method to Log the size & the sort/request counters (DEBUG)
+    void LogTableData() {
+        LOG(("Table rows: " + std::to_string(data.rows())).c_str());
+        LOG(("Table columns: " + std::to_string(data.columns())).c_str());
+        LOG(("Table sort column: " + std::to_string(sortColumn)).c_str());
+        LOG(("Table sort time (us): " + std::to_string(sortTime)).c_str());
+        LOG(("Table cells requested: " + std::to_string(cellsRequested)).c_str());
+    }
+    #endif
+
+public:
+
+    /// @brief override base class create method
+    ///        to ensure that the columns & rows show ..
+    virtual bool create() override {
+
+        // the list-view class is registered by the common controls ...
+        INITCOMMONCONTROLSEX icc { };
+        icc.dwSize = sizeof(INITCOMMONCONTROLSEX);
+        icc.dwICC = ICC_LISTVIEW_CLASSES;
+        InitCommonControlsEx(&icc);
+
+        bool success = xWidget::create();
+
+        if (success) {
+            SendMessage(
+                mhWnd, LVM_SETEXTENDEDLISTVIEWSTYLE, 0,
+                LVS_EX_FULLROWSELECT | LVS_EX_DOUBLEBUFFER
+            );
+            for (size_t col = 0; col < data.columns(); col++) {
+                insertColumn(col);
+            }
+            refresh();
+
+            setWidth(m_w);
+            setHeight(m_h);
+        }
+
+        // return based on whether
+        // the item was created successfully ...
+        return success;
+    }
+
+    /// @brief interface override method to associate a click event callback/action
+    /// @param callback ~ function pointer of the action to invoke upon click event detected
+    virtual void setOnClick(event_onClick callback) override {
+        mOnClick = std::move(callback);
+    }
+
+    /// @brief interface override method to associate a double click event callback/action
+    /// @param callback ~ function pointer of the action to invoke upon double click event detected
+    virtual void setOnDoubleClick(event_onDoubleClick callback) override {
+        mOnDoubleClick = std::move(callback);
+    }
+
+    /// @brief method to combine width/height adjustment into a single call
+    /// @param w ~ integer width to apply for the control
+    /// @param h ~ integer height to apply for the control
+    void setDimensions(int w, int h) {
+        setWidth(w);
+        setHeight(h);
+    }
+
+    /// @brief override method to handle the (notification) messages of the control
+    virtual LRESULT HandleMessage(UINT msg, WPARAM wParam, LPARAM lParam) override {
+
+        switch (msg) {
+
+            // DON'T REMOVE!
+            case WM_PAINT: {
+                return 0;
+            }
+
+            // DON'T REMOVE!
+            case WM_NCPAINT: {
+                return 0;
+            }
+
+            // list-view notifications (redirected by the parent window) ...
+            case WM_NOTIFY: {
+
+                LPNMHDR lpnmhdr = (LPNMHDR) lParam;
+                if (lpnmhdr->hwndFrom != mhWnd) {
+                    // i.e. the header, notifying the list-view itself
+                    return 0;
+                }
+
+                switch (lpnmhdr->code) {
+
+                    // the text of a cell in view ...
+                    case LVN_GETDISPINFO: {
+                        fillCell((NMLVDISPINFO*) lParam);
+                        return 0;
+                    }
+
+                    // toggle the sort of the column ...
+                    case LVN_COLUMNCLICK: {
+                        LPNMLISTVIEW pListView = (LPNMLISTVIEW) lParam;
+                        const bool ascending = (pListView->iSubItem != sortColumn) || !sortAscending;
+                        sort(pListView->iSubItem, ascending);
+                        return 0;
+                    }
+
+                    case LVN_ITEMCHANGED: {
+                        LPNMLISTVIEW pListView = (LPNMLISTVIEW) lParam;
+                        if (!(pListView->uChanged & LVIF_STATE)) {
+                            return 0;
+                        }
+                        const bool wasSelected = (pListView->uOldState & LVIS_SELECTED) != 0;
+                        const bool isSelected = (pListView->uNewState & LVIS_SELECTED) != 0;
+                        if (isSelected && !wasSelected) {
+                            selectedRow = pListView->iItem;
+                        } else if (wasSelected && !isSelected
+                            && (pListView->iItem == selectedRow || pListView->iItem == -1)) {
+                            selectedRow = -1;
+                        } else {
+                            return 0;
+                        }
+                        // invoke on-selection-change callback trigger action ...
+                        if (mOnSelectionChange) {
+                            selectionGate.post(); // now or deferred (see `setOnSelectionChange(..., policy)`)
+                        }
+                        return 0;
+                    }
+
+                    case NM_CLICK: {
+                        if (mOnClick) {
+                            mOnClick(this);
+                        }
+                        return 0;
+                    }
+
+                    case NM_DBLCLK: {
+                        if (mOnDoubleClick) {
+                            mOnDoubleClick(this);
+                        }
+                        return 0;
+                    }
+                }
+
+                return 0;
+            }
+        }
+
+        return DefWindowProc(mhWnd, msg, wParam, lParam);
+    }
+
+    // ...
+};
+
+#endif // end of xTABLE_H
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
@@ -34,6 +34,43 @@ protected:
     std::string mDefaultText = ""; // empty narrow string
     #endif
 
+    /// @brief   the text model of the textbox
+    /// @details edits are applied incrementally upon `EN_CHANGE`,
+    ///          rather than copying the whole control text per keystroke
+    #if defined(UNICODE) && defined(_UNICODE)
+    WPieceTable mBuffer;
+    #else
+    PieceTable mBuffer;
+    #endif
+
+    /// @brief start of the selection before the pending edit,
+    ///        recorded as edit input arrives (see `rememberSelection()`)
+    size_t selStart = 0;
+
+    /// @brief flag to rebuild `mBuffer` from the control upon the next `EN_CHANGE`,
+    ///        for edits that cannot be inferred from the selection (i.e. undo)
+    bool resync = true;
+
+    /// @brief flag to skip the next `EN_CHANGE`, the text model being set
+    ///        to the control rather than the reverse (see `replaceAll(...)`)
+    bool applied = false;
+
+    /// @brief offset of the last edit (see `TextDelta`)
+    size_t editOffset = 0;
+    /// @brief number of characters removed by the last edit
+    size_t editRemoved = 0;
+    /// @brief characters inserted by the last edit (storage re-used between edits)
+    std::basic_string<TCHAR> editInserted;
+
+    /// @brief number of text-change events dispatched
+    size_t textEvents = 0;
+    /// @brief number of characters copied to materialize the whole text for listeners
+    size_t textCopied = 0;
+
+    /// @brief   delivers text-change events according to a policy (immediate by default)
+    /// @details delta listeners are always immediate, a delta describing a single edit
+    xEventGate textChangeGate{ [this]() { deliverTextChange(); } };
+
 protected:
 
     /// @remark alias for void(*)(...) function pointer signature
@@ -55,6 +92,29 @@ public:
         mOnTextChange = std::move(callback);
     }
 
+    /// @brief   method to attach an on-text-change event listener
+    ///          delivered according to a policy
+    /// @details i.e. `EventPolicy::debounce(200)` for search-as-you-type listeners,
+    ///          which then receive the text once per burst of keystrokes
+    void setOnTextChange(event_onTextChange callback, EventPolicy policy) {
+        setOnTextChange(std::move(callback));
+        textChangeGate.setPolicy(policy);
+    }
+
+    /// @brief method to retrieve the gate delivering text-change events,
+    ///        i.e. for the delivered/dropped counters or to `flush()` a pending event
+    xEventGate& getTextChangeGate() {
+        return textChangeGate;
+    }
+
+    /// @brief   override interface method to update/change/set
+    /// an on-text-delta event listener to the textbox
+    /// @details the listener receives the edit (offset, removed length & inserted
+    ///          characters) rather than a copy of the whole text per change
+    virtual void setOnTextDelta(event_onTextDelta callback) {
+        mOnTextDelta = std::move(callback);
+    }
+
     /// @brief 
     /// @param callback 
     /// @note  This method is not an interface override,
@@ -166,6 +226,8 @@ protected:
             | WS_CHILD   | ES_WANTRETURN
             | WS_TABSTOP | WS_CLIPSIBLINGS
         );
+        // the model starts with the constructor text ...
+        mBuffer.assign(mText);
     }
     
 public:
@@ -198,22 +260,25 @@ protected:
     ///        original state can never be recovered
     void transformCase(TextCase textcase) {
 
-        if (textcase == TextCase::UPPER) {
+        if (textcase == TextCase::NORMAL) {
+            return;
+        }
 
-            #if defined(UNICODE) && defined(_UNICODE)
-                for (wchar_t& c : mText) { c = std::towupper(c); }
-            #else
-                for (char& c : mText) { c = std::toupper(c); }
-            #endif
+        #if defined(UNICODE) && defined(_UNICODE)
+        std::wstring text = mBuffer.str();
+        #else
+        std::string text = mBuffer.str();
+        #endif
 
+        // locale-independent, in place (UTF-16 in `UNICODE` builds, UTF-8 otherwise)
+        if (textcase == TextCase::UPPER) {
+            CaseMap::toUpper(text);
         } else if (textcase == TextCase::LOWER) {
-
-            #if defined(UNICODE) && defined(_UNICODE)
-                for (wchar_t& c : mText) { c = std::towlower(c); }
-            #else
-                for (char& c : mText) { c = std::tolower(c); }
-            #endif
+            CaseMap::toLower(text);
         }
+
+        mText = text;
+        mBuffer.assign(std::move(text));
     }
 
     /// @brief   variable storing the character limit
@@ -452,10 +517,10 @@ protected:
         // std::cout << "getDefaultText() => " << getDefaultText() << std::endl;
         // std::cout << "getText().empty() => " << getText().empty() << std::endl;
 
-        if (getText().empty()) {
+        if (mBuffer.empty()) {
             // if so, restore the textbox text to default ..
             setText(getDefaultText()); // set the text to default ...
-            SetWindowText(mhWnd, mText.c_str());
+            updateText();
         }
     }
 
@@ -463,28 +528,285 @@ protected:
     ///        the text view in the control, i.e.
     ///        to reflect that of the internal state!
     void updateText() {
-        SetWindowText(mhWnd, mText.c_str());
+        // the control may transform the text (i.e. `ES_UPPERCASE`) => read back
+        resync = true;
+        SetWindowText(mhWnd, mBuffer.str().c_str());
     }
 
-    /// @brief helper method to update the text
-    ///        of the win32 control upon `EN_CHANGE`
-    ///        (text-change) notification received ...
-    void pullText() {
-        
+    /// @brief helper method to convert text to the `TCHAR` text of the model
+    static std::basic_string<TCHAR> toTChar(const std::string& text) {
         #if defined(UNICODE) && defined(_UNICODE)
-        wchar_t buffer[characterLimit]; // 
+        return StrConverter::StringToWString(text);
         #else
-        char buffer[characterLimit+1]; // extra character for '\0'
+        return text;
         #endif
-                
-        GetWindowText(mhWnd, buffer, sizeof(buffer));
-        
+    }
+
+    /// @brief helper method to record the selection before an edit is applied
+    ///        by the control (key, character, clipboard & replace messages)
+    void rememberSelection() {
+        if (!exists) {
+            return;
+        }
+        DWORD first = 0, last = 0;
+        SendMessage(mhWnd, EM_GETSEL, (WPARAM) &first, (LPARAM) &last);
+        selStart = first;
+    }
+
+    /// @brief      helper method to copy characters of the control text
+    /// @param[in]  first ~ offset of the first character
+    /// @param[in]  count ~ number of characters
+    /// @param[out] out ~ receives the characters
+    /// @details    multi-line controls expose their buffer (`EM_GETHANDLE`), so only the
+    ///             requested characters are copied. Single-line controls copy the text up
+    ///             to the last requested character (`EM_GETLINE`), never the text after it
+    void readText(size_t first, size_t count, std::basic_string<TCHAR>& out) {
+
+        out.clear();
+        if (count == 0) {
+            return; // i.e. deletion
+        }
+        const size_t end = first + count;
+
+        if (GetWindowLongPtr(mhWnd, GWL_STYLE) & ES_MULTILINE) {
+            HLOCAL hText = (HLOCAL) SendMessage(mhWnd, EM_GETHANDLE, 0, 0);
+            const TCHAR* pText = hText ? (const TCHAR*) LocalLock(hText) : nullptr;
+            if (pText) {
+                out.assign(pText + first, count);
+                LocalUnlock(hText);
+                return;
+            }
+        } else if (end <= 0xFFFF) {
+            // the first `WORD` of the buffer holds its size (in characters)
+            std::vector<TCHAR> buffer(std::max(end, sizeof(WORD) / sizeof(TCHAR)));
+            *(WORD*) buffer.data() = (WORD) end;
+            const size_t copied = (size_t) SendMessage(mhWnd, EM_GETLINE, 0, (LPARAM) buffer.data());
+            if (first < copied) {
+                out.assign(buffer.data() + first, std::min(count, copied - first));
+            }
+            return;
+        }
+
+        int length = GetWindowTextLength(mhWnd);
+        std::vector<TCHAR> buffer(length + 1);
+        GetWindowText(mhWnd, buffer.data(), length + 1);
+        if (first < (size_t) length) {
+            out.assign(buffer.data() + first, std::min(count, (size_t) length - first));
+        }
+    }
+
+    /// @brief helper method to rebuild the text model from the control (whole text)
+    void reloadText() {
+        int length = GetWindowTextLength(mhWnd);
+        std::vector<TCHAR> buffer(length + 1);
+        length = GetWindowText(mhWnd, buffer.data(), length + 1);
+
+        // reported as replacing the whole text ...
+        editOffset = 0;
+        editRemoved = mBuffer.size();
+        editInserted.assign(buffer.data(), length);
+
+        mBuffer.assign(editInserted);
+        rememberSelection();
+    }
+
+    /// @brief   helper method to update the text model
+    ///          upon `EN_CHANGE` (text-change) notification received ...
+    /// @details The edit is inferred rather than copied: the text after the caret
+    ///          is unchanged, so the edit replaced the characters from the selection
+    ///          (before the edit) up to the caret, & only the inserted characters
+    ///          are read from the control. Any inconsistency rebuilds the model
+    void pullText() {
+
+        if (applied) {
+            applied = false;
+            return;
+        }
+
+        if (resync) {
+            resync = false;
+            reloadText();
+            return;
+        }
+
+        size_t oldLength = mBuffer.size();
+        size_t newLength = (size_t) GetWindowTextLength(mhWnd);
+
+        DWORD first = 0, caret = 0;
+        SendMessage(mhWnd, EM_GETSEL, (WPARAM) &first, (LPARAM) &caret);
+
+        // characters following the caret are unchanged ...
+        size_t start = std::min(selStart, (size_t) caret);
+        if (caret > newLength || caret + oldLength < newLength) {
+            reloadText();
+            return;
+        }
+        size_t oldEnd = caret + oldLength - newLength;
+        if (oldEnd < start || oldEnd > oldLength) {
+            reloadText();
+            return;
+        }
+
+        readText(start, caret - start, editInserted);
+        if (editInserted.size() != caret - start) {
+            reloadText();
+            return;
+        }
+
+        editOffset = start;
+        editRemoved = oldEnd - start;
+        mBuffer.replace(start, editRemoved, editInserted.data(), editInserted.size());
+        selStart = caret;
+    }
+
+    /// @brief helper method to dispatch the last edit to the text-change listeners
+    void dispatchTextChange() {
+
+        if (!mOnTextDelta && !mOnTextChange) {
+            return;
+        }
+        textEvents++;
+
+        if (mOnTextDelta) {
+            TextDelta delta(editOffset, editRemoved, editInserted, mBuffer.snapshot(), &textCopied);
+            mOnTextDelta(this, delta);
+        }
+
+        // legacy listeners receive the whole text, now or deferred ...
+        if (mOnTextChange) {
+            textChangeGate.post();
+        }
+    }
+
+    /// @brief helper method to deliver the (current) whole text to the text-change listener
+    void deliverTextChange() {
+        if (mOnTextChange) {
+            textCopied += mBuffer.size();
+            mOnTextChange(this, getText());
+        }
+    }
+
+public:
+
+    /// @brief   override method for retrieving the text of the textbox
+    /// @details copied from the text model, i.e. not synchronized with `mText` per edit
+    virtual std::string getText() override {
         #if defined(UNICODE) && defined(_UNICODE)
-        setText(StrConverter::WStringToString(std::wstring(buffer)));
+        return StrConverter::WStringToString(mBuffer.str());
         #else
-        setText(std::string(buffer));
+        return mBuffer.str();
         #endif
     }
+
+    /// @brief  method to retrieve the number of characters of the textbox
+    size_t getTextLength() {
+        return mBuffer.size();
+    }
+
+    /// @brief   alias for the search of the text model (`TCHAR` text)
+    /// @details options are `TextFinder::IGNORE_CASE` & `TextFinder::WHOLE_WORD`
+    #if defined(UNICODE) && defined(_UNICODE)
+    using TextFinder = WTextSearch;
+    #else
+    using TextFinder = TextSearch;
+    #endif
+
+    /// @brief     method to find the first occurrence of a text
+    /// @param[in] text ~ the searched text
+    /// @param[in] from ~ offset (in characters) the search starts at
+    /// @param[in] flags ~ `TextFinder::Flags` combined with `|`
+    /// @return    offset of the occurrence, `TextFinder::npos` if none
+    size_t find(const std::string& text, size_t from = 0, unsigned flags = TextFinder::NONE) {
+        return TextFinder(toTChar(text), flags).find(mBuffer, from);
+    }
+
+    /// @brief     method to find every (non-overlapping) occurrence of a text
+    /// @param[in] text ~ the searched text
+    /// @param[in] flags ~ `TextFinder::Flags` combined with `|`
+    /// @return    the ranges (offset & length, in characters) of the occurrences
+    std::vector<TextFinder::Match> findAll(const std::string& text, unsigned flags = TextFinder::NONE) {
+        return TextFinder(toTChar(text), flags).findAll(mBuffer);
+    }
+
+    /// @brief     method to replace every occurrence of a text
+    /// @param[in] text ~ the searched text
+    /// @param[in] with ~ the replacement text
+    /// @param[in] flags ~ `TextFinder::Flags` combined with `|`
+    /// @return    number of occurrences replaced
+    /// @details   the text model is edited in a single pass, then set to the control
+    ///            at once (a single text-change event, reported as replacing the whole text)
+    ///            ~ dispatched here for multi-line controls, which send no `EN_CHANGE` for it
+    size_t replaceAll(const std::string& text, const std::string& with, unsigned flags = TextFinder::NONE) {
+
+        const size_t oldLength = mBuffer.size();
+        const size_t count = TextFinder(toTChar(text), flags).replaceAll(mBuffer, toTChar(with));
+        if (count == 0) {
+            return 0;
+        }
+
+        if (!exists) {
+            mText = mBuffer.str();
+            return count;
+        }
+
+        editOffset = 0;
+        editRemoved = oldLength;
+        editInserted.clear();
+        if (mOnTextDelta) {
+            editInserted = mBuffer.str();
+        }
+
+        // multi-line controls do not notify `WM_SETTEXT` (no `EN_CHANGE`) ...
+        const bool notifies = !(GetWindowLongPtr(mhWnd, GWL_STYLE) & ES_MULTILINE);
+
+        // the control may transform the text (i.e. `ES_UPPERCASE`) => read back
+        if (notifies) {
+            if (textCase == TextCase::NORMAL) {
+                applied = true;
+            } else {
+                resync = true;
+            }
+        }
+        SetWindowText(mhWnd, mBuffer.str().c_str());
+
+        // ... => the model is synchronized & the change dispatched here
+        if (!notifies) {
+            resync = false;
+            if (textCase == TextCase::NORMAL) {
+                rememberSelection();
+            } else {
+                reloadText();
+            }
+            dispatchTextChange();
+        }
+        return count;
+    }
+
+    /// @brief  method to retrieve the number of text-change events dispatched
+    size_t getTextEvents() {
+        return textEvents;
+    }
+
+    /// @brief  method to retrieve the number of characters copied for text-change listeners
+    /// @return characters materialized by `getText()` for `setOnTextChange(...)` listeners
+    ///         & by `TextDelta::text()`, i.e. `0` for delta listeners not reading the whole text
+    size_t getTextCopied() {
+        return textCopied;
+    }
+
+    #ifndef NDEBUG
+    /// @brief method to Log the text-change counters (DEBUG)
+    void LogTextBoxData() {
+        LOG(("Text length: " + std::to_string(mBuffer.size())).c_str());
+        LOG(("Text pieces: " + std::to_string(mBuffer.pieceCount())).c_str());
+        LOG(("Text-change events: " + std::to_string(textEvents)).c_str());
+        LOG(("Text characters copied: " + std::to_string(textCopied)).c_str());
+        LOG(("Text-change events delivered: " + std::to_string(textChangeGate.getDelivered())).c_str());
+        LOG(("Text-change events dropped: " + std::to_string(textChangeGate.getDropped())).c_str());
+    }
+    #endif
+
+protected:
     
     virtual void setText(const std::string& text) override {
         #if defined(UNICODE) && defined(_UNICODE)
@@ -496,6 +818,7 @@ protected:
         // just copy the data directly into `mText`
         mText = text;
         #endif
+        mBuffer.assign(mText);
         // DON'T update window ...
         // if (exists) {
         //     SetWindowText(mhWnd, mText.c_str());
@@ -541,6 +864,42 @@ public:
         return 0;
     }
 
+    /// @brief   override method observing edit input before the control applies it
+    /// @details records the selection the edit replaces (see `pullText()`), never consumes
+    virtual bool InterceptMessage(UINT msg, WPARAM wParam, LPARAM lParam, LRESULT& result) override {
+
+        UNUSED(lParam);
+        UNUSED(result);
+
+        switch(msg) {
+
+            case WM_CHAR: {
+                if (wParam == 0x1A) { // Ctrl+Z ~ undo
+                    resync = true;
+                }
+                rememberSelection();
+                break;
+            }
+
+            case WM_KEYDOWN:
+            case WM_PASTE:
+            case WM_CUT:
+            case WM_CLEAR:
+            case EM_REPLACESEL: {
+                rememberSelection();
+                break;
+            }
+
+            case WM_UNDO:
+            case EM_UNDO: {
+                resync = true;
+                break;
+            }
+        }
+
+        return false;
+    }
+
     /// @brief `xTextBox` derived class main message loop ...
     virtual LRESULT HandleMessage(UINT msg, WPARAM wParam, LPARAM lParam) override {
 
@@ -573,9 +932,7 @@ public:
                             pullText();
                         // }
                         
-                        if (mOnTextChange) {
-                            mOnTextChange(this, getText());
-                        }
+                        dispatchTextChange();
                         // do something ...
                         break;
                     }
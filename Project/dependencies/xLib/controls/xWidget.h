@@ -733,7 +733,8 @@ public:
   /// @details
   /// In the context of `xButton` this retrieves the button text <br/>
   /// In the context of `xFrame` this retrieves the frame/ title <br/>
-  std::string getText() {
+  /// `virtual` for widgets keeping their own text model, i.e. `xTextBox`
+  virtual std::string getText() {
     // return mText;
     #if defined(UNICODE) && defined(_UNICODE)
     return StrConverter::WStringToString(mText);
@@ -742,6 +743,34 @@ public:
     #endif
   }
 
+  /// @brief   method for measuring the text of a widget
+  /// @details measured from the cached metrics of the widget font (`DEFAULT_GUI_FONT` if none),
+  ///          i.e. without any GDI call once the characters have been seen
+  /// @return  width of the widest line & height of all lines (in pixels)
+  SIZE measureText() {
+    TextMetrics::Size size = (pFont && pFont->hFont)
+      ? pFont->metrics().measure(mText)
+      : xFont::metricsOf((HFONT) GetStockObject(DEFAULT_GUI_FONT)).measure(mText);
+    return SIZE{ size.width, size.height };
+  }
+
+  /// @brief   method for rendering the text of a widget into an (off-screen) bitmap
+  /// @details software path ~ the glyphs are composited from the atlas of the widget
+  ///          font, in the widget text color, without any `DrawText(...)`
+  /// @param[in] pTarget ~ pointer of the (`PixelFormat32bppPARGB`) bitmap to draw into
+  /// @param[in] x ~ left of the text
+  /// @param[in] y ~ top of the text
+  void renderText(Gdiplus::Bitmap* pTarget, int x = 0, int y = 0) {
+    if (!pFont || !pFont->hFont) {
+      return;
+    }
+    #if defined(UNICODE) && defined(_UNICODE)
+    pFont->drawText(pTarget, x, y, mText, colorFG);
+    #else
+    pFont->drawText(pTarget, x, y, StrConverter::StringToWString(mText), colorFG);
+    #endif
+  }
+
 protected:
 
   /// @brief container storing `xWidget*` pointers of children for `this` instance
@@ -876,6 +905,20 @@ public:
    */ 
   virtual LRESULT HandleMessage(UINT msg, WPARAM wParam, LPARAM lParam) = 0;
 
+  /**
+   * @brief      virtual method allowing derived types to consume a message before the control processes it
+   * @return    `true` if the message was handled, i.e. NOT forwarded to the default (control) procedure
+   * @param[in]  msg, wParam, lParam ~ the same parameters as received by `HandleMessage(...)`
+   * @param[out] result ~ receives the value returned to the OS for consumed messages
+   */
+  virtual bool InterceptMessage(UINT msg, WPARAM wParam, LPARAM lParam, LRESULT& result) {
+    UNUSED(msg);
+    UNUSED(wParam);
+    UNUSED(lParam);
+    UNUSED(result);
+    return false;
+  }
+
   /**
    * @brief    method for registering a new window/`xWidget` class
    * @return   boolean flag whether or not registration was successful => never used!
@@ -1250,7 +1293,7 @@ protected:
   /*%*%*%*%*/
 
   /// @brief pointer to `xFont` object used by the `xWidget`
-  /// @todo define a global/shared font mechanism
+  /// @note  its font handle is shared by all widgets using the same font (see `xFontCache`)
   xFont* pFont = nullptr;
   // /// @brief store ref to previous font for cleanup
   // xFont* prevFont = nullptr; // takes memory resources ...
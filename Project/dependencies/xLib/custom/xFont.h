@@ -16,7 +16,12 @@ class xFont;
 #ifndef xSYSFONT_H
 #define xSYSFONT_H
 
-#include <set>
+#include <chrono> // for timing the collection of the fonts
+#include <condition_variable> // for waiting on the background collection
+#include <cstdint>
+#include <mutex>
+#include <thread> // for collecting the fonts in the background
+#include <vector>
 
 /**
  * @class    xSystemFont
@@ -24,6 +29,11 @@ class xFont;
  * @details `xSystemFont` manages `xApp` available `xFont`s & provides
  *           an interface for collecting OS fonts & setting
  *           a global font for the `xApp`
+ * @note     The font catalogue is collected on a background thread
+ *           (started by `CollectSystemFonts()` or by the first lookup),
+ *           & cached on disk, stamped with the state of the Fonts registry keys,
+ *           so that later runs skip enumerating the fonts altogether <br/>
+ *           Lookups wait for the collection to complete
  */
 class xSystemFont {
 
@@ -42,7 +52,7 @@ private:
     /// @param lpelfex ~  long pointer to `ENUMLOGFONTSEX` struct
     /// @param lpntmex ~  unused   [see `macro.h`]
     /// @param FontType ~ unused   [see `macro.h`]
-    /// @param lParam ~   implicit [see `macro.h`]
+    /// @param lParam ~   pointer to the `std::vector<std::string>` receiving the font names
     /// @return 
     static int CALLBACK EnumFontFamExProc(
         ENUMLOGFONTEX* lpelfex, NEWTEXTMETRICEX* lpntmex,
@@ -51,31 +61,23 @@ private:
 
         // mark unused params
         UNUSED(lpntmex);
-        UNUSED(lParam);
         IMPLICIT(FontType);
 
         // extract the font name from lpelfex
         // Take care of both `ANSI` & `UNICODE`
         #if defined(UNICODE) && defined(_UNICODE)
-        std::wstringstream ss;
-        ss << lpelfex->elfFullName; // extract font name
-        #else
-        std::stringstream ss;
-        ss << lpelfex->elfFullName; // extract font name
-        #endif
-
-        // convert the string stream to string
-        #if defined(UNICODE) && defined(_UNICODE)
-        std::string str = StrConverter::WStringToString(ss.str());
+        std::string str = StrConverter::WStringToString(
+            reinterpret_cast<const wchar_t*>(lpelfex->elfFullName)
+        );
         #else
-        std::string str = ss.str();
+        std::string str = reinterpret_cast<const char*>(lpelfex->elfFullName);
         #endif
 
         // clean the extracted font name
-        // & add it to set<std::string> gFontFamilies;
+        // & add it to the collected names (duplicates removed by `StrTable`)
         // clean ~ remove font's pre-pended with '@' character
         if (!(str.find('@') < str.length())) {
-            gFontFamilies.insert(str);
+            reinterpret_cast<std::vector<std::string>*>(lParam)->push_back(str);
         }
 
         // important:
@@ -84,31 +86,153 @@ private:
         return 1;
     };
 
-    /// @brief using a set to store strings of all available fonts.
-    /// The set is used because it removes any duplicate elements,
-    /// & enumerating the fonts may actually give duplicate names,
-    /// depending on how the fonts are enumerated.
-    static std::set<std::string> gFontFamilies;
+    /// @brief sorted catalogue of all available fonts, in a contiguous arena.
+    /// Enumerating the fonts may give duplicate names,
+    /// depending on how the fonts are enumerated, which `StrTable` removes
+    StrTable catalogue;
+
+    /// @brief background thread collecting the catalogue
+    std::thread worker;
+
+    /// @brief mutex & condition variable signalling the collection is complete
+    std::mutex mtx;
+    std::condition_variable cv;
+
+    /// @brief flag indicating the collection was started
+    bool started = false;
+    /// @brief flag indicating the catalogue is complete
+    bool ready = false;
+
+    /// @brief flag indicating the catalogue was read from the disk cache
+    bool cached = false;
+    /// @brief time (in milliseconds) taken to collect the catalogue
+    long long collectMs = 0;
 
     /// @brief default constructor
     xSystemFont() = default;
 
+    /// @brief destructor ~ waits for the background collection (if any)
+    ~xSystemFont() {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+
+    /// @brief  helper method to compute the stamp validating the disk cache
+    /// @return hash of the last write time & value count of the Fonts registry keys
+    ///         (machine & per-user), which change whenever a font is (un)installed
+    static std::uint64_t CatalogueStamp() {
+        std::uint64_t stamp = 14695981039346656037ULL; // FNV-1a offset basis
+        HKEY roots[] = { HKEY_LOCAL_MACHINE, HKEY_CURRENT_USER };
+        for (HKEY root : roots) {
+            HKEY hKey;
+            if (RegOpenKeyExA(root, "SOFTWARE\\Microsoft\\Windows NT\\CurrentVersion\\Fonts", 0, KEY_READ, &hKey) != ERROR_SUCCESS) {
+                continue;
+            }
+            DWORD values = 0;
+            FILETIME lastWrite = { 0, 0 };
+            RegQueryInfoKeyA(hKey, NULL, NULL, NULL, NULL, NULL, NULL, &values, NULL, NULL, NULL, &lastWrite);
+            RegCloseKey(hKey);
+            std::uint64_t parts[] = {
+                (static_cast<std::uint64_t>(lastWrite.dwHighDateTime) << 32) | lastWrite.dwLowDateTime,
+                values
+            };
+            for (std::uint64_t part : parts) {
+                stamp ^= part;
+                stamp *= 1099511628211ULL; // FNV-1a prime
+            }
+        }
+        return stamp;
+    }
+
+    /// @brief  helper method to retrieve the path of the disk cache
+    /// @return "%LOCALAPPDATA%\xLib\fonts.xstb" or empty string if unavailable
+    static std::string CataloguePath() {
+        char buffer[MAX_PATH];
+        DWORD length = GetEnvironmentVariableA("LOCALAPPDATA", buffer, MAX_PATH);
+        if (length == 0 || length >= MAX_PATH) {
+            return "";
+        }
+        std::string dir = std::string(buffer, length) + "\\xLib";
+        CreateDirectoryA(dir.c_str(), NULL); // fails harmlessly if it exists
+        return dir + "\\fonts.xstb";
+    }
+
+    /// @brief method (background thread) to load the catalogue from the disk cache,
+    ///        or to enumerate the system fonts (& refresh the cache) if stale
+    void LoadCatalogue() {
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        StrTable table;
+        std::uint64_t stamp = CatalogueStamp();
+        std::string path = CataloguePath();
+
+        bool fromCache = !path.empty() && table.load(path, stamp);
+
+        if (!fromCache) {
+            std::vector<std::string> names;
+            LOGFONT lFont; // LOGFONT to fill in font details
+            // c-style clear LOGFONT struct members
+            memset(&lFont, 0, sizeof(LOGFONT));
+            // as per MSDN, enumerate ALL fonts as follows ...
+            lFont.lfFaceName[0] = '\0'; // note* use of '\0'
+            lFont.lfCharSet = DEFAULT_CHARSET; // all character sets ...
+            HDC hDC = GetDC(NULL); // get device context handle
+            // invoke callback function ...
+            EnumFontFamiliesEx(hDC, &lFont, (FONTENUMPROC) EnumFontFamExProc, (LPARAM) &names, 0);
+            ReleaseDC(NULL, hDC); // free device context handle
+            table.assign(std::move(names));
+            if (!path.empty()) {
+                table.save(path, stamp);
+            }
+        }
+
+        long long ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            catalogue = std::move(table);
+            cached = fromCache;
+            collectMs = ms;
+            ready = true;
+        }
+        cv.notify_all();
+
+        LOG((
+            "xSystemFont: " + std::to_string(catalogue.size()) + " fonts collected from "
+            + (fromCache ? "disk cache" : "enumeration") + " in " + std::to_string(ms) + " ms"
+        ).c_str());
+    }
+
 public:
 
-    /// @brief   method to populate set of available system fonts
+    /// @brief   method to start collecting the available system fonts
     /// @details This method is invoked upon app startup by `xApp` manager
-    ///          to ensure all the system fonts are loaded & ready for use
+    ///          & returns immediately, the fonts are collected in the background
     void CollectSystemFonts() {
-        LOGFONT lFont; // LOGFONT to fill in font details
-        // c-style clear LOGFONT struct members
-        memset(&lFont, 0, sizeof(LOGFONT));
-        // as per MSDN, enumerate ALL fonts as follows ...
-        lFont.lfFaceName[0] = '\0'; // note* use of '\0'
-        lFont.lfCharSet = DEFAULT_CHARSET; // all character sets ...
-        HDC hDC = GetDC(NULL); // get device context handle
-        // invoke callback function ...
-        EnumFontFamiliesEx(hDC, &lFont, (FONTENUMPROC) EnumFontFamExProc, (DWORD) NULL, 0);
-        DeleteDC(hDC); // free device context handle
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            if (started) {
+                return;
+            }
+            started = true;
+        }
+        worker = std::thread(&xSystemFont::LoadCatalogue, this);
+        LOG((
+            "xSystemFont: startup cost "
+            + std::to_string(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count())
+            + " us"
+        ).c_str());
+    }
+
+    /// @brief method to wait until the catalogue is complete,
+    ///        starting the collection if not done yet
+    void WaitForFonts() {
+        CollectSystemFonts();
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait(lock, [this]() { return ready; });
     }
 
     /// @brief method to destroy the resources
@@ -140,11 +264,10 @@ public:
     ///          to enumerate all the available system fonts
     ///          installed on the platform
     void EnumerateSystemFonts() {
-        // define set iterator
-        std::set<std::string>::iterator i;
-        // iterate the elements in the set
-        for (i = gFontFamilies.begin(); i != gFontFamilies.end(); i++) {
-            std::cout << *i << std::endl; // deref & console out
+        WaitForFonts();
+        // iterate the fonts in (case-insensitive) sorted order
+        for (size_t i = 0; i < catalogue.size(); i++) {
+            std::cout << catalogue.at(i) << std::endl; // console out
         }
     }
     #endif // NDEBUG
@@ -154,8 +277,50 @@ public:
     ///            whether a specifified font exists before create
     /// @param[in] font ~ the font to find in the set of system fonts
     bool FindFont(const std::string& font) {
-        // "short-hand" for finding element in an STL container
-        return (gFontFamilies.find(font) != gFontFamilies.end());
+        WaitForFonts();
+        // binary search in the sorted catalogue
+        return (catalogue.find(font) != StrTable::npos);
+    }
+
+    /// @brief     method to find a font ignoring case, i.e. "arial" => "Arial"
+    /// @param[in] font ~ the font to find in the set of system fonts
+    /// @return    the name of the font as installed, or an empty string if not found
+    std::string FindFontNoCase(const std::string& font) {
+        WaitForFonts();
+        size_t i = catalogue.findNoCase(font);
+        return (i != StrTable::npos) ? catalogue.str(i) : "";
+    }
+
+    /// @brief     method to retrieve the fonts starting with a prefix (ignoring case)
+    /// @param[in] prefix ~ the prefix of the font names, i.e. "cons" => "Consolas", ...
+    /// @return    the matching font names, in (case-insensitive) sorted order
+    std::vector<std::string> FindFontsByPrefix(const std::string& prefix) {
+        WaitForFonts();
+        std::pair<size_t, size_t> range = catalogue.prefixRange(prefix);
+        std::vector<std::string> fonts;
+        fonts.reserve(range.second - range.first);
+        for (size_t i = range.first; i < range.second; i++) {
+            fonts.push_back(catalogue.str(i));
+        }
+        return fonts;
+    }
+
+    /// @brief method to retrieve the number of available fonts
+    size_t count() {
+        WaitForFonts();
+        return catalogue.size();
+    }
+
+    /// @brief method to check whether the catalogue was read from the disk cache
+    bool isCached() {
+        WaitForFonts();
+        return cached;
+    }
+
+    /// @brief method to retrieve the time (in milliseconds) taken to collect the catalogue
+    long long getCollectTime() {
+        WaitForFonts();
+        return collectMs;
     }
 
 private:
@@ -167,7 +332,6 @@ private:
 
 /// @brief static declaration of `xSystemFont` members
 xSystemFont* xSystemFont::instance = nullptr; // init nullptr
-std::set<std::string> xSystemFont::gFontFamilies;
 
 #endif // end of xSYSFONT_H
 
@@ -179,6 +343,9 @@ std::set<std::string> xSystemFont::gFontFamilies;
  * @class    xFont
  * @brief    For working with `xFont` objects
  * @details `xFont` provides an interface for working with `xFont` objects
+ * @note     `hFont` is shared (via `xFontCache`) with every `xFont` holding
+ *           the same `LOGFONT`, so it MUST NOT be modified or deleted directly.
+ *           Changing an attribute acquires the handle of the new attributes instead
  */
 class xFont {
 
@@ -204,16 +371,13 @@ class xFont {
 
 protected:
 
-    /// @brief Win32 font handle
+    /// @brief Win32 font handle (shared, see `xFontCache`)
     HFONT hFont = (HFONT) NULL;
     /// @brief Win32 Logical Font object
     /// from which to construct other fonts
     /// using `CreateFontIndirect(...)`
     LOGFONT mLogFont;
 
-    /// @brief variable to store previous font handle for managing resources
-    HFONT hPrevFont; // This can be done in delete font method ...
-
     /// @brief variable to store the size/height of the font in pixels ...
     int mSize = 0;
 
@@ -277,10 +441,9 @@ protected:
     void setSize(int size) {
         mSize = size;
         // convert integer size in pixels to logical units ...
-        HDC hDC = GetDC(NULL);
-        long h = -MulDiv(size, GetDeviceCaps(hDC, LOGPIXELSY), 72);
+        // (screen resolution queried once by `xFontCache`)
+        long h = -MulDiv(size, xFontCache::get().logPixelsY(), 72);
         mLogFont.lfHeight = h;
-        DeleteDC(hDC);
         update();
     }
 
@@ -343,25 +506,18 @@ protected:
 
     /// @brief method for updating the font, once any
     /// properties/attributes have been changed as-well-as
-    /// cleaning up any resources after updating the font handle
+    /// releasing the previous (shared) font handle
     void update() {
         
-        // temporarily store font in `hPrevFont` for cleanup ...
-        hPrevFont = hFont;
+        // temporarily store font in `hPrevFont` for release ...
+        HFONT hPrevFont = hFont;
 
-        // create a new font from the mLogFont member & update font handle
-        hFont = CreateFontIndirect(&mLogFont);
+        // acquire the (shared) font of the mLogFont member & update font handle
+        hFont = xFontCache::get().acquire(mLogFont);
 
-        // check if hPrevFont exists/NOT NULL
+        // release the previous handle (deleted once no longer used) ...
         if (hPrevFont) {
-            // deselect the font from any device context before delete
-            HDC hDC = GetDC(NULL);
-            if (hDC) {
-                // select a stock object
-                SelectObject(hDC, GetStockObject(SYSTEM_FONT));
-                ReleaseDC(NULL, hDC);
-            }
-            DeleteObject(hPrevFont);
+            xFontCache::get().release(hPrevFont);
         }
     }
 
@@ -373,11 +529,44 @@ protected:
         LOG("releasing xFont resources ...");
         // check if hFont valid
         if (hFont) {
-            // free object
-            DeleteObject(hFont); // free hFont
+            // release the shared handle (deleted once no longer used)
+            xFontCache::get().release(hFont);
         };
     }
 
+    /// @brief     helper method to retrieve the (cached) text metrics of a font
+    /// @param[in] hFont ~ the font handle, `NULL` for the system font (as a window without `WM_SETFONT`)
+    static TextMetrics& metricsOf(HFONT hFont) {
+        if (hFont == NULL) {
+            hFont = (HFONT) GetStockObject(SYSTEM_FONT);
+        }
+        return xFontCache::get().metrics(hFont);
+    }
+
+    /// @brief  method to retrieve the text metrics of the font
+    /// @return metrics shared by every `xFont` with the same attributes
+    TextMetrics& metrics() {
+        return metricsOf(hFont);
+    }
+
+    /// @brief     method to draw text into a bitmap through the glyph atlas of the font
+    /// @param[in] pTarget ~ pointer of the bitmap to draw into
+    /// @param[in] x ~ left of the text
+    /// @param[in] y ~ top of the first line
+    /// @param[in] text ~ the text, `\n` separated lines
+    /// @param[in] color ~ the text color
+    void drawText(Gdiplus::Bitmap* pTarget, int x, int y, const std::wstring& text, COLORREF color) {
+
+        TextMetrics& tm = metrics();
+        GlyphAtlas& atlas = xFontCache::get().atlas(hFont);
+
+        int baseline = y + tm.lineMetrics().ascent;
+        for (const TextMetrics::Line& line : tm.breakLines(text, 0)) {
+            xGDI::drawText(pTarget, x, baseline, text.substr(line.begin, line.end - line.begin), atlas, &tm, color);
+            baseline += tm.lineHeight();
+        }
+    }
+
     #if defined(UNICODE) && defined(_UNICODE)
     static int calculateTextWidth(HWND hWnd, const std::wstring& text)
     #else
@@ -385,11 +574,16 @@ protected:
     #endif
     {
 
+        HFONT hWndFont = (HFONT) SendMessage(hWnd, WM_GETFONT, 0, 0);
+
+        // measure from the cached tables when possible (no GDI call once warmed up) ...
+        if (hWndFont == NULL || xFontCache::get().contains(hWndFont)) {
+            return metricsOf(hWndFont).width(text);
+        }
+
         HDC hDC = GetDC(hWnd);
 
-        HFONT hOldFont = (HFONT) SelectObject(
-            hDC, (HFONT) SendMessage(hWnd, WM_GETFONT, 0, 0)
-        );
+        HFONT hOldFont = (HFONT) SelectObject(hDC, hWndFont);
 
         SIZE size;
         GetTextExtentPoint32(hDC, text.c_str(), text.length(), &size);
@@ -408,11 +602,16 @@ protected:
     #endif
     {
 
+        HFONT hWndFont = (HFONT) SendMessage(hWnd, WM_GETFONT, 0, 0);
+
+        // measure from the cached tables when possible (no GDI call once warmed up) ...
+        if (hWndFont == NULL || xFontCache::get().contains(hWndFont)) {
+            return metricsOf(hWndFont).height(text);
+        }
+
         HDC hDC = GetDC(hWnd);
 
-        HFONT hOldFont = (HFONT) SelectObject(
-            hDC, (HFONT) SendMessage(hWnd, WM_GETFONT, 0, 0)
-        );
+        HFONT hOldFont = (HFONT) SelectObject(hDC, hWndFont);
 
         SIZE size;
         GetTextExtentPoint32(hDC, text.c_str(), text.length(), &size);
@@ -426,8 +625,6 @@ protected:
 
 }; // end of xFont
 
-/// @todo define a shared/global font mechanism
-
 #endif // end of xFONT_H
 /*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
 
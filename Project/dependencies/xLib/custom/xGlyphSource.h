@@ -0,0 +1,222 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 	  xGlyphSource.h
+  * @author   &lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  * @brief 	  contains `xGlyphSource` class declaration & implemenation
+  * @details  xGlyphSource.h defines the `xGlyphSource` class, which supplies
+  *           `TextMetrics` with the glyph advances, kerning pairs & line metrics of a GDI font,
+  *           & the `xGlyphRasterizer` class, which renders its glyphs for `GlyphAtlas`
+  */
+
+#pragma once
+
+/// @brief begin xGLYPHSOURCE_H implementation
+#ifndef xGLYPHSOURCE_H
+#define xGLYPHSOURCE_H
+
+#include <algorithm>
+#include <vector>
+
+/**
+ * @class    xGlyphSource
+ * @brief   `GlyphSource` querying a Win32 font handle
+ * @details  A memory DC compatible with the screen is created with the font selected,
+ *           & kept for the lifetime of the source (i.e. the `TextMetrics` owning it) <br/>
+ *           Each method is called at most once per page of codepoints, so GDI is not
+ *           queried any more once the text measured has been seen
+ * @remark   the font handle MUST outlive the source (see `xFontCache::metrics(...)`)
+ */
+class xGlyphSource : public GlyphSource {
+
+private:
+
+    /// @brief memory DC with `hFont` selected
+    HDC hDC = (HDC) NULL;
+    /// @brief font previously selected in `hDC`, restored on destruction
+    HGDIOBJ hOldFont = (HGDIOBJ) NULL;
+
+public:
+
+    /// @brief     constructor
+    /// @param[in] hFont ~ the measured font
+    explicit xGlyphSource(HFONT hFont) {
+        hDC = CreateCompatibleDC(NULL);
+        if (hDC) {
+            hOldFont = SelectObject(hDC, hFont);
+        }
+    }
+
+    /// @brief deleted copy constructor ~ owns its DC
+    xGlyphSource(const xGlyphSource&) = delete;
+    /// @brief deleted copy assignment operator ~ owns its DC
+    xGlyphSource& operator=(const xGlyphSource&) = delete;
+
+    /// @brief destructor ~ deselects the font & deletes the DC
+    ~xGlyphSource() {
+        if (hDC) {
+            SelectObject(hDC, hOldFont);
+            DeleteDC(hDC);
+        }
+    }
+
+    /// @brief      method to retrieve the advances of `count` consecutive codepoints
+    /// @param[in]  first ~ first codepoint
+    /// @param[in]  count ~ number of codepoints
+    /// @param[out] out ~ receives the advances (in pixels)
+    void advances(std::uint32_t first, std::size_t count, int* out) override {
+
+        std::fill(out, out + count, 0);
+        if (!hDC) {
+            return;
+        }
+
+        // Basic Multilingual Plane ~ one call for the whole range
+        std::size_t bmp = 0;
+        if (first <= 0xFFFF) {
+            bmp = std::min<std::size_t>(count, 0x10000 - first);
+            GetCharWidth32W(hDC, first, first + (UINT) bmp - 1, out);
+        }
+
+        // supplementary planes ~ measured as surrogate pairs
+        for (std::size_t i = bmp; i < count; i++) {
+            std::uint32_t cp = first + (std::uint32_t) i - 0x10000;
+            wchar_t pair[2] = {
+                (wchar_t) (0xD800 + (cp >> 10)), (wchar_t) (0xDC00 + (cp & 0x3FF))
+            };
+            SIZE size;
+            if (GetTextExtentPoint32W(hDC, pair, 2, &size)) {
+                out[i] = size.cx;
+            }
+        }
+    }
+
+    /// @brief  method to retrieve the vertical metrics of the font
+    /// @return ascent, descent & external leading (in pixels)
+    LineMetrics lineMetrics() override {
+        LineMetrics line;
+        TEXTMETRICW tm;
+        if (hDC && GetTextMetricsW(hDC, &tm)) {
+            line.ascent = tm.tmAscent;
+            line.descent = tm.tmDescent;
+            line.lineGap = tm.tmExternalLeading;
+        }
+        return line;
+    }
+
+    /// @brief      method to retrieve all the kerning pairs of the font
+    /// @param[out] pairs ~ receives the kerning pairs (in pixels)
+    void kerning(std::vector<KerningPair>& pairs) override {
+
+        pairs.clear();
+        if (!hDC) {
+            return;
+        }
+
+        DWORD count = GetKerningPairsW(hDC, 0, NULL);
+        if (count == 0) {
+            return;
+        }
+
+        std::vector<KERNINGPAIR> kp(count);
+        count = GetKerningPairsW(hDC, count, kp.data());
+
+        pairs.reserve(count);
+        for (DWORD i = 0; i < count; i++) {
+            pairs.push_back(KerningPair{ kp[i].wFirst, kp[i].wSecond, kp[i].iKernAmount });
+        }
+    }
+
+}; // end of xGlyphSource
+
+/**
+ * @class    xGlyphRasterizer
+ * @brief   `GlyphRasterizer` rendering the glyphs of a Win32 font handle
+ * @details  Glyphs are rendered by `GetGlyphOutlineW(...)` as 65-level (`GGO_GRAY8_BITMAP`)
+ *           coverage, rescaled to 0 ~ 255, from a memory DC with the font selected <br/>
+ *           Codepoints beyond the Basic Multilingual Plane are not rendered (no pixels)
+ * @remark   the font handle MUST outlive the rasterizer (see `xFontCache::atlas(...)`)
+ */
+class xGlyphRasterizer : public GlyphRasterizer {
+
+private:
+
+    /// @brief memory DC with `hFont` selected
+    HDC hDC = (HDC) NULL;
+    /// @brief font previously selected in `hDC`, restored on destruction
+    HGDIOBJ hOldFont = (HGDIOBJ) NULL;
+
+public:
+
+    /// @brief     constructor
+    /// @param[in] hFont ~ the rendered font
+    explicit xGlyphRasterizer(HFONT hFont) {
+        hDC = CreateCompatibleDC(NULL);
+        if (hDC) {
+            hOldFont = SelectObject(hDC, hFont);
+        }
+    }
+
+    /// @brief deleted copy constructor ~ owns its DC
+    xGlyphRasterizer(const xGlyphRasterizer&) = delete;
+    /// @brief deleted copy assignment operator ~ owns its DC
+    xGlyphRasterizer& operator=(const xGlyphRasterizer&) = delete;
+
+    /// @brief destructor ~ deselects the font & deletes the DC
+    ~xGlyphRasterizer() {
+        if (hDC) {
+            SelectObject(hDC, hOldFont);
+            DeleteDC(hDC);
+        }
+    }
+
+    /// @brief      method to render a codepoint
+    /// @param[in]  cp ~ codepoint
+    /// @param[out] out ~ receives the coverage & placement of the glyph
+    /// @return     `false` if GDI failed to render the codepoint
+    bool rasterize(std::uint32_t cp, GlyphBitmap& out) override {
+
+        out = GlyphBitmap();
+        if (!hDC || cp > 0xFFFF) {
+            return false;
+        }
+
+        const MAT2 identity = { { 0, 1 }, { 0, 0 }, { 0, 0 }, { 0, 1 } };
+        GLYPHMETRICS gm;
+
+        DWORD bytes = GetGlyphOutlineW(hDC, (UINT) cp, GGO_GRAY8_BITMAP, &gm, 0, NULL, &identity);
+        if (bytes == GDI_ERROR) {
+            return false;
+        }
+
+        out.advance = gm.gmCellIncX;
+        if (bytes == 0) {
+            return true; // white space ~ no pixels
+        }
+
+        std::vector<unsigned char> buffer(bytes);
+        if (GetGlyphOutlineW(hDC, (UINT) cp, GGO_GRAY8_BITMAP, &gm, bytes, buffer.data(), &identity) == GDI_ERROR) {
+            return false;
+        }
+
+        out.width = (int) gm.gmBlackBoxX;
+        out.height = (int) gm.gmBlackBoxY;
+        out.left = gm.gmptGlyphOrigin.x;
+        out.top = gm.gmptGlyphOrigin.y;
+        out.coverage.resize((size_t) out.width * out.height);
+
+        // rows are DWORD aligned, levels range 0 ~ 64
+        const int pitch = (out.width + 3) & ~3;
+        for (int y = 0; y < out.height; y++) {
+            for (int x = 0; x < out.width; x++) {
+                int level = std::min<int>(buffer[(size_t) y * pitch + x], 64);
+                out.coverage[(size_t) y * out.width + x] = (unsigned char) ((level * 255 + 32) / 64);
+            }
+        }
+        return true;
+    }
+
+}; // end of xGlyphRasterizer
+
+#endif // end of xGLYPHSOURCE_H
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
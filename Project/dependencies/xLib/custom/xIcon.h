@@ -181,10 +181,20 @@ private:
             /// DO NOT use LR_SHARED for images that have non-standard
             /// sizes, that may change after loading, or that are loaded
             /// from a file ~ as per MSDN
-            hIcon = (HICON) LoadImage(
-                0, mIconPath.c_str(), IMAGE_ICON, 0, 0,
-                LR_DEFAULTSIZE | LR_LOADFROMFILE // LR_SHARED
-            );
+            if (xPack::isPackPath(getIconPath())) {
+                // create the icon straight from the memory-mapped asset archive,
+                // using the same default size `LR_DEFAULTSIZE` would pick ...
+                hIcon = xPack::get().loadIcon(
+                    getIconPath(),
+                    GetSystemMetrics(ICON_SIZE == ICON_BIG ? SM_CXICON : SM_CXSMICON),
+                    GetSystemMetrics(ICON_SIZE == ICON_BIG ? SM_CYICON : SM_CYSMICON)
+                );
+            } else {
+                hIcon = (HICON) LoadImage(
+                    0, mIconPath.c_str(), IMAGE_ICON, 0, 0,
+                    LR_DEFAULTSIZE | LR_LOADFROMFILE // LR_SHARED
+                );
+            }
 
             // check that the handle was "loaded" correctly ...
             if (!hIcon) {
@@ -228,16 +238,23 @@ private:
         path = StrConverter::StringToWString(mIconPath);
         #endif
 
-        // create bitmap image from .png file
-        Gdiplus::Bitmap bmp(path.c_str());
+        // create bitmap image from .png file (or from the asset archive) ...
+        Gdiplus::Bitmap* pBmp = xPack::isPackPath(getIconPath())
+            ? xPack::get().loadBitmap(getIconPath())
+            : new Gdiplus::Bitmap(path.c_str());
 
         // handle to bitmap object
-        HBITMAP hBmp;
-        // get the bitmap handle from the bmp instance & store it in hBmp ...
-        bmp.GetHBITMAP(0, &hBmp);
-        
-        // extract the bitmap as .ico image from the hBmp handle
-        bmp.GetHICON(&hIcon); // hIcon class member
+        HBITMAP hBmp = NULL;
+
+        if (pBmp) {
+            // get the bitmap handle from the bmp instance & store it in hBmp ...
+            pBmp->GetHBITMAP(0, &hBmp);
+            
+            // extract the bitmap as .ico image from the hBmp handle
+            pBmp->GetHICON(&hIcon); // hIcon class member
+
+            delete pBmp;
+        }
 
         try {
             
@@ -278,6 +295,7 @@ private:
  * 
  * then provide a relative/full path to
  * a .ico or .png file for small & large icons
+ * (or a "pack:" path to an asset in the `make pack` archive)
  * 
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
  * parentFrame.setSmallIcon("./src/win95.ico"); // replace with file path
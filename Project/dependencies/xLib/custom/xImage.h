@@ -17,6 +17,8 @@
 #include <thread> // for executing animation on separate thread
 #include <atomic> // to access variables safely accross active threads
 #include <condition_variable> // for mutex/mutual exclusive thread locking
+#include <mutex> // for guarding data shared with the animation thread
+#include <cstring> // for std::memcpy
 
 using namespace std::chrono;
 
@@ -28,8 +30,11 @@ using namespace std::chrono;
  * @todo             Refactor `xImage`, `xButtonImage`, `xMenuItem`
  *                   to all make reliable use of the common mechanisms
  *                   in this `xImage` implementation!
+ * @note             The decoded image is accounted for by `xImageBudget` & may be
+ *                   evicted while not visible, in which case it is re-decoded
+ *                   from its path the next time it is drawn/measured
  */
-class xImage {
+class xImage : public xImageBudget::iSurface {
 
 /// @todo define friend ostream operator << for printing image data ...
 /// @todo refactor this class so that menu items can use it ...
@@ -70,6 +75,57 @@ protected:
     /// @brief  variable to keep track of the image's file extension ...
     std::string imageExt;
 
+    /// @brief handle of the window the image was last drawn to,
+    ///        used to decide whether the image is visible (see `isVisible()`)
+    HWND hWndLast = NULL;
+
+    /// @brief flag indicating the last decode failed,
+    ///        so that a broken path is not re-decoded on every paint
+    bool loadFailed = false;
+
+    /// @brief the image scaled (by `Resampler`) to the size it was last drawn at,
+    ///        so that painting at an unchanged size does not scale again
+    Gdiplus::Bitmap* scaled = nullptr;
+
+    /// @brief rectangle (in image pixels) of `img` changed since `scaled` was made
+    ///        (i.e. by new .gif frames), re-scaled in place on the next paint
+    GifFrames::Rect scaledDirty;
+
+    /// @brief client rectangle the image was last drawn into (see `drawImage(...)`)
+    RECT rcDrawn = { 0, 0, 0, 0 };
+
+    /// @brief mutex guarding `rcDrawn` & `scaledDirty` ~ shared with the .gif animation thread
+    std::mutex drawnMutex;
+
+    /// @brief  method to retrieve the client rectangle the image was last drawn into
+    /// @return copy of the rectangle (empty if never drawn)
+    RECT drawnRect() {
+        std::lock_guard<std::mutex> lock(drawnMutex);
+        return rcDrawn;
+    }
+
+    /// @brief  method to map image pixels to the pixels of the image scaled to
+    ///         `width` x `height` that read them (see `Resampler::reach(...)`)
+    /// @param  changed ~ rectangle in image pixels
+    /// @param  width ~ width (in pixels) of the scaled image
+    /// @param  height ~ height (in pixels) of the scaled image
+    /// @return rectangle in scaled pixels (empty if none)
+    RECT scaledRegion(const GifFrames::Rect& changed, int width, int height) {
+        RECT rc = { 0, 0, 0, 0 };
+        int iw = img ? static_cast<int>(img->GetWidth()) : 0;
+        int ih = img ? static_cast<int>(img->GetHeight()) : 0;
+        if (changed.empty() || iw <= 0 || ih <= 0 || width <= 0 || height <= 0) {
+            return rc;
+        }
+        int left, right, top, bottom;
+        Resampler::reach(iw, width, Resampler::BICUBIC, changed.left, changed.right, left, right);
+        Resampler::reach(ih, height, Resampler::BICUBIC, changed.top, changed.bottom, top, bottom);
+        if (left < right && top < bottom) {
+            SetRect(&rc, left, top, right, bottom);
+        }
+        return rc;
+    }
+
 protected:
 
     /// @brief private deleted parameterless/default constructor
@@ -121,7 +177,7 @@ protected:
     }
 
     /// @brief  method to load an image from a file into the `Gdiplus::Image` object
-    /// @param  path ~ file path of the image to load
+    /// @param  path ~ file path of the image to load, or a "pack:" path (see `xPack`)
     /// @return boolean flag representative of whether or not the image was loaded success
     /// @note
     /// if the image failed to load, then it is immediately deleted but the path
@@ -140,14 +196,19 @@ protected:
 
         try {
             
-            #if defined(UNICODE) && defined(_UNICODE)
-            img = new Gdiplus::Image(mImagePath.c_str());
-            #else
-            img = new Gdiplus::Image(StrConverter::StringToWString(mImagePath).c_str());
-            #endif
+            if (xPack::isPackPath(path)) {
+                // load from the memory-mapped asset archive (no file I/O) ...
+                img = xPack::get().loadImage(path);
+            } else {
+                #if defined(UNICODE) && defined(_UNICODE)
+                img = new Gdiplus::Image(mImagePath.c_str());
+                #else
+                img = new Gdiplus::Image(StrConverter::StringToWString(mImagePath).c_str());
+                #endif
+            }
 
             // ensure that the image was loaded successfully ...
-            if (img->GetLastStatus() != Gdiplus::Ok) {
+            if (!img || img->GetLastStatus() != Gdiplus::Ok) {
                 // otherwize, throw exception, including indication of the file path ...
                 throw xImageException("failed to load image: " + getImagePath());
             }
@@ -168,10 +229,70 @@ protected:
             pPrevImg = nullptr;
         }
 
+        // the scaled copy belongs to the previous image ...
+        delete scaled;
+        scaled = nullptr;
+
+        // account for the decoded surface (32 bits per pixel) ...
+        loadFailed = (img == nullptr);
+        if (img) {
+            xImageBudget::get().track(this, decodedBytes());
+        } else {
+            xImageBudget::get().release(this);
+        }
+
         /// return `true` if `img` is not `nullptr`, otherwize return `false`
         return (img ? true : false);
     }
 
+    /// @brief  method to (re-)decode the image from its stored path
+    /// @return boolean flag representative of whether the image was decoded
+    /// @note   overridden by `xGif` to refresh the frame data after decoding
+    virtual bool decode() {
+        return LoadImage(getImagePath());
+    }
+
+    /// @brief  method to retrieve the number of bytes held by the decoded & scaled images
+    /// @return size (in bytes) assuming 32 bits per pixel
+    size_t decodedBytes() {
+        size_t bytes = 0;
+        if (img) {
+            bytes += static_cast<size_t>(img->GetWidth()) * img->GetHeight() * 4;
+        }
+        if (scaled) {
+            bytes += static_cast<size_t>(scaled->GetWidth()) * scaled->GetHeight() * 4;
+        }
+        return bytes;
+    }
+
+    /// @brief  method to ensure the image is decoded, i.e. after being evicted
+    /// @return boolean flag representative of whether the image is available
+    bool ensureLoaded() {
+        if (img) {
+            return true;
+        }
+        if (loadFailed || mImagePath.empty()) {
+            return false;
+        }
+        return decode();
+    }
+
+public:
+
+    /// @brief  `xImageBudget::iSurface` override ~ whether the image is on screen
+    /// @return `true` if the window the image was last drawn to is visible
+    virtual bool isVisible() override {
+        return hWndLast && IsWindowVisible(hWndLast);
+    }
+
+    /// @brief `xImageBudget::iSurface` override ~ frees the decoded image, keeping its path
+    virtual void evict() override {
+        delete scaled;
+        scaled = nullptr;
+        delete img;
+        img = nullptr;
+    }
+
 public:
 
     /// @brief  method to retrieve the string path of the image
@@ -225,7 +346,7 @@ protected:
     /// @brief   method to retrieve the pointer of the `Gdiplus::Image` object
     /// @details fuck-around-&-find-out!
     Gdiplus::Image* getImage() {
-        if (img) {
+        if (ensureLoaded()) {
             return img; // if not nullptr
         }
         return nullptr; // if not set
@@ -237,7 +358,7 @@ protected:
     /// if the image failed to load, then it is automatically deleted
     /// & the return result is -1 indicating that the image was not loaded
     int width() {
-        if (img) {
+        if (ensureLoaded()) {
             return img->GetWidth(); // if not `nullptr`
         }
         return -1; // if not set => indicates no `Gdiplus::Image` object set
@@ -249,7 +370,7 @@ protected:
     /// if the image failed to load, then it is automatically deleted
     /// & the return result is -1 indicating that the image was not loaded
     int height() {
-        if (img) {
+        if (ensureLoaded()) {
             return img->GetHeight(); // if not `nullptr`
         }
         return -1; // if not set => indicates no `Gdiplus::Imag`e object set
@@ -259,6 +380,9 @@ protected:
     /// @details ensures proper cleanup after use by other `xWidget` controls
     ~xImage() {
         LOG("releasing xImage resources ...");
+        xImageBudget::get().release(this);
+        delete scaled;
+        scaled = nullptr;
         if (img) {
             /// free the Gdiplus::Image resources ...
             delete img;
@@ -327,10 +451,27 @@ protected:
     /// @brief     constructor
     /// @param[in] path ~ file path of the .gif image to load
     xGif(const std::string& path) : xImage(path) {
-        LoadImage(path);
+        // the image is already decoded by `xImage(path)` ...
         initGifInfo();
     }
 
+    /// @brief  `xImage` override ~ refreshes the frame data after (re-)decoding
+    /// @return boolean flag representative of whether the image was decoded
+    virtual bool decode() override {
+        bool loaded = xImage::decode();
+        currentFrame = 0;
+        frameDelays.clear();
+        initGifInfo();
+        return loaded;
+    }
+
+public:
+
+    /// @brief  `xImageBudget::iSurface` override ~ a running animation is always visible
+    virtual bool isVisible() override {
+        return inAnimation || xImage::isVisible();
+    }
+
 protected:
 
     /// @brief variable storing the .gif image frame count data
@@ -356,6 +497,33 @@ protected:
     /// @brief variable to stored the .gif image `GUID` data
     GUID dimensionGuid;
 
+    /// @brief changed (dirty) rectangle of every frame, in image pixels,
+    ///        relative to the frame shown before it (empty if identical)
+    /// @note  empty vector if the frame layout is unknown => full repaints
+    std::vector<GifFrames::Rect> frameDirty;
+
+    /// @brief flag of every frame whose `frameDirty` rectangle was tightened
+    ///        to the pixels that differ (see `tightenFrame(...)`)
+    std::vector<bool> frameDiffed;
+
+    /// @brief number of frames whose rectangle is not tightened yet
+    UINT framesLeft = 0;
+
+    /// @brief pixels of the frame shown last, kept while rectangles are left to tighten
+    std::vector<std::uint32_t> framePixels;
+
+    /// @brief index of the frame held by `framePixels`
+    UINT framePixelsOf = 0;
+
+    /// @brief number of client pixels invalidated by the animation
+    std::atomic<unsigned long long> pixelsPainted{ 0 };
+
+    /// @brief number of client pixels a full repaint of every frame would have invalidated
+    std::atomic<unsigned long long> pixelsFull{ 0 };
+
+    /// @brief time (in milliseconds) spent animating
+    std::atomic<unsigned long long> animationMs{ 0 };
+
     /// @brief method to initialize the .gif image data ...
     void initGifInfo() {
         inAnimation = false;        
@@ -380,6 +548,155 @@ protected:
             }
             free(propItem);
         }
+        // the frame layout does not change when re-decoded (after eviction) ...
+        if (frameDirty.size() != frameCount) {
+            initFrameDirty();
+        }
+    }
+
+    /// @brief   method to read the changed rectangle of every frame from the .gif layout
+    /// @details The rectangle of each frame's image descriptor (& disposal of the
+    ///          previous frame) bounds what may change ~ no frame is rendered here,
+    ///          each rectangle is tightened once its frame is shown (see `tightenFrame(...)`)
+    /// @note    on failure, `frameDirty` is left empty & frames are fully repainted
+    void initFrameDirty() {
+
+        frameDirty.clear();
+        frameDiffed.clear();
+        framesLeft = 0;
+        framePixels.clear();
+
+        // read the frame layout straight from the (mapped) .gif stream ...
+        unsigned cw = 0;
+        unsigned ch = 0;
+        std::vector<GifFrames::Frame> frames;
+        std::string path = getImagePath();
+        if (xPack::isPackPath(path)) {
+            AssetPack::Asset asset;
+            if (xPack::get().find(path, asset)) {
+                GifFrames::parse(asset.data, asset.size, cw, ch, frames);
+            }
+        } else {
+            MappedFile file;
+            if (file.open(path)) {
+                GifFrames::parse(file.data(), file.size(), cw, ch, frames);
+            }
+        }
+
+        if (
+               frames.size() != frameCount
+            || cw != img->GetWidth()
+            || ch != img->GetHeight()
+        ) {
+            return;
+        }
+
+        std::vector<GifFrames::Rect> dirty(frameCount);
+        for (UINT i = 0; i < frameCount; i++) {
+            dirty[i] = GifFrames::changed(frames, i, cw, ch);
+        }
+
+        frameDirty.swap(dirty);
+        frameDiffed.assign(frameCount, false);
+        framesLeft = frameCount;
+    }
+
+    /// @brief     method to tighten the changed rectangle of the frame just selected
+    /// @param[in] frame ~ index of the active frame
+    /// @details   Runs on the animation thread: while rectangles are left to tighten,
+    ///            the frame is rendered once & diffed against the frame shown before it
+    ///            (when that is its predecessor), so that every rectangle is tight after
+    ///            the first loop of the animation, & the pixels are then released
+    void tightenFrame(UINT frame) {
+
+        if (framesLeft == 0 || frame >= frameDirty.size() || frameDiffed.size() != frameDirty.size()) {
+            return;
+        }
+
+        UINT cw = img->GetWidth();
+        UINT ch = img->GetHeight();
+        Gdiplus::Bitmap canvas(cw, ch, PixelFormat32bppARGB);
+        if (canvas.GetLastStatus() != Gdiplus::Ok) {
+            return;
+        }
+        {
+            Gdiplus::Graphics graphics(&canvas);
+            graphics.SetCompositingMode(Gdiplus::CompositingModeSourceCopy);
+            graphics.DrawImage(img, 0, 0, cw, ch);
+        }
+
+        Gdiplus::Rect rect(0, 0, cw, ch);
+        Gdiplus::BitmapData data;
+        if (canvas.LockBits(&rect, Gdiplus::ImageLockModeRead, PixelFormat32bppARGB, &data) != Gdiplus::Ok) {
+            return;
+        }
+        std::vector<std::uint32_t> current(static_cast<size_t>(cw) * ch);
+        for (UINT y = 0; y < ch; y++) {
+            std::memcpy(
+                &current[static_cast<size_t>(y) * cw],
+                static_cast<BYTE*>(data.Scan0) + static_cast<ptrdiff_t>(y) * data.Stride,
+                static_cast<size_t>(cw) * 4
+            );
+        }
+        canvas.UnlockBits(&data);
+
+        // diff against the previous frame, if that is the one shown last ...
+        if (
+               !frameDiffed[frame]
+            && framePixels.size() == current.size()
+            && framePixelsOf == (frame + frameCount - 1) % frameCount
+        ) {
+            frameDirty[frame] = GifFrames::diff(framePixels.data(), current.data(), cw, frameDirty[frame]);
+            frameDiffed[frame] = true;
+            framesLeft--;
+        }
+
+        // ... & keep the frame for the next one, until every rectangle is tight
+        if (framesLeft > 0) {
+            framePixels.swap(current);
+            framePixelsOf = frame;
+        } else {
+            std::vector<std::uint32_t>().swap(framePixels);
+        }
+    }
+
+    /// @brief     helper method to invalidate the area changed by showing a frame
+    /// @param[in] hWnd ~ Handle of the window displaying the .gif image
+    /// @param[in] frame ~ index of the frame being shown
+    /// @details   The changed rectangle is mapped from image pixels to the client
+    ///            rectangle the image was last drawn into, i.e. the scaled pixels that
+    ///            read it (see `scaledRegion(...)`), & invalidated WITHOUT erasing the background
+    void invalidateFrame(HWND hWnd, UINT frame) {
+
+        RECT rcDraw = drawnRect();
+        int dw = rcDraw.right - rcDraw.left;
+        int dh = rcDraw.bottom - rcDraw.top;
+        int iw = static_cast<int>(img->GetWidth());
+        int ih = static_cast<int>(img->GetHeight());
+        unsigned long long full = (dw > 0 && dh > 0) ? static_cast<unsigned long long>(dw) * dh : 0;
+        pixelsFull += full;
+
+        // unknown layout or never drawn => repaint the whole control ...
+        if (frame >= frameDirty.size() || full == 0 || iw <= 0 || ih <= 0) {
+            RECT rcClient;
+            GetClientRect(hWnd, &rcClient);
+            pixelsPainted += static_cast<unsigned long long>(rcClient.right - rcClient.left) * (rcClient.bottom - rcClient.top);
+            InvalidateRect(hWnd, NULL, FALSE);
+            return;
+        }
+
+        const GifFrames::Rect& dirty = frameDirty[frame];
+        if (dirty.empty()) {
+            return; // identical to the previous frame, nothing to repaint
+        }
+
+        // a scaled pixel is blended from its neighbours (within the kernel support) ...
+        RECT rc = scaledRegion(dirty, dw, dh);
+        OffsetRect(&rc, rcDraw.left, rcDraw.top);
+        IntersectRect(&rc, &rc, &rcDraw);
+
+        pixelsPainted += static_cast<unsigned long long>(rc.right - rc.left) * (rc.bottom - rc.top);
+        InvalidateRect(hWnd, &rc, FALSE);
     }
 
     /// @brief     method to initialize the .gif image animation
@@ -416,6 +733,7 @@ protected:
             // auto currentTimeMs = std::chrono::duration_cast<std::chrono::milliseconds>(currentTime.time_since_epoch()).count();
             updateFrame(hWnd);
             std::this_thread::sleep_for(std::chrono::milliseconds(frameDelays[currentFrame] * 10));
+            animationMs += std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - currentTime).count();
             long long int elapsedTime = std::chrono::duration_cast<std::chrono::seconds>(currentTime - startTime).count();
             // check if duration elapsed ...
             if (elapsedTime >= duration) {
@@ -424,21 +742,65 @@ protected:
             }
         }
         inAnimation = false;
+        #ifndef NDEBUG
+        LogGifData();
+        #endif
     }
 
     /// @brief helper method to update the current frame of the .gif animation
     /// @param hWnd ~ Handle of the window for which to update the .gif frame
     void updateFrame(HWND hWnd) {
+        UINT shown = currentFrame;
         img->SelectActiveFrame(&dimensionGuid, currentFrame);
+        tightenFrame(shown);
         // currentFrame = (currentFrame + 1) % frameDelays.size(); // incorrect!
         currentFrame = (currentFrame + 1) % frameCount; // correct!
-        InvalidateRect(hWnd, NULL, TRUE);
+        // re-scale what the new frame changed on the next paint (all of it if unknown) ...
+        GifFrames::Rect changed;
+        if (shown < frameDirty.size()) {
+            changed = frameDirty[shown];
+        } else {
+            changed.right = static_cast<int>(img->GetWidth());
+            changed.bottom = static_cast<int>(img->GetHeight());
+        }
+        {
+            std::lock_guard<std::mutex> lock(drawnMutex);
+            scaledDirty = GifFrames::unite(scaledDirty, changed);
+        }
+        // repaint only what changed, without erasing the background ...
+        invalidateFrame(hWnd, shown);
     }
 
     /// @brief method to check whether a .gif is in animation or not
     bool isAnimating() {
         return inAnimation;
     }
+
+public:
+
+    /// @brief  method to retrieve the number of pixels repainted per second of animation
+    /// @return average over every animation run so far (0 if never animated)
+    double pixelsPerSecond() {
+        unsigned long long ms = animationMs;
+        return ms ? pixelsPainted * 1000.0 / ms : 0.0;
+    }
+
+    /// @brief  method to retrieve the number of pixels per second of animation
+    ///         that repainting every frame in full would have cost
+    double fullPixelsPerSecond() {
+        unsigned long long ms = animationMs;
+        return ms ? pixelsFull * 1000.0 / ms : 0.0;
+    }
+
+    #ifndef NDEBUG
+    /// @brief method to Log the .gif animation counters (DEBUG)
+    void LogGifData() {
+        LOG(("Gif frames: " + std::to_string(frameCount)).c_str());
+        LOG(("Gif animation (ms): " + std::to_string(animationMs)).c_str());
+        LOG(("Gif pixels painted per second: " + std::to_string(pixelsPerSecond())).c_str());
+        LOG(("Gif pixels per second (full repaint): " + std::to_string(fullPixelsPerSecond())).c_str());
+    }
+    #endif
 };
 
 #endif // end of xIMAGE_H
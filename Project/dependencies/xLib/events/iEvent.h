@@ -325,6 +325,95 @@ protected:
 // forward declaration ...
 class xTextBox;
 
+/**
+  * @class   TextDelta
+  * @brief   a single edit of a textbox's text
+  *
+  * @details `TextDelta` describes the edit as the range of replaced characters
+  *          & a view of the inserted characters, so that listeners are not handed
+  *          a copy of the whole text per keystroke. The whole text is materialized
+  *          only if `text()` is invoked (once per event) <br/>
+  *          Offsets & lengths count `TCHAR`s, i.e. UTF-16 code units in `UNICODE` builds
+  *
+  * @note    the inserted characters & the snapshot are only valid during the callback
+  */
+class TextDelta {
+
+public:
+
+  /// @brief snapshot type of the textbox text model
+  #if defined(UNICODE) && defined(_UNICODE)
+  using Snapshot = WPieceTable::Snapshot;
+  #else
+  using Snapshot = PieceTable::Snapshot;
+  #endif
+
+  /// @param[in] offset ~ offset of the first replaced character
+  /// @param[in] removed ~ number of characters removed
+  /// @param[in] inserted ~ the inserted characters
+  /// @param[in] snapshot ~ the text after the edit
+  /// @param[in] pCopied ~ counter of the characters materialized by `text()` (optional)
+  TextDelta(
+    size_t offset, size_t removed,
+    const std::basic_string<TCHAR>& inserted,
+    Snapshot snapshot,
+    size_t* pCopied = nullptr
+  ) : mOffset(offset), mRemoved(removed), mInserted(inserted), mSnapshot(std::move(snapshot)), pCopied(pCopied) {}
+
+  /// @brief method to retrieve the offset of the first replaced character
+  size_t offset() const { return mOffset; }
+
+  /// @brief method to retrieve the number of removed characters
+  size_t removed() const { return mRemoved; }
+
+  /// @brief method to retrieve the number of inserted characters
+  size_t insertedLength() const { return mInserted.size(); }
+
+  /// @brief method to retrieve a view of the inserted characters (not NUL-terminated)
+  const TCHAR* inserted() const { return mInserted.data(); }
+
+  /// @brief method to retrieve a copy of the inserted characters
+  std::string insertedText() const {
+    #if defined(UNICODE) && defined(_UNICODE)
+    return StrConverter::WStringToString(mInserted);
+    #else
+    return mInserted;
+    #endif
+  }
+
+  /// @brief method to retrieve the length of the whole text (after the edit)
+  size_t length() const { return mSnapshot.size(); }
+
+  /// @brief   method to retrieve the whole text (after the edit)
+  /// @details materialized on the first call only
+  const std::string& text() const {
+    if (!materialized) {
+      #if defined(UNICODE) && defined(_UNICODE)
+      mText = StrConverter::WStringToString(mSnapshot.str());
+      #else
+      mText = mSnapshot.str();
+      #endif
+      materialized = true;
+      if (pCopied) {
+        *pCopied += mSnapshot.size();
+      }
+    }
+    return mText;
+  }
+
+private:
+
+  size_t mOffset;
+  size_t mRemoved;
+  const std::basic_string<TCHAR>& mInserted;
+  Snapshot mSnapshot;
+  size_t* pCopied;
+
+  /// @brief the whole text, once materialized
+  mutable std::string mText;
+  mutable bool materialized = false;
+};
+
 /**
   * @class   iTextChangeEventListener
   * @brief 	 Text-change-event listener intreface class
@@ -344,16 +433,28 @@ protected:
   /// @param[in] text ~ copy of the textbox's current held internal string value
   using event_onTextChange = std::function<void(xTextBox* pTextbox, std::string text)>;
 
+  /// @remark    alias for void(*)(...) function pointer signature
+  /// @param[in] pTextBox ~ pointer of the textbox that triggers the text change action
+  /// @param[in] delta ~ the edit, without copying the text (see `TextDelta`)
+  using event_onTextDelta = std::function<void(xTextBox* pTextbox, const TextDelta& delta)>;
+
 protected:
 
   /// @remark function pointer to client-defined callback method/event triggers
   event_onTextChange mOnTextChange = nullptr;
 
+  /// @remark function pointer to client-defined callback method/event triggers
+  event_onTextDelta mOnTextDelta = nullptr;
+
 protected:
 
   /// @brief pure virtual abstract interface class method
   /// to attach a change event (applicable to textbox)
   virtual void setOnTextChange(event_onTextChange callback) = 0;
+
+  /// @brief pure virtual abstract interface class method
+  /// to attach a delta change event (applicable to textbox)
+  virtual void setOnTextDelta(event_onTextDelta callback) = 0;
 };
 
 // #include "../peripherals/Key.h" // included in xApp.h
@@ -576,6 +576,15 @@ void xImage::drawImage(xWidget* pWidget) {
     // std::cout << "pButton width: " << pButton->getWidth() << std::endl;
     // std::cout << "pButton height: " << pButton->getHeight() << std::endl;
 
+    // re-decode the image if it was evicted by `xImageBudget` ...
+    if (!ensureLoaded()) {
+        return;
+    }
+
+    // remember where the image is drawn (for visibility) & mark it as recently used ...
+    hWndLast = pWidget->Handle();
+    xImageBudget::get().touch(this);
+
     Gdiplus::Graphics graphics(pWidget->getDrawContext());
 
     // account for the borders width & inset, etc ...
@@ -692,8 +701,43 @@ void xImage::drawImage(xWidget* pWidget) {
     // create the Gdiplus rectangle (clipped)
     Gdiplus::Rect gdiRect(left, top, width, height);
 
-    // draw the image in the clipped rectangle
-    graphics.DrawImage(this->img, gdiRect);
+    // remember where the image lands, for partial (.gif frame) repaints,
+    // & take what new .gif frames changed since the last paint ...
+    GifFrames::Rect changed;
+    {
+        std::lock_guard<std::mutex> lock(drawnMutex);
+        rcDrawn = { left, top, right, bottom };
+        changed = scaledDirty;
+        scaledDirty = GifFrames::Rect();
+    }
+
+    // scale with `Resampler` only when the size changes (& re-scale only the region
+    // a .gif frame changed), rather than letting Gdiplus interpolate on every paint ...
+    if (
+           !scaled
+        || static_cast<int>(scaled->GetWidth()) != width
+        || static_cast<int>(scaled->GetHeight()) != height
+    ) {
+        delete scaled;
+        scaled = xGDI::resample(this->img, width, height);
+        xImageBudget::get().track(this, decodedBytes());
+    } else if (!changed.empty()) {
+        RECT region = scaledRegion(changed, width, height);
+        if (!IsRectEmpty(&region) && !xGDI::resample(this->img, scaled, region)) {
+            // could not re-scale in place => scale the whole image again
+            delete scaled;
+            scaled = xGDI::resample(this->img, width, height);
+            xImageBudget::get().track(this, decodedBytes());
+        }
+    }
+
+    // draw the image in the clipped rectangle (1:1 if already scaled)
+    if (scaled) {
+        graphics.SetInterpolationMode(Gdiplus::InterpolationModeNearestNeighbor);
+        graphics.DrawImage(scaled, gdiRect);
+    } else {
+        graphics.DrawImage(this->img, gdiRect);
+    }
 
     // reset the clip region
     graphics.ResetClip();
@@ -0,0 +1,260 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		xFontCache.h
+  * @author 	&lambda;ambda
+  * @date       \showdate "%Y-%m-%d"
+  *
+  * @brief 		for sharing font handles between `xFont`s with identical attributes
+  *
+  * @details 	`xFontCache` interns Win32 font handles by their full `LOGFONT`,
+  *             so that any number of widgets using the same font share a single
+  *             `HFONT`. Handles are reference-counted & deleted once the last
+  *             `xFont` using them releases them. A cached handle is never modified:
+  *             changing an attribute of an `xFont` acquires another handle <br/>
+  *             Every handle also carries (lazily) the `TextMetrics` measuring its text
+  *             & the `GlyphAtlas` rendering it
+  */
+
+/// @brief begin of xFONTCACHE_H implementation
+#ifndef xFONTCACHE_H
+#define xFONTCACHE_H
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+/**
+ * @class    xFontCache
+ * @brief    singleton cache of reference-counted font handles
+ * @details `xFontCache` implements the singleton design pattern <br/>
+ *           `acquire(...)` returns the shared handle for a `LOGFONT` (creating it
+ *           on a miss), & every `acquire(...)` is balanced by a `release(...)`
+ */
+class xFontCache {
+
+public:
+
+    /// @brief  static method that retrieves the `xFontCache` singleton instance pointer
+    /// @return reference to `xFontCache` singleton instance pointer
+    static xFontCache& get() {
+        if (instance == nullptr) {
+            instance = new xFontCache();
+        }
+        return *instance;
+    }
+
+    /// @brief delete copy constructor
+    xFontCache(const xFontCache&) = delete;
+    /// @brief delete copy assignment operator
+    xFontCache& operator=(const xFontCache&) = delete;
+
+    /// @brief method for destructing `xFontCache` singleton instance
+    static void destruct() {
+        delete instance;
+        instance = nullptr;
+    }
+
+private:
+
+    /// @brief private default constructor
+    xFontCache() = default;
+
+    /// @brief   destructor
+    /// @details deletes the handles still held, i.e. fonts leaked by client-code
+    ~xFontCache() {
+        LOG("destroy xFontCache resources ...");
+        // the metrics & atlases select their font into a DC => destroyed first
+        foreign.clear();
+        for (auto& it : fonts) {
+            it.second.pMetrics.reset();
+            it.second.pAtlas.reset();
+            DeleteObject(it.second.hFont);
+        }
+    }
+
+    /// @brief `xFontCache` singleton instance pointer
+    static xFontCache* instance;
+
+private:
+
+    /// @brief a cached font handle
+    struct Entry {
+        HFONT hFont;  ///< shared (immutable) font handle
+        size_t refs;  ///< number of `xFont`s using the handle
+        std::unique_ptr<TextMetrics> pMetrics;  ///< text metrics of the handle, `nullptr` until measured
+        std::unique_ptr<GlyphAtlas> pAtlas;     ///< glyph atlas of the handle, `nullptr` until drawn
+    };
+
+    /// @brief cached handles by (normalized) `LOGFONT` bytes
+    std::unordered_map<std::string, Entry> fonts;
+
+    /// @brief key of every cached handle, for `release(...)`
+    std::unordered_map<HFONT, std::string> keys;
+
+    /// @brief metrics & atlases of fonts not owned by the cache (i.e. stock fonts)
+    std::unordered_map<HFONT, Entry> foreign;
+
+    /// @brief number of `acquire(...)` calls served by an existing handle
+    size_t hitCount = 0;
+    /// @brief number of `acquire(...)` calls that created a handle
+    size_t missCount = 0;
+
+    /// @brief vertical resolution of the screen (dots per inch), `0` until queried
+    int dpiY = 0;
+
+    /// @brief   helper method to build the key of a `LOGFONT`
+    /// @details the bytes following the face name terminator are undefined,
+    ///          so the face name is copied up to its terminator only
+    static std::string keyOf(const LOGFONT& lf) {
+        LOGFONT normalized;
+        memset(&normalized, 0, sizeof(LOGFONT));
+        normalized.lfHeight         = lf.lfHeight;
+        normalized.lfWidth          = lf.lfWidth;
+        normalized.lfEscapement     = lf.lfEscapement;
+        normalized.lfOrientation    = lf.lfOrientation;
+        normalized.lfWeight         = lf.lfWeight;
+        normalized.lfItalic         = lf.lfItalic;
+        normalized.lfUnderline      = lf.lfUnderline;
+        normalized.lfStrikeOut      = lf.lfStrikeOut;
+        normalized.lfCharSet        = lf.lfCharSet;
+        normalized.lfOutPrecision   = lf.lfOutPrecision;
+        normalized.lfClipPrecision  = lf.lfClipPrecision;
+        normalized.lfQuality        = lf.lfQuality;
+        normalized.lfPitchAndFamily = lf.lfPitchAndFamily;
+        for (int i = 0; i < LF_FACESIZE - 1 && lf.lfFaceName[i]; i++) {
+            normalized.lfFaceName[i] = lf.lfFaceName[i];
+        }
+        return std::string(reinterpret_cast<const char*>(&normalized), sizeof(LOGFONT));
+    }
+
+public:
+
+    /// @brief     method to retrieve the shared font handle of a `LOGFONT`
+    /// @param[in] lf ~ attributes of the font
+    /// @return    font handle (`NULL` if `CreateFontIndirect(...)` failed)
+    /// @remark    MUST be balanced by `release(...)`, never `DeleteObject(...)`
+    HFONT acquire(const LOGFONT& lf) {
+
+        std::string key = keyOf(lf);
+
+        auto it = fonts.find(key);
+        if (it != fonts.end()) {
+            hitCount++;
+            it->second.refs++;
+            return it->second.hFont;
+        }
+
+        missCount++;
+        HFONT hFont = CreateFontIndirect(&lf);
+        if (!hFont) {
+            return NULL;
+        }
+
+        fonts.emplace(key, Entry{ hFont, 1, nullptr, nullptr });
+        keys.emplace(hFont, key);
+        return hFont;
+    }
+
+    /// @brief     method to release a font handle obtained from `acquire(...)`
+    /// @param[in] hFont ~ the font handle, deleted when no longer used
+    void release(HFONT hFont) {
+
+        auto key = keys.find(hFont);
+        if (key == keys.end()) {
+            return;
+        }
+
+        auto it = fonts.find(key->second);
+        if (--it->second.refs == 0) {
+            // the metrics & atlas select the font into a DC => erased before deleting it
+            fonts.erase(it);
+            keys.erase(key);
+            DeleteObject(hFont);
+        }
+    }
+
+    /// @brief     method to check whether a font handle is owned by the cache
+    /// @param[in] hFont ~ the font handle
+    bool contains(HFONT hFont) { return keys.count(hFont) != 0; }
+
+private:
+
+    /// @brief     helper method to retrieve the entry of a cached or foreign font handle
+    /// @param[in] hFont ~ the font handle
+    Entry& entryOf(HFONT hFont) {
+        auto key = keys.find(hFont);
+        if (key != keys.end()) {
+            return fonts.find(key->second)->second;
+        }
+        Entry& entry = foreign[hFont];
+        entry.hFont = hFont;
+        return entry;
+    }
+
+public:
+
+    /// @brief     method to retrieve the text metrics of a font handle
+    /// @details   the advance, kerning & line tables are built from GDI the first time
+    ///            they are needed, then shared by every widget using the same font
+    /// @param[in] hFont ~ the font handle, either cached or a stock font
+    /// @return    the metrics, valid until the handle is released (cached handles)
+    ///            or the cache is destructed (other handles)
+    /// @remark    handles not owned by the cache MUST outlive it, i.e. stock fonts
+    TextMetrics& metrics(HFONT hFont) {
+        Entry& entry = entryOf(hFont);
+        if (!entry.pMetrics) {
+            entry.pMetrics.reset(new TextMetrics(std::unique_ptr<GlyphSource>(new xGlyphSource(hFont))));
+        }
+        return *entry.pMetrics;
+    }
+
+    /// @brief     method to retrieve the glyph atlas of a font handle
+    /// @details   glyphs are rasterized the first time they are drawn, then shared
+    ///            by every widget using the same font
+    /// @param[in] hFont ~ the font handle, either cached or a stock font
+    /// @return    the atlas, valid as long as `metrics(...)`
+    GlyphAtlas& atlas(HFONT hFont) {
+        Entry& entry = entryOf(hFont);
+        if (!entry.pAtlas) {
+            entry.pAtlas.reset(new GlyphAtlas(std::unique_ptr<GlyphRasterizer>(new xGlyphRasterizer(hFont))));
+        }
+        return *entry.pAtlas;
+    }
+
+    /// @brief  method to retrieve the vertical resolution of the screen
+    /// @return dots per inch, queried once (rather than per font size change)
+    int logPixelsY() {
+        if (dpiY == 0) {
+            HDC hDC = GetDC(NULL);
+            dpiY = GetDeviceCaps(hDC, LOGPIXELSY);
+            ReleaseDC(NULL, hDC);
+        }
+        return dpiY;
+    }
+
+    /// @brief method to retrieve the number of live (cached) font handles
+    size_t live() { return fonts.size(); }
+
+    /// @brief method to retrieve the number of `acquire(...)` calls served by an existing handle
+    size_t hits() { return hitCount; }
+
+    /// @brief method to retrieve the number of `acquire(...)` calls that created a handle
+    size_t misses() { return missCount; }
+
+    #ifndef NDEBUG
+    /// @brief method to Log `xFontCache` counters (DEBUG)
+    void LogFontCacheData() {
+        LOG(("Font handles (live): " + std::to_string(live())).c_str());
+        LOG(("Font cache hits: " + std::to_string(hits())).c_str());
+        LOG(("Font cache misses: " + std::to_string(misses())).c_str());
+    }
+    #endif
+};
+
+/// @brief initialize `xFontCache` singleton instance pointer
+xFontCache* xFontCache::instance = nullptr;
+
+#endif // end of xFONTCACHE_H
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
@@ -112,6 +112,174 @@ private:
     /// @brief `xGDI` singleton instance pointer
     /// initialized by `xGDI::get()` for program use
     static xGDI* instance;
+
+public:
+
+    /// @brief     static method to scale an image (its active frame) with `Resampler`
+    /// @param[in] pImage ~ pointer of the image to scale
+    /// @param[in] w ~ width (in pixels) of the scaled image
+    /// @param[in] h ~ height (in pixels) of the scaled image
+    /// @param[in] filter ~ reconstruction filter (default bicubic)
+    /// @return    pointer to a new premultiplied (`PixelFormat32bppPARGB`) `Gdiplus::Bitmap`
+    ///            or `nullptr` if the image could not be scaled
+    /// @remark    client code to free the returned bitmap
+    /// @details   The image is first rendered 1:1 into premultiplied pixels, which are
+    ///            then scaled by the (SIMD, multi-threaded) `Resampler` rather than by
+    ///            the Gdiplus interpolation modes
+    static Gdiplus::Bitmap* resample(
+        Gdiplus::Image* pImage,
+        int w, int h,
+        Resampler::Filter filter = Resampler::BICUBIC
+    ) {
+
+        if (!pImage || w <= 0 || h <= 0) {
+            return nullptr;
+        }
+
+        int sw = static_cast<int>(pImage->GetWidth());
+        int sh = static_cast<int>(pImage->GetHeight());
+        if (sw <= 0 || sh <= 0) {
+            return nullptr;
+        }
+
+        // decode the (active frame of the) source into premultiplied pixels ...
+        Gdiplus::Bitmap source(sw, sh, PixelFormat32bppPARGB);
+        if (source.GetLastStatus() != Gdiplus::Ok) {
+            return nullptr;
+        }
+        {
+            Gdiplus::Graphics graphics(&source);
+            graphics.SetCompositingMode(Gdiplus::CompositingModeSourceCopy);
+            graphics.DrawImage(pImage, 0, 0, sw, sh);
+        }
+
+        Gdiplus::Bitmap* pScaled = new Gdiplus::Bitmap(w, h, PixelFormat32bppPARGB);
+        if (pScaled->GetLastStatus() != Gdiplus::Ok) {
+            delete pScaled;
+            return nullptr;
+        }
+
+        Gdiplus::Rect srcRect(0, 0, sw, sh);
+        Gdiplus::Rect dstRect(0, 0, w, h);
+        Gdiplus::BitmapData srcData;
+        Gdiplus::BitmapData dstData;
+        bool scaled = false;
+
+        if (source.LockBits(&srcRect, Gdiplus::ImageLockModeRead, PixelFormat32bppPARGB, &srcData) == Gdiplus::Ok) {
+            if (pScaled->LockBits(&dstRect, Gdiplus::ImageLockModeWrite, PixelFormat32bppPARGB, &dstData) == Gdiplus::Ok) {
+                Resampler::Surface src = { static_cast<unsigned char*>(srcData.Scan0), sw, sh, srcData.Stride };
+                Resampler::Surface dst = { static_cast<unsigned char*>(dstData.Scan0), w, h, dstData.Stride };
+                scaled = Resampler::resize(src, dst, filter);
+                pScaled->UnlockBits(&dstData);
+            }
+            source.UnlockBits(&srcData);
+        }
+
+        if (!scaled) {
+            delete pScaled;
+            return nullptr;
+        }
+
+        return pScaled;
+    }
+
+    /// @brief     static method to re-scale a region of an image scaled before (see above)
+    /// @param[in] pImage ~ pointer of the image to scale (its active frame)
+    /// @param[in] pScaled ~ pointer of the premultiplied bitmap holding the scaled image
+    /// @param[in] region ~ rectangle (in `pScaled` pixels) to re-scale
+    /// @param[in] filter ~ reconstruction filter (default bicubic)
+    /// @return    `true` if the region was re-scaled, otherwize `false` (`pScaled` unchanged)
+    /// @details   Only the region is locked & written, with the same pixels `resample(...)`
+    ///            would write there, i.e. the region read from a changed .gif frame
+    static bool resample(
+        Gdiplus::Image* pImage,
+        Gdiplus::Bitmap* pScaled,
+        const RECT& region,
+        Resampler::Filter filter = Resampler::BICUBIC
+    ) {
+
+        if (!pImage || !pScaled || region.right <= region.left || region.bottom <= region.top) {
+            return false;
+        }
+
+        int sw = static_cast<int>(pImage->GetWidth());
+        int sh = static_cast<int>(pImage->GetHeight());
+        int w = static_cast<int>(pScaled->GetWidth());
+        int h = static_cast<int>(pScaled->GetHeight());
+        if (sw <= 0 || sh <= 0 || region.left < 0 || region.top < 0 || region.right > w || region.bottom > h) {
+            return false;
+        }
+
+        Gdiplus::Bitmap source(sw, sh, PixelFormat32bppPARGB);
+        if (source.GetLastStatus() != Gdiplus::Ok) {
+            return false;
+        }
+        {
+            Gdiplus::Graphics graphics(&source);
+            graphics.SetCompositingMode(Gdiplus::CompositingModeSourceCopy);
+            graphics.DrawImage(pImage, 0, 0, sw, sh);
+        }
+
+        Gdiplus::Rect srcRect(0, 0, sw, sh);
+        Gdiplus::Rect dstRect(region.left, region.top, region.right - region.left, region.bottom - region.top);
+        Gdiplus::BitmapData srcData;
+        Gdiplus::BitmapData dstData;
+        bool scaled = false;
+
+        if (source.LockBits(&srcRect, Gdiplus::ImageLockModeRead, PixelFormat32bppPARGB, &srcData) == Gdiplus::Ok) {
+            if (pScaled->LockBits(&dstRect, Gdiplus::ImageLockModeWrite, PixelFormat32bppPARGB, &dstData) == Gdiplus::Ok) {
+                Resampler::Surface src = { static_cast<unsigned char*>(srcData.Scan0), sw, sh, srcData.Stride };
+                Resampler::Surface dst = { static_cast<unsigned char*>(dstData.Scan0), dstRect.Width, dstRect.Height, dstData.Stride };
+                scaled = Resampler::resizeRegion(src, w, h, dst, region.left, region.top, filter);
+                pScaled->UnlockBits(&dstData);
+            }
+            source.UnlockBits(&srcData);
+        }
+
+        return scaled;
+    }
+
+    /// @brief     static method to draw a line of text into a bitmap with a `GlyphAtlas`
+    /// @param[in] pTarget ~ pointer of the bitmap to draw into
+    /// @param[in] x ~ pen position of the first character
+    /// @param[in] baseline ~ row of the baseline
+    /// @param[in] text ~ the text (line breaks are ignored)
+    /// @param[in] atlas ~ the glyphs of the font
+    /// @param[in] pMetrics ~ advances & kerning to lay out with (optional)
+    /// @param[in] color ~ the text color
+    /// @return    pen position after the last character
+    /// @details   The software (off-screen) text path: glyphs are composited by the
+    ///            (SIMD) `GlyphAtlas` blending into the premultiplied pixels of the
+    ///            bitmap, rather than by `DrawText(...)` per call
+    static int drawText(
+        Gdiplus::Bitmap* pTarget,
+        int x, int baseline,
+        const std::wstring& text,
+        GlyphAtlas& atlas,
+        TextMetrics* pMetrics,
+        COLORREF color
+    ) {
+
+        if (!pTarget) {
+            return x;
+        }
+
+        int w = static_cast<int>(pTarget->GetWidth());
+        int h = static_cast<int>(pTarget->GetHeight());
+
+        Gdiplus::Rect rect(0, 0, w, h);
+        Gdiplus::BitmapData data;
+        if (pTarget->LockBits(&rect, Gdiplus::ImageLockModeRead | Gdiplus::ImageLockModeWrite, PixelFormat32bppPARGB, &data) != Gdiplus::Ok) {
+            return x;
+        }
+
+        Resampler::Surface dst = { static_cast<unsigned char*>(data.Scan0), w, h, data.Stride };
+        std::uint32_t argb = 0xFF000000u | (GetRValue(color) << 16) | (GetGValue(color) << 8) | GetBValue(color);
+        x = atlas.draw(dst, x, baseline, text, argb, pMetrics);
+
+        pTarget->UnlockBits(&data);
+        return x;
+    }
 };
 
 /// @brief initialize xGDI singleton instance pointer
@@ -0,0 +1,269 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		xImageBudget.h
+  * @author 	&lambda;ambda
+  * @date       \showdate "%Y-%m-%d"
+  *
+  * @brief 		for tracking & limiting the memory held by decoded images/bitmaps
+  *
+  * @details 	`xImageBudget` keeps account of the bytes held by every decoded
+  *             surface (`xImage`, `xGif`, `xMenuItem` bitmaps) & evicts surfaces
+  *             that are not visible, in least-recently-drawn order, whenever
+  *             the total exceeds the budget. Evicted surfaces are re-decoded
+  *             from their source (file or "pack:" path) the next time they are drawn
+  */
+
+/// @brief begin of xIMAGEBUDGET_H implementation
+#ifndef xIMAGEBUDGET_H
+#define xIMAGEBUDGET_H
+
+#pragma once
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class    xImageBudget
+ * @brief    singleton accounting for the memory held by decoded images
+ * @details `xImageBudget` implements the singleton design pattern <br/>
+ *           Surfaces register their (decoded) size with `track(...)` & refresh their
+ *           position in the LRU order with `touch(...)` each time they are drawn <br/>
+ *           Surfaces that cannot be re-decoded (i.e. menu item bitmaps) are `pin(...)`-ed,
+ *           which counts their bytes without ever evicting them
+ */
+class xImageBudget {
+
+public:
+
+    /**
+     * @class    iSurface
+     * @brief    interface implemented by evictable (re-decodable) surfaces
+     * @details  `evict()` MUST free the decoded data but keep whatever is
+     *           required to decode it again (i.e. the source path)
+     */
+    class iSurface {
+    public:
+        /// @brief  method to check whether the surface is currently on screen
+        /// @return `true` if the surface MUST NOT be evicted
+        virtual bool isVisible() = 0;
+        /// @brief method to free the decoded data of the surface
+        virtual void evict() = 0;
+        /// @brief virtual destructor
+        virtual ~iSurface() = default;
+    };
+
+public:
+
+    /// @brief  static method that retrieves the `xImageBudget` singleton instance pointer
+    /// @return reference to `xImageBudget` singleton instance pointer
+    static xImageBudget& get() {
+        if (instance == nullptr) {
+            instance = new xImageBudget();
+        }
+        return *instance;
+    }
+
+    /// @brief delete copy constructor
+    xImageBudget(const xImageBudget&) = delete;
+    /// @brief delete copy assignment operator
+    xImageBudget& operator=(const xImageBudget&) = delete;
+
+    /// @brief method for destructing `xImageBudget` singleton instance
+    static void destruct() {
+        delete instance;
+        instance = nullptr;
+    }
+
+private:
+
+    /// @brief private default constructor
+    xImageBudget() = default;
+    /// @brief private default destructor
+    ~xImageBudget() = default;
+
+    /// @brief `xImageBudget` singleton instance pointer
+    static xImageBudget* instance;
+
+private:
+
+    /// @brief accounting data of a single surface
+    struct Node {
+        const void* key;     ///< owner of the bytes
+        iSurface* pSurface;  ///< `nullptr` if pinned (never evicted)
+        size_t bytes;        ///< decoded size (in bytes)
+    };
+
+    /// @brief surfaces in least-recently-drawn order (front = most recent)
+    std::list<Node> lru;
+
+    /// @brief index of `lru` by owner, for `O(1)` touch/release
+    std::unordered_map<const void*, std::list<Node>::iterator> index;
+
+    /// @brief mutex ~ surfaces may be (re-)decoded off the UI thread (i.e. .gif animation)
+    std::mutex mtx;
+
+    /// @brief maximum number of bytes held before evicting (default 64 MiB)
+    size_t budget = 64 * 1024 * 1024;
+
+    /// @brief number of bytes currently held
+    size_t currentBytes = 0;
+    /// @brief largest number of bytes held at any one time
+    size_t peakBytes = 0;
+    /// @brief total number of bytes evicted
+    size_t evictedBytes = 0;
+    /// @brief total number of evictions
+    size_t evictionCount = 0;
+
+    /// @brief helper method to insert/update an owner's bytes (caller holds `mtx`)
+    void account(const void* key, iSurface* pSurface, size_t bytes) {
+        auto it = index.find(key);
+        if (it != index.end()) {
+            currentBytes -= it->second->bytes;
+            lru.erase(it->second);
+        }
+        lru.push_front(Node{ key, pSurface, bytes });
+        index[key] = lru.begin();
+        currentBytes += bytes;
+        if (currentBytes > peakBytes) {
+            peakBytes = currentBytes;
+        }
+    }
+
+public:
+
+    /// @brief     method to register/update the decoded size of an evictable surface
+    /// @param[in] pSurface ~ pointer of the surface
+    /// @param[in] bytes ~ number of bytes held by the decoded surface
+    /// @note      the surface becomes the most recently used & is never
+    ///            evicted by the trim that its own registration triggers
+    void track(iSurface* pSurface, size_t bytes) {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            account(pSurface, pSurface, bytes);
+        }
+        trim(pSurface);
+    }
+
+    /// @brief     method to register/update the size of a surface that cannot be evicted
+    /// @param[in] key ~ unique address identifying the owner of the bytes
+    /// @param[in] bytes ~ number of bytes held
+    void pin(const void* key, size_t bytes) {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            account(key, nullptr, bytes);
+        }
+        trim(nullptr);
+    }
+
+    /// @brief     method to stop tracking a surface (freed or evicted by its owner)
+    /// @param[in] key ~ surface pointer or key used with `track(...)`/`pin(...)`
+    void release(const void* key) {
+        std::lock_guard<std::mutex> lock(mtx);
+        auto it = index.find(key);
+        if (it == index.end()) {
+            return;
+        }
+        currentBytes -= it->second->bytes;
+        lru.erase(it->second);
+        index.erase(it);
+    }
+
+    /// @brief     method to mark a surface as most recently used (call when drawn)
+    /// @param[in] key ~ surface pointer or key used with `track(...)`/`pin(...)`
+    void touch(const void* key) {
+        std::lock_guard<std::mutex> lock(mtx);
+        auto it = index.find(key);
+        if (it != index.end() && it->second != lru.begin()) {
+            lru.splice(lru.begin(), lru, it->second);
+        }
+    }
+
+    /// @brief     method to evict non-visible surfaces (LRU first) until within budget
+    /// @param[in] pKeep ~ optional surface that MUST NOT be evicted (i.e. just decoded)
+    /// @remark    visible & pinned surfaces are never evicted, so the
+    ///            budget may still be exceeded once this method returns
+    void trim(iSurface* pKeep = nullptr) {
+
+        std::vector<iSurface*> victims;
+
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            auto it = lru.end();
+            while (currentBytes > budget && it != lru.begin()) {
+                --it;
+                iSurface* pSurface = it->pSurface;
+                if (!pSurface || pSurface == pKeep || pSurface->isVisible()) {
+                    continue;
+                }
+                currentBytes -= it->bytes;
+                evictedBytes += it->bytes;
+                evictionCount++;
+                index.erase(it->key);
+                it = lru.erase(it);
+                victims.push_back(pSurface);
+            }
+        }
+
+        // evict outside the lock, since surfaces may re-enter `release(...)`
+        for (iSurface* pSurface : victims) {
+            pSurface->evict();
+        }
+    }
+
+    /// @brief     method to set the budget (in bytes), evicting if now exceeded
+    /// @param[in] bytes ~ maximum number of bytes held by non-visible surfaces
+    void setBudget(size_t bytes) {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            budget = bytes;
+        }
+        trim();
+    }
+
+    /// @brief method to retrieve the budget (in bytes)
+    size_t getBudget() { return budget; }
+
+    /// @brief method to retrieve the number of bytes currently held
+    size_t current() { return currentBytes; }
+
+    /// @brief method to retrieve the largest number of bytes held at any one time
+    size_t peak() { return peakBytes; }
+
+    /// @brief method to retrieve the total number of bytes evicted
+    size_t evicted() { return evictedBytes; }
+
+    /// @brief method to retrieve the total number of evictions
+    size_t evictions() { return evictionCount; }
+
+    /// @brief method to retrieve the number of surfaces currently tracked
+    size_t count() {
+        std::lock_guard<std::mutex> lock(mtx);
+        return index.size();
+    }
+
+    /// @brief method to reset the peak counter to the current number of bytes
+    void resetPeak() {
+        std::lock_guard<std::mutex> lock(mtx);
+        peakBytes = currentBytes;
+    }
+
+    #ifndef NDEBUG
+    /// @brief method to Log `xImageBudget` counters (DEBUG)
+    void LogBudgetData() {
+        LOG(("Image bytes (current): " + std::to_string(current())).c_str());
+        LOG(("Image bytes (peak): " + std::to_string(peak())).c_str());
+        LOG(("Image bytes (evicted): " + std::to_string(evicted())).c_str());
+        LOG(("Image evictions: " + std::to_string(evictions())).c_str());
+        LOG(("Image surfaces: " + std::to_string(count())).c_str());
+    }
+    #endif
+};
+
+/// @brief initialize `xImageBudget` singleton instance pointer
+xImageBudget* xImageBudget::instance = nullptr;
+
+#endif // end of xIMAGEBUDGET_H
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
@@ -0,0 +1,305 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		xRowCache.h
+  * @author 	&lambda;ambda
+  * @date       \showdate "%Y-%m-%d"
+  *
+  * @brief 		for caching the rendered rows of owner-drawn list controls
+  *
+  * @details 	`xRowCache` keeps the bitmaps of the rows drawn by an owner-drawn
+  *             control (`xListBox`, `xDropDown`), keyed by text, state, size & style,
+  *             so that repainting a row already rendered (i.e. scrolling back,
+  *             toggling the selection) is a single blit
+  */
+
+/// @brief begin of xROWCACHE_H implementation
+#ifndef xROWCACHE_H
+#define xROWCACHE_H
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <string>
+#include <unordered_map>
+
+/**
+ * @class    xRowCache
+ * @brief    least-recently-drawn cache of rendered row bitmaps
+ * @details  A row is rendered once per (text, state, width, height, style) into a bitmap
+ *           owned by the cache, then blitted on every `WM_DRAWITEM` <br/>
+ *           The focus rectangle is drawn over the blit, so that moving the focus
+ *           does not render rows again. The bytes of the bitmaps are accounted
+ *           for by `xImageBudget` (pinned, the cache evicting by itself)
+ */
+class xRowCache {
+
+public:
+
+    /// @brief the colours & font of the rows
+    struct Style {
+        HFONT font;                   ///< font of the text (keyed by handle, i.e. the cache
+                                      ///  is cleared once the font changes)
+        COLORREF background;          ///< background colour
+        COLORREF text;                ///< text colour
+        COLORREF selectedBackground;  ///< background colour of the selected rows
+        COLORREF selectedText;        ///< text colour of the selected rows
+
+        /// @brief method to compute the stamp of the style, part of the key of every row
+        std::uint64_t stamp() const {
+            std::uint64_t h = 14695981039346656037ULL; // FNV-1a offset basis
+            const std::uint64_t parts[] = {
+                (std::uint64_t) (uintptr_t) font, background, text, selectedBackground, selectedText
+            };
+            for (std::uint64_t part : parts) {
+                h ^= part;
+                h *= 1099511628211ULL; // FNV-1a prime
+            }
+            return h;
+        }
+    };
+
+private:
+
+    /// @brief the text type of the rows
+    #if defined(UNICODE) && defined(_UNICODE)
+    typedef std::wstring text_type;
+    #else
+    typedef std::string text_type;
+    #endif
+
+    /// @brief the key of a rendered row
+    struct Key {
+        text_type text;       ///< text of the row
+        UINT state;           ///< `ODS_SELECTED` | `ODS_DISABLED` | `ODS_COMBOBOXEDIT`
+        int width;            ///< width of the row (in pixels)
+        int height;           ///< height of the row (in pixels)
+        std::uint64_t style;  ///< stamp of the style (see `Style::stamp()`)
+
+        bool operator==(const Key& other) const {
+            return state == other.state && width == other.width && height == other.height
+                && style == other.style && text == other.text;
+        }
+    };
+
+    /// @brief hash of a key
+    struct KeyHash {
+        size_t operator()(const Key& key) const {
+            size_t h = std::hash<text_type>()(key.text);
+            h ^= (size_t) key.style + 0x9E3779B9 + (h << 6) + (h >> 2);
+            h ^= ((size_t) key.state << 24) ^ ((size_t) key.width << 12) ^ (size_t) key.height;
+            return h;
+        }
+    };
+
+    /// @brief a rendered row
+    struct Node {
+        Key key;        ///< key of the row
+        HBITMAP hBmp;   ///< the rendered row
+        size_t bytes;   ///< size of the bitmap (in bytes)
+    };
+
+    /// @brief rows in least-recently-drawn order (front = most recent)
+    std::list<Node> lru;
+
+    /// @brief index of `lru` by key
+    std::unordered_map<Key, std::list<Node>::iterator, KeyHash> index;
+
+    /// @brief memory device context the rows are rendered in & blitted from
+    HDC hMemDC = NULL;
+
+    /// @brief maximum number of rows kept (default 256)
+    size_t capacity = 256;
+    /// @brief number of bytes held by the bitmaps
+    size_t currentBytes = 0;
+    /// @brief flag indicating the bytes are accounted for by `xImageBudget`
+    bool pinned = false;
+
+    /// @brief number of rows blitted from the cache
+    size_t hitCount = 0;
+    /// @brief number of rows rendered
+    size_t missCount = 0;
+    /// @brief number of rows evicted
+    size_t evictionCount = 0;
+
+    /// @brief helper method to discard the least recently drawn rows past `capacity`
+    void trim() {
+        while (lru.size() > capacity) {
+            Node& node = lru.back();
+            DeleteObject(node.hBmp);
+            currentBytes -= node.bytes;
+            index.erase(node.key);
+            lru.pop_back();
+            evictionCount++;
+        }
+        account();
+    }
+
+    /// @brief helper method to report the bytes held to `xImageBudget`
+    void account() {
+        if (currentBytes) {
+            xImageBudget::get().pin(this, currentBytes);
+            pinned = true;
+        } else if (pinned) {
+            xImageBudget::get().release(this);
+            pinned = false;
+        }
+    }
+
+    /// @brief     helper method to render a row into a new bitmap
+    /// @param[in] hDC ~ device context the bitmap is compatible with
+    /// @param[in] key ~ key of the row
+    /// @param[in] style ~ colours & font of the row
+    /// @return    the rendered row
+    HBITMAP render(HDC hDC, const Key& key, const Style& style) {
+
+        HBITMAP hBmp = CreateCompatibleBitmap(hDC, key.width, key.height);
+        if (!hBmp) {
+            return NULL;
+        }
+        HGDIOBJ hOldBmp = SelectObject(hMemDC, hBmp);
+
+        const bool selected = (key.state & ODS_SELECTED) != 0;
+        RECT rect = { 0, 0, key.width, key.height };
+
+        HBRUSH hBrush = CreateSolidBrush(selected ? style.selectedBackground : style.background);
+        FillRect(hMemDC, &rect, hBrush);
+        DeleteObject(hBrush);
+
+        SetTextColor(hMemDC, (key.state & ODS_DISABLED)
+            ? GetSysColor(COLOR_GRAYTEXT)
+            : (selected ? style.selectedText : style.text)
+        );
+        SetBkMode(hMemDC, TRANSPARENT);
+        HGDIOBJ hOldFont = SelectObject(hMemDC, style.font);
+
+        rect.left += 2;
+        DrawText(
+            hMemDC, key.text.c_str(), (int) key.text.size(), &rect,
+            DT_SINGLELINE | DT_VCENTER | DT_NOPREFIX | DT_END_ELLIPSIS
+        );
+
+        SelectObject(hMemDC, hOldFont);
+        SelectObject(hMemDC, hOldBmp);
+        return hBmp;
+    }
+
+public:
+
+    /// @brief constructor ~ keeping at most `capacity` rows
+    explicit xRowCache(size_t capacity = 256) : capacity(capacity) {}
+
+    /// @brief destructor ~ frees the bitmaps
+    ~xRowCache() {
+        clear();
+    }
+
+    /// @brief delete copy constructor (owns GDI objects)
+    xRowCache(const xRowCache&) = delete;
+    /// @brief delete copy assignment operator (owns GDI objects)
+    xRowCache& operator=(const xRowCache&) = delete;
+
+    /// @brief     method to draw a row (`WM_DRAWITEM`), rendered once & blitted afterwards
+    /// @param[in] lpDIS ~ the draw item structure of the row
+    /// @param[in] text ~ text of the row
+    /// @param[in] selected ~ whether the row is drawn selected
+    /// @param[in] style ~ colours & font of the rows
+    void draw(LPDRAWITEMSTRUCT lpDIS, const text_type& text, bool selected, const Style& style) {
+
+        const RECT& rcItem = lpDIS->rcItem;
+        Key key;
+        key.text = text;
+        key.state = (selected ? ODS_SELECTED : 0) | (lpDIS->itemState & (ODS_DISABLED | ODS_COMBOBOXEDIT));
+        key.width = rcItem.right - rcItem.left;
+        key.height = rcItem.bottom - rcItem.top;
+        key.style = style.stamp();
+
+        if (key.width <= 0 || key.height <= 0) {
+            return;
+        }
+
+        if (!hMemDC) {
+            hMemDC = CreateCompatibleDC(lpDIS->hDC);
+        }
+
+        HBITMAP hBmp = NULL;
+        bool rendered = false;
+        auto it = index.find(key);
+        if (it != index.end()) {
+            lru.splice(lru.begin(), lru, it->second);
+            hBmp = it->second->hBmp;
+            hitCount++;
+        } else {
+            hBmp = render(lpDIS->hDC, key, style);
+            if (!hBmp) {
+                return;
+            }
+            const size_t bytes = (size_t) key.width * key.height * 4;
+            lru.push_front(Node{ key, hBmp, bytes });
+            index[key] = lru.begin();
+            currentBytes += bytes;
+            missCount++;
+            rendered = true;
+        }
+
+        HGDIOBJ hOldBmp = SelectObject(hMemDC, hBmp);
+        BitBlt(lpDIS->hDC, rcItem.left, rcItem.top, key.width, key.height, hMemDC, 0, 0, SRCCOPY);
+        SelectObject(hMemDC, hOldBmp);
+
+        // evict once blitted ~ the row itself may not fit (i.e. `setCapacity(0)`)
+        if (rendered) {
+            trim();
+        }
+
+        if (lpDIS->itemState & ODS_FOCUS) {
+            DrawFocusRect(lpDIS->hDC, &rcItem);
+        }
+    }
+
+    /// @brief method to free every bitmap (i.e. once the rows are not to be drawn again)
+    void clear() {
+        for (Node& node : lru) {
+            DeleteObject(node.hBmp);
+        }
+        lru.clear();
+        index.clear();
+        currentBytes = 0;
+        account();
+        if (hMemDC) {
+            DeleteDC(hMemDC);
+            hMemDC = NULL;
+        }
+    }
+
+    /// @brief method to set the maximum number of rows kept
+    void setCapacity(size_t rows) {
+        capacity = rows;
+        trim();
+    }
+
+    /// @brief method to retrieve the number of rows kept
+    size_t size() { return lru.size(); }
+    /// @brief method to retrieve the number of bytes held by the bitmaps
+    size_t bytes() { return currentBytes; }
+    /// @brief method to retrieve the number of rows blitted from the cache
+    size_t hits() { return hitCount; }
+    /// @brief method to retrieve the number of rows rendered
+    size_t misses() { return missCount; }
+    /// @brief method to retrieve the number of rows evicted
+    size_t evictions() { return evictionCount; }
+
+    #ifndef NDEBUG
+    /// @brief method to Log the cache counters (DEBUG)
+    void LogRowCacheData() {
+        LOG(("Row cache rows: " + std::to_string(size())).c_str());
+        LOG(("Row cache bytes: " + std::to_string(bytes())).c_str());
+        LOG(("Row cache hits: " + std::to_string(hits())).c_str());
+        LOG(("Row cache misses: " + std::to_string(misses())).c_str());
+        LOG(("Row cache evictions: " + std::to_string(evictions())).c_str());
+    }
+    #endif
+};
+
+#endif // end of xROWCACHE_H
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
@@ -0,0 +1,279 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		xTimer.h
+  * @author 	&lambda;ambda
+  * @date       \showdate "%Y-%m-%d"
+  *
+  * @brief 		for running deferred (one-shot) tasks on the UI thread
+  *
+  * @details 	`xTimer` schedules tasks with thread timers (`SetTimer(NULL, ...)`),
+  *             run by the message loop of the application, so that tasks run on
+  *             the UI thread without a window of their own. <br/>
+  *             `xEventGate` delivers the events of a listener through `xTimer`
+  *             according to an `EventPolicy` (see utils/event/EventGate.h)
+  */
+
+/// @brief begin of xTIMER_H implementation
+#ifndef xTIMER_H
+#define xTIMER_H
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <unordered_map>
+
+/**
+ * @class    xTimer
+ * @brief    singleton running one-shot tasks upon thread timers
+ * @details `xTimer` implements the singleton design pattern <br/>
+ *           A task runs once, `ms` after `start(...)`, unless `stop(...)`-ped before
+ */
+class xTimer {
+
+public:
+
+    /// @brief  static method that retrieves the `xTimer` singleton instance pointer
+    /// @return reference to `xTimer` singleton instance pointer
+    static xTimer& get() {
+        if (instance == nullptr) {
+            instance = new xTimer();
+        }
+        return *instance;
+    }
+
+    /// @brief delete copy constructor
+    xTimer(const xTimer&) = delete;
+    /// @brief delete copy assignment operator
+    xTimer& operator=(const xTimer&) = delete;
+
+    /// @brief method for destructing `xTimer` singleton instance
+    static void destruct() {
+        delete instance;
+        instance = nullptr;
+    }
+
+    /// @brief method to check whether the singleton instance exists
+    ///        (i.e. not destructed before the widgets holding tasks)
+    static bool alive() {
+        return instance != nullptr;
+    }
+
+private:
+
+    /// @brief private default constructor
+    xTimer() = default;
+
+    /// @brief private destructor ~ kills the timers of the pending tasks
+    ~xTimer() {
+        for (auto& task : tasks) {
+            KillTimer(NULL, task.first);
+        }
+    }
+
+    /// @brief `xTimer` singleton instance pointer
+    static xTimer* instance;
+
+private:
+
+    /// @brief pending tasks by timer ID
+    std::unordered_map<UINT_PTR, std::function<void()>> tasks;
+
+    /// @brief total number of tasks run
+    size_t runCount = 0;
+
+    /// @brief   static timer procedure (dispatched by the message loop)
+    /// @details the task is removed before it runs, so that it MAY start another one
+    static VOID CALLBACK TimerProc(HWND hWnd, UINT msg, UINT_PTR id, DWORD time) {
+
+        UNUSED(hWnd);
+        UNUSED(msg);
+        UNUSED(time);
+
+        KillTimer(NULL, id);
+        if (instance == nullptr) {
+            return;
+        }
+
+        auto found = instance->tasks.find(id);
+        if (found == instance->tasks.end()) {
+            return;
+        }
+        std::function<void()> task = std::move(found->second);
+        instance->tasks.erase(found);
+
+        instance->runCount++;
+        task();
+    }
+
+public:
+
+    /// @brief     method to run a task once, after a delay
+    /// @param[in] ms ~ delay (in milliseconds), at least `USER_TIMER_MINIMUM`
+    /// @param[in] task ~ the task, run on the UI thread
+    /// @return    ID of the task (for `stop(...)`), `0` on failure
+    UINT_PTR start(UINT ms, std::function<void()> task) {
+        UINT_PTR id = SetTimer(NULL, 0, ms, &xTimer::TimerProc);
+        if (id != 0) {
+            tasks[id] = std::move(task);
+        }
+        return id;
+    }
+
+    /// @brief     method to cancel a pending task
+    /// @param[in] id ~ ID of the task returned by `start(...)`
+    void stop(UINT_PTR id) {
+        if (tasks.erase(id) != 0) {
+            KillTimer(NULL, id);
+        }
+    }
+
+    /// @brief method to retrieve the number of pending tasks
+    size_t pending() {
+        return tasks.size();
+    }
+
+    /// @brief method to retrieve the total number of tasks run
+    size_t runs() {
+        return runCount;
+    }
+
+    /// @brief  static method to retrieve the time of the timers (in milliseconds)
+    static unsigned long long now() {
+        return static_cast<unsigned long long>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()
+            ).count()
+        );
+    }
+
+    #ifndef NDEBUG
+    /// @brief method to Log `xTimer` counters (DEBUG)
+    void LogTimerData() {
+        LOG(("Timer tasks (pending): " + std::to_string(pending())).c_str());
+        LOG(("Timer tasks (run): " + std::to_string(runs())).c_str());
+    }
+    #endif
+};
+
+/// @brief initialize `xTimer` singleton instance pointer
+xTimer* xTimer::instance = nullptr;
+
+/**
+ * @class    xEventGate
+ * @brief    delivers the events of a listener according to an `EventPolicy`
+ * @details  Events are `post()`-ed as they happen, the `deliver` function being
+ *           invoked at once or later (upon `xTimer`), a burst being collapsed
+ *           into a single delivery. The deliver function reads the state of the
+ *           widget when invoked, i.e. the latest text or selection <br/>
+ *           The pending task is cancelled when the gate is destroyed
+ */
+class xEventGate {
+
+public:
+
+    /// @brief constructor ~ the function delivering an event (immediate policy)
+    explicit xEventGate(std::function<void()> deliver) : mDeliver(std::move(deliver)) {}
+
+    /// @brief destructor ~ cancels the pending task
+    ~xEventGate() {
+        disarm();
+    }
+
+    /// @brief deleted copy constructor ~ the pending task refers to this gate
+    xEventGate(const xEventGate&) = delete;
+    /// @brief deleted copy assignment operator ~ the pending task refers to this gate
+    xEventGate& operator=(const xEventGate&) = delete;
+
+    /// @brief   method to change the delivery policy
+    /// @details an event pending under the previous policy is delivered first
+    void setPolicy(EventPolicy policy) {
+        flush();
+        gate.setPolicy(policy);
+    }
+
+    /// @brief method to retrieve the delivery policy
+    EventPolicy getPolicy() {
+        return gate.policy();
+    }
+
+    /// @brief method to record an event ~ delivered now or upon `xTimer`
+    void post() {
+        if (gate.post(xTimer::now())) {
+            mDeliver();
+            return;
+        }
+        // an armed timer firing early re-arms itself until `due()` ...
+        if (!timer) {
+            arm();
+        }
+    }
+
+    /// @brief method to deliver the pending event (if any) at once
+    void flush() {
+        disarm();
+        if (gate.flush(xTimer::now())) {
+            mDeliver();
+        }
+    }
+
+    /// @brief method to drop the pending event (if any)
+    void cancel() {
+        disarm();
+        gate.cancel();
+    }
+
+    /// @brief method to retrieve the number of events posted
+    size_t getPosted() { return gate.posted(); }
+
+    /// @brief method to retrieve the number of events delivered
+    size_t getDelivered() { return gate.delivered(); }
+
+    /// @brief method to retrieve the number of events collapsed into a later one
+    size_t getDropped() { return gate.dropped(); }
+
+private:
+
+    /// @brief the delivery decisions
+    EventGate gate;
+
+    /// @brief the function delivering an event
+    std::function<void()> mDeliver;
+
+    /// @brief ID of the pending `xTimer` task (`0` if none)
+    UINT_PTR timer = 0;
+
+    /// @brief helper method to start the timer until the pending event is due
+    void arm() {
+        const unsigned long long now = xTimer::now();
+        const unsigned long long wait = gate.due() > now ? gate.due() - now : 0;
+        timer = xTimer::get().start(static_cast<UINT>(wait), [this]() { onTimer(); });
+        if (!timer) {
+            // no timer left => do not lose the event
+            flush();
+        }
+    }
+
+    /// @brief helper method to stop the timer (if any)
+    void disarm() {
+        if (timer && xTimer::alive()) {
+            xTimer::get().stop(timer);
+        }
+        timer = 0;
+    }
+
+    /// @brief helper method run by the timer
+    void onTimer() {
+        timer = 0;
+        // input pending in the queue of the thread => not idle
+        const bool busy = HIWORD(GetQueueStatus(QS_INPUT)) != 0;
+        if (gate.fire(xTimer::now(), busy)) {
+            mDeliver();
+        } else if (gate.pending()) {
+            arm();
+        }
+    }
+};
+
+#endif // end of xTIMER_H
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
@@ -16,6 +16,10 @@
 
 #pragma once
 
+#include <cstdint>
+#include <deque>
+#include <vector>
+
 // forward declarations ...
 class xMenuItem;
 class xRadioItem;
@@ -27,7 +31,13 @@ class xRadioItem;
  * @details  This class implements the singleton design pattern
  *           & interfaces with `xMenuItem` factory design pattern
  *           to ensure proper resource management
- *           of `xMenuItem` resources
+ *           of `xMenuItem` resources <br/>
+ *
+ *           The ID of a menu item is the index of its slot in a dense table,
+ *           so that `WM_COMMAND` finds the item in O(1) (`LOWORD(wParam)`, i.e.
+ *           IDs up to `0xFFFF`) & looking up an unknown ID inserts nothing. <br/>
+ *           IDs of removed items go to a (first-in, first-out) free list,
+ *           every slot counting the items it held (its generation)
  */
 class xItemManager {
 
@@ -71,12 +81,38 @@ private:
 
 private:
 
-    /// @brief   container storing all used `xMenu` objects manufatured by `xMenu` the factory pattern
-    /// @details a map is used to ensure ordered indexing, corresonding to the menu item's ID
-    static std::map<int, xMenuItem*> items;
-    /// @brief   container storing all temporary `xMenu` objects manufatured by `xMenu` the factory pattern
-    /// @details an unordered map is used to keep the container relatively small (not critical)
-    static std::unordered_map<int, xMenuItem*> temp;
+    /// @brief the largest menu item ID (`WM_COMMAND` carries 16-bit IDs)
+    static const int MAX_ITEM_ID = 0xFFFF;
+
+    /// @brief state of a slot of the item table
+    enum class SlotState : std::uint8_t {
+        FREE, ///< no item, the ID being in the free list
+        TEMP, ///< item manufactured, not yet added to a menu
+        USED  ///< item added to a menu
+    };
+
+    /// @brief slot of the item table, indexed by menu item ID
+    struct Slot {
+        xMenuItem* item = nullptr;          ///< the item holding the ID
+        std::uint32_t generation = 0;       ///< number of items which released the ID
+        SlotState state = SlotState::FREE;  ///< whether the item is temporary or used
+    };
+
+    /// @brief   table of all `xMenuItem` objects manufatured by the factory pattern
+    /// @details indexed by menu item ID, slot 0 being reserved (0 indicates
+    ///          that a menu item selection has been cancelled)
+    static std::vector<Slot> slots;
+    /// @brief IDs of the free slots, reused in the order they were released
+    static std::deque<std::uint16_t> freeIDs;
+    /// @brief number of items added to a menu
+    static size_t usedCount;
+    /// @brief number of temporary items
+    static size_t tempCount;
+
+    /// @brief helper method to take a free ID (0 if every ID is taken)
+    static int acquireID();
+    /// @brief helper method to release the ID of an item to the free list
+    static void releaseID(int itemID);
 
 public:
 
@@ -96,11 +132,29 @@ public:
 
     /// @brief method to retrieve the size of the menu item container
     /// @return integer representative of the menu item count
-    int size() { return items.size(); }
+    int size() { return (int) usedCount; }
 
     /// @brief method to retrieve the size of the temp menu item container
     /// @return integer representative of the temp menu item count
-    int tempSize() { return temp.size(); }
+    int tempSize() { return (int) tempCount; }
+
+    /// @brief method to retrieve the number of slots holding an item (used & temp)
+    static size_t liveSlots() { return usedCount + tempCount; }
+
+    /// @brief method to retrieve the number of free slots (IDs to reuse)
+    static size_t freeSlots() { return freeIDs.size(); }
+
+    /// @brief method to retrieve the number of slots (i.e. the largest ID handed out + 1)
+    static size_t slotCount() { return slots.size(); }
+
+    /// @brief method to retrieve the generation of an ID, i.e. the number of items
+    ///        which held the ID before, to tell a reused ID from the one remembered
+    static std::uint32_t getGeneration(int itemID) {
+        if (itemID <= 0 || (size_t) itemID >= slots.size()) {
+            return 0;
+        }
+        return slots[itemID].generation;
+    }
 
     // implementation after `xMenuItem`
     /// @todo make this protected
@@ -127,14 +181,22 @@ public:
     /// @param itemID ~ integer representative of the item's ID
     /// @return pointer of the menu item found, or `nullptr` if NOT
     static xMenuItem* getItemByID(int itemID) {
-        return items[itemID];
+        if (itemID <= 0 || (size_t) itemID >= slots.size()
+            || slots[itemID].state != SlotState::USED) {
+            return nullptr;
+        }
+        return slots[itemID].item;
     }
 
     /// @brief method to get a temp item from the item manager's temp container by item ID
     /// @param itemID ~ integer representative of the item's ID
     /// @return pointer of the menu item found, or `nullptr` if NOT
     static xMenuItem* getTempItemByID(int itemID) {
-        return temp[itemID];
+        if (itemID <= 0 || (size_t) itemID >= slots.size()
+            || slots[itemID].state != SlotState::TEMP) {
+            return nullptr;
+        }
+        return slots[itemID].item;
     }
 
     /// @brief method to redirect/dispatch menu-item click
@@ -166,9 +228,12 @@ public:
         EnumerateTempItems();
 
         // The number of used borders ...
-        LOG(("Used count: " + std::to_string(items.size())).c_str());
+        LOG(("Used count: " + std::to_string(usedCount)).c_str());
         // The nnumber of existing borders ...
-        LOG(("Temp count: " + std::to_string(temp.size())).c_str());
+        LOG(("Temp count: " + std::to_string(tempCount)).c_str());
+        // The number of IDs handed out & free ...
+        LOG(("Slot count: " + std::to_string(slots.size())).c_str());
+        LOG(("Free slots: " + std::to_string(freeIDs.size())).c_str());
 
         // The difference between existing borders & used borders ...
         LOG(("Count Difference: " + std::to_string(calculateDifference())).c_str());
@@ -178,7 +243,7 @@ public:
     /// @brief method to calculate the difference in size
     /// for the used-items container & temp-items container
     static int calculateDifference() {
-        return items.size() - temp.size();
+        return (int) usedCount - (int) tempCount;
     }
 
     /// @brief method to clear the container,
@@ -191,8 +256,10 @@ public:
 
 // C++11 DOES NOT SUPPORT inline static declaration
 xItemManager* xItemManager::instance = nullptr;
-std::map<int, xMenuItem*> xItemManager::items;
-std::unordered_map<int, xMenuItem*> xItemManager::temp;
+std::vector<xItemManager::Slot> xItemManager::slots;
+std::deque<std::uint16_t> xItemManager::freeIDs;
+size_t xItemManager::usedCount = 0;
+size_t xItemManager::tempCount = 0;
 
 #endif // end of xITEMMANAGER_H
 /*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
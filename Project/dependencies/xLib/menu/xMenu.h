@@ -424,16 +424,21 @@ void xMenuItem::destroy() {
     if (hBitmapCheck) {
         // std::cout << "hBitmapCheck" << std::endl;
         DeleteObject(hBitmapCheck);
+        xImageBudget::get().release(&hBitmapCheck);
     }
 
     if (hBitmapUncheck) {
         // std::cout << "hBitmapUncheck" << std::endl;
         DeleteObject(hBitmapUncheck);
+        xImageBudget::get().release(&hBitmapUncheck);
     }
 
     // remove the item from the menu ...
     // removes a menu item but does not free resources ...
-    RemoveMenu(parent->hMenu, mID, MF_BYCOMMAND);
+    // (temporary items belong to no menu yet)
+    if (parent) {
+        RemoveMenu(parent->hMenu, mID, MF_BYCOMMAND);
+    }
 
     // destroys submenu recursively & frees resources ...
     // for Win32 builds only, not applicable to this design ...
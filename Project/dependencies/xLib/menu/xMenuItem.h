@@ -142,48 +142,67 @@ protected:
 
     /// @brief helper (internal) method to load an image
     /// associated to the menu item, given its path & dimensions
+    /// @note  the previous bitmap held by `hBitmap` (if any) is freed,
+    ///        & the new bitmap is accounted for (pinned) by `xImageBudget`
     bool LoadImage(
         const std::string& path,
         HBITMAP& hBitmap,
         int w, int h
     ) {
+
+        // hold on to the previous bitmap (freed once replaced) ...
+        HBITMAP hPrevBitmap = hBitmap;
+        hBitmap = NULL;
         
-        // load the bitmap image from a file ...
-        Gdiplus::Bitmap* pBitmap = Gdiplus::Bitmap::FromFile(
-            StrConverter::StringToWString(path).c_str()
-        );
+        // load the bitmap image from a file (or from the asset archive) ...
+        Gdiplus::Bitmap* pBitmap = xPack::isPackPath(path)
+            ? xPack::get().loadBitmap(path)
+            : Gdiplus::Bitmap::FromFile(StrConverter::StringToWString(path).c_str());
 
-        // extract the bitmap from Gdiplus::Bitmap* with transparent background ...
-        pBitmap->GetHBITMAP(Gdiplus::Color(0,0,0,0), &hBitmap);
+        if (pBitmap && (w != -1 || h != -1)) {
 
-        // if any of w or h -1 then use original image dimensions, otherwize ...
-        // create a new bitmap image using provided dimensions & overwrite previous ...
-        if (w != -1 || h != -1) {
+            // if any of w or h -1 then use original image dimension,
+            // otherwize create a new bitmap image using provided dimensions ...
+            if (w == -1) { w = pBitmap->GetWidth(); }
+            if (h == -1) { h = pBitmap->GetHeight(); }
             
-            // create a new image with scaled dimensions w & h ...
-            Gdiplus::Bitmap* scaledImage = new Gdiplus::Bitmap(w, h, PixelFormat32bppARGB);
-
-            // prepare for overwriting the image ...
-            Gdiplus::Graphics graphics(scaledImage);
-            // using high quality bicubic bitmap object ...
-            graphics.SetInterpolationMode(Gdiplus::InterpolationModeHighQualityBicubic);
-
-            // overwrite the original bitmap object ...
-            graphics.DrawImage(pBitmap, 0, 0, w, h);
+            // create a new image with scaled dimensions w & h (bicubic) ...
+            Gdiplus::Bitmap* scaledImage = xGDI::resample(pBitmap, w, h);
 
-            // get the handle of the new (overwritten) bitmap image
+            // get the handle of the new (scaled) bitmap image
             // & save this handle into the referenced bitmap ...
-            scaledImage->GetHBITMAP(Gdiplus::Color(0,0,0,0), &hBitmap);
+            if (scaledImage) {
+                scaledImage->GetHBITMAP(Gdiplus::Color(0,0,0,0), &hBitmap);
+            }
 
             // free the scaled bitmap resources ...
             delete scaledImage;
             scaledImage = nullptr;
+
+        } else if (pBitmap) {
+
+            // extract the bitmap from Gdiplus::Bitmap* with transparent background ...
+            pBitmap->GetHBITMAP(Gdiplus::Color(0,0,0,0), &hBitmap);
         }
 
         // free the original bitmap resources ...
         delete pBitmap;
         pBitmap = nullptr;
 
+        // free the replaced bitmap ...
+        if (hPrevBitmap) {
+            DeleteObject(hPrevBitmap);
+        }
+
+        // menu bitmaps cannot be re-decoded on demand => pinned ...
+        if (hBitmap) {
+            BITMAP bm;
+            GetObject(hBitmap, sizeof(BITMAP), &bm);
+            xImageBudget::get().pin(&hBitmap, static_cast<size_t>(bm.bmWidthBytes) * bm.bmHeight);
+        } else {
+            xImageBudget::get().release(&hBitmap);
+        }
+
         return (hBitmap ? true: false);
     }
 
@@ -476,29 +495,36 @@ public:
 
 /// implementation for `xItemManager::clear()`
 void xItemManager::clear() {
-    // destroy menu items held in temp ...
-    for (size_t i = 0; i < items.size(); i++) {
-        items[i]->destroy();
+    // destroy menu items held in use ...
+    for (size_t id = 1; id < slots.size(); id++) {
+        if (slots[id].state == SlotState::USED) {
+            slots[id].item->destroy();
+            releaseID((int) id);
+        }
     }
-    items.clear();
 }
 
 /// implementation for `xItemManager::clearTemp()`
 void xItemManager::clearTemp() {
     // destroy menu items held in temp ...
-    for (size_t i = 0; i < temp.size(); i++) {
-        temp[i]->destroy();
+    for (size_t id = 1; id < slots.size(); id++) {
+        if (slots[id].state == SlotState::TEMP) {
+            if (slots[id].item) {
+                slots[id].item->destroy();
+            }
+            releaseID((int) id);
+        }
     }
-    temp.clear();
 }
 
 #ifndef NDEBUG
 /// implementation for `xItemManager::EnumerateItems()`
 void xItemManager::EnumerateItems() {
-    std::map<int, xMenuItem*>::iterator i;
-    for (i = items.begin(); i != items.end(); i++) {
-        std::cout << "map index: " << i->first
-        << " => " << *i->second << std::endl;
+    for (size_t id = 1; id < slots.size(); id++) {
+        if (slots[id].state == SlotState::USED) {
+            std::cout << "slot index: " << id
+            << " => " << *slots[id].item << std::endl;
+        }
     }
 }
 #endif
@@ -506,17 +532,18 @@ void xItemManager::EnumerateItems() {
 #ifndef NDEBUG
 /// implementation for `xItemManager::EnumerateTempItems()`
 void xItemManager::EnumerateTempItems() {
-    std::unordered_map<int, xMenuItem*>::iterator i;
-    for (i = temp.begin(); i != temp.end(); i++) {
-        std::cout << "map index: " << i->first
-        << " => " << *i->second << std::endl;
+    for (size_t id = 1; id < slots.size(); id++) {
+        if (slots[id].state == SlotState::TEMP && slots[id].item) {
+            std::cout << "slot index: " << id
+            << " => " << *slots[id].item << std::endl;
+        }
     }
 }
 #endif
 
 /// implementation for `xItemManager::triggerMenuItemClickEvent`
 void xItemManager::triggerMenuItemClickEvent(int itemID, xWidget* pWidget) {
-    // retrieve the item pointer from `xItemManager`
+    // retrieve the item pointer from `xItemManager` (O(1), no insertion) ...
     xMenuItem* item = xItemManager::getItemByID(itemID);
     // check if item is not `nullptr`
     if (item) {
@@ -528,18 +555,65 @@ void xItemManager::triggerMenuItemClickEvent(int itemID, xWidget* pWidget) {
     }
 }
 
+/// implementation for `xItemManager::acquireID()`
+int xItemManager::acquireID() {
+
+    // slot 0 is reserved => mID cannot be 0
+    // 0 indicated menu item selection cancelled
+    if (slots.empty()) {
+        slots.resize(1);
+    }
+
+    int id = 0;
+    if (!freeIDs.empty()) {
+        // reuse the ID released the earliest ...
+        id = freeIDs.front();
+        freeIDs.pop_front();
+    } else if (slots.size() <= (size_t) MAX_ITEM_ID) {
+        id = (int) slots.size();
+        slots.emplace_back();
+    } else {
+        LOG("xItemManager::acquireID() ~ no menu item ID left");
+        return 0;
+    }
+
+    slots[id].item = nullptr;
+    slots[id].state = SlotState::TEMP;
+    tempCount++;
+    return id;
+}
+
+/// implementation for `xItemManager::releaseID(...)`
+void xItemManager::releaseID(int itemID) {
+
+    Slot& slot = slots[itemID];
+    if (slot.state == SlotState::USED) {
+        usedCount--;
+    } else if (slot.state == SlotState::TEMP) {
+        tempCount--;
+    } else {
+        return;
+    }
+
+    slot.item = nullptr;
+    slot.state = SlotState::FREE;
+    slot.generation++;
+    freeIDs.push_back((std::uint16_t) itemID);
+}
+
 /// implementation for `xMenuItem::createMenuItem`
 xMenuItem* xItemManager::createMenuItem(
     const std::string& text = "",
     event_onMenuItemClick action = xMenuItem::defaultMenuItemClickEvent
 ) {
     
-    // sum of used & temp items ...
-    int size = xItemManager::items.size() + xItemManager::temp.size();
+    // the ID of a free slot (IDs of removed items are reused) ...
+    int id = xItemManager::acquireID();
+    if (id == 0) {
+        return nullptr;
+    }
 
-    // increment the size by 1 => mID cannot be 0
-    // 0 indicated menu item selection cancelled
-    xMenuItem* item = new xMenuItem(++size, text);
+    xMenuItem* item = new xMenuItem(id, text);
 
     // store the item in temp container ...
     xItemManager::storeTempItem(item);
@@ -550,61 +624,56 @@ xMenuItem* xItemManager::createMenuItem(
     return item;
 }
 
-/// implementation for `xMenuManager::EnumerateTempMenus(...)` [DEBUG]
+/// implementation for `xItemManager::storeItem(...)`
 void xItemManager::storeItem(xMenuItem* item) {
-    if (!item) { return; }
-    items[item->mID] = item;
-    removeTempItem(item);
+    if (!item || item->mID <= 0 || (size_t) item->mID >= slots.size()) { return; }
+    Slot& slot = slots[item->mID];
+    if (slot.state == SlotState::TEMP) {
+        tempCount--;
+    }
+    if (slot.state != SlotState::USED) {
+        usedCount++;
+    }
+    slot.item = item;
+    slot.state = SlotState::USED;
 }
 
-/// implementation for `xMenuManager::EnumerateTempMenus(...)` [DEBUG]
+/// implementation for `xItemManager::storeTempItem(...)`
 void xItemManager::storeTempItem(xMenuItem* item) {
-    if (!item) { return; }
-    temp.insert(std::make_pair(item->mID, item));
+    if (!item || item->mID <= 0 || (size_t) item->mID >= slots.size()) { return; }
+    Slot& slot = slots[item->mID];
+    // the slot is taken by `acquireID()` ...
+    if (slot.state == SlotState::TEMP) {
+        slot.item = item;
+    }
 }
 
-/// implementation for `xMenuManager::EnumerateTempMenus(...)` [DEBUG]
+/// implementation for `xItemManager::removeItem(...)`
 void xItemManager::removeItem(xMenuItem* item) {
-    if (!item) { return; }
-    std::map<int, xMenuItem*>::iterator i;
-    i = items.find(item->mID);
-    if (i != items.end()) {
-        // #ifndef NDEBUG
-        // std::cout << *item << std::endl;
-        // #endif
-        item->destroy();
-        items.erase(item->mID);
-    }
+    if (!checkItem(item)) { return; }
+    // #ifndef NDEBUG
+    // std::cout << *item << std::endl;
+    // #endif
+    item->destroy();
+    releaseID(item->mID);
 }
 
-/// implementation for `xMenuManager::EnumerateTempMenus(...)` [DEBUG]
+/// implementation for `xItemManager::removeTempItem(...)`
 void xItemManager::removeTempItem(xMenuItem* item) {
-    if (!item) { return; }
-    std::unordered_map<int, xMenuItem*>::iterator i;
-    i = temp.find(item->mID);
-    if (i != temp.end()) {
-        temp.erase(item->mID);
-    }
+    if (!checkTempItem(item)) { return; }
+    releaseID(item->mID);
 }
 
-/// implementation for `xMenuManager::EnumerateTempMenus(...)` [DEBUG]
+/// implementation for `xItemManager::checkItem(...)`
 bool xItemManager::checkItem(xMenuItem* item) {
     if (!item) { return false; }
-    std::map<int, xMenuItem*>::iterator i;
-    i = items.find(item->mID);
-    if (i != items.end()) {
-        return true;
-    } else { return false; }
+    return getItemByID(item->mID) == item;
 }
 
-/// implementation for `xMenuManager::EnumerateTempMenus(...)` [DEBUG]
+/// implementation for `xItemManager::checkTempItem(...)`
 bool xItemManager::checkTempItem(xMenuItem* item) {
     if (!item) { return false; }
-    std::unordered_map<int, xMenuItem*>::iterator i;
-    i = temp.find(item->mID);
-    if (i != temp.end()) {
-        return true;
-    } else { return false; }
+    return getTempItemByID(item->mID) == item;
 }
 
 #endif // end of xMENUITEM_H
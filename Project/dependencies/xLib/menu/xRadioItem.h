@@ -91,12 +91,13 @@ public:
 
 /// implementation of `xItemManager::createRadioItem(...)`
 xRadioItem* xItemManager::createRadioItem(const std::string& text) {
-    // sum of used & temp items ...
-    int size = xItemManager::items.size() + xItemManager::temp.size();
+    // the ID of a free slot (IDs of removed items are reused) ...
+    int id = xItemManager::acquireID();
+    if (id == 0) {
+        return nullptr;
+    }
 
-    // increment the size by 1 => mID cannot be 0
-    // 0 indicated menu item selection cancelled
-    xRadioItem* item = new xRadioItem(++size, text);
+    xRadioItem* item = new xRadioItem(id, text);
 
     // store the item in temp container ...
     xItemManager::storeTempItem(item);
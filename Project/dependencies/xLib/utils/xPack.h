@@ -0,0 +1,484 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 	  xPack.h
+  * @author   &lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  * @brief 	  contains `xPack` class declaration & implemenation
+  * @details  xPack.h defines the `xPack` singleton, which mounts `.xpak` asset
+  *           archives (see `AssetPack`) & serves their contents to `xImage`,
+  *           `xIcon` & `xMenuItem` straight from the memory-mapped view
+  */
+
+#pragma once
+
+/// @brief begin xPACK_H implementation
+#ifndef xPACK_H
+#define xPACK_H
+
+#include <objidl.h> // IStream
+
+/**
+ * @class    xPack
+ * @brief   `xPack` resolves "pack:" paths against mounted asset archives
+ * @details  Any image/icon path starting with "pack:" is looked up in the
+ *           mounted archives (most recently mounted first) instead of on disk, i.e.
+ *
+ *               pButton->setImage("pack:src/png/cpp.png");
+ *               frame.setIcon("pack:dependencies/img/ico/icon.ico");
+ *
+ *           If no archive was mounted explicitly, the first lookup mounts
+ *           `assets.xpak` next to the executable, `rsc/assets.xpak` relative
+ *           to the project root (`bin/<mode>/../../rsc`) or the working directory,
+ *           so that pack paths do not depend on the working directory <br/>
+ *           The archive is built with `make pack`
+ * @note     Pre-decoded pixel assets are handed to Gdiplus without copying, so
+ *           bitmaps created by `xPack` MUST NOT outlive `xPack::destruct()` & are read-only
+ */
+class xPack {
+
+    /// @class xPackException
+    /// @brief `xPackException` is used to report failing to mount/resolve pack assets
+    class xPackException : public xFile::xFileException {
+    public: xPackException(const std::string& dscrptn)
+        : xFileException(dscrptn) {
+            // ...
+        }
+    };
+
+    /**
+     * @class    xPackStream
+     * @brief    minimal read-only `IStream` over a block of (mapped) memory
+     * @details  Gdiplus decodes encoded assets (.png/.jpg/.gif/...) from an `IStream`,
+     *           `SHCreateMemStream` would copy the data, this stream does not
+     */
+    class xPackStream : public IStream {
+
+    public:
+
+        /// @brief     constructor ~ the stream starts with a reference count of 1
+        /// @param[in] data ~ first byte of the blob
+        /// @param[in] size ~ size (in bytes) of the blob
+        xPackStream(const unsigned char* data, ULONGLONG size)
+            : mData(data), mSize(size) {
+            // ...
+        }
+
+        // IUnknown ...
+
+        HRESULT STDMETHODCALLTYPE QueryInterface(REFIID riid, void** ppv) override {
+            if (!ppv) {
+                return E_POINTER;
+            }
+            if (riid == IID_IUnknown || riid == IID_ISequentialStream || riid == IID_IStream) {
+                *ppv = static_cast<IStream*>(this);
+                AddRef();
+                return S_OK;
+            }
+            *ppv = nullptr;
+            return E_NOINTERFACE;
+        }
+
+        ULONG STDMETHODCALLTYPE AddRef() override {
+            return InterlockedIncrement(&mRefs);
+        }
+
+        ULONG STDMETHODCALLTYPE Release() override {
+            LONG refs = InterlockedDecrement(&mRefs);
+            if (refs == 0) {
+                delete this;
+            }
+            return refs;
+        }
+
+        // ISequentialStream ...
+
+        HRESULT STDMETHODCALLTYPE Read(void* pv, ULONG cb, ULONG* pcbRead) override {
+            ULONGLONG left = (mPos < mSize) ? (mSize - mPos) : 0;
+            ULONG n = (cb < left) ? cb : static_cast<ULONG>(left);
+            if (n) {
+                memcpy(pv, mData + mPos, n);
+                mPos += n;
+            }
+            if (pcbRead) {
+                *pcbRead = n;
+            }
+            return (n == cb) ? S_OK : S_FALSE;
+        }
+
+        HRESULT STDMETHODCALLTYPE Write(const void*, ULONG, ULONG* pcbWritten) override {
+            if (pcbWritten) {
+                *pcbWritten = 0;
+            }
+            return STG_E_ACCESSDENIED; // read-only
+        }
+
+        // IStream ...
+
+        HRESULT STDMETHODCALLTYPE Seek(LARGE_INTEGER move, DWORD origin, ULARGE_INTEGER* pNewPos) override {
+            LONGLONG base = 0;
+            switch (origin) {
+                case STREAM_SEEK_SET: base = 0; break;
+                case STREAM_SEEK_CUR: base = static_cast<LONGLONG>(mPos); break;
+                case STREAM_SEEK_END: base = static_cast<LONGLONG>(mSize); break;
+                default: return STG_E_INVALIDFUNCTION;
+            }
+            LONGLONG pos = base + move.QuadPart;
+            if (pos < 0) {
+                return STG_E_INVALIDFUNCTION;
+            }
+            mPos = static_cast<ULONGLONG>(pos);
+            if (pNewPos) {
+                pNewPos->QuadPart = mPos;
+            }
+            return S_OK;
+        }
+
+        HRESULT STDMETHODCALLTYPE SetSize(ULARGE_INTEGER) override {
+            return STG_E_ACCESSDENIED; // read-only
+        }
+
+        HRESULT STDMETHODCALLTYPE CopyTo(IStream* pstm, ULARGE_INTEGER cb, ULARGE_INTEGER* pcbRead, ULARGE_INTEGER* pcbWritten) override {
+            ULONGLONG left = (mPos < mSize) ? (mSize - mPos) : 0;
+            ULONGLONG n = (cb.QuadPart < left) ? cb.QuadPart : left;
+            ULONG written = 0;
+            HRESULT hr = S_OK;
+            if (n) {
+                hr = pstm->Write(mData + mPos, static_cast<ULONG>(n), &written);
+                mPos += n;
+            }
+            if (pcbRead) {
+                pcbRead->QuadPart = n;
+            }
+            if (pcbWritten) {
+                pcbWritten->QuadPart = written;
+            }
+            return hr;
+        }
+
+        HRESULT STDMETHODCALLTYPE Commit(DWORD) override {
+            return S_OK; // nothing to commit ...
+        }
+
+        HRESULT STDMETHODCALLTYPE Revert() override {
+            return S_OK; // nothing to revert ...
+        }
+
+        HRESULT STDMETHODCALLTYPE LockRegion(ULARGE_INTEGER, ULARGE_INTEGER, DWORD) override {
+            return STG_E_INVALIDFUNCTION;
+        }
+
+        HRESULT STDMETHODCALLTYPE UnlockRegion(ULARGE_INTEGER, ULARGE_INTEGER, DWORD) override {
+            return STG_E_INVALIDFUNCTION;
+        }
+
+        HRESULT STDMETHODCALLTYPE Stat(STATSTG* pstatstg, DWORD) override {
+            if (!pstatstg) {
+                return STG_E_INVALIDPOINTER;
+            }
+            memset(pstatstg, 0, sizeof(STATSTG));
+            pstatstg->type = STGTY_STREAM;
+            pstatstg->cbSize.QuadPart = mSize;
+            pstatstg->grfMode = STGM_READ;
+            return S_OK;
+        }
+
+        HRESULT STDMETHODCALLTYPE Clone(IStream** ppstm) override {
+            if (!ppstm) {
+                return E_POINTER;
+            }
+            xPackStream* pClone = new xPackStream(mData, mSize);
+            pClone->mPos = mPos;
+            *ppstm = pClone;
+            return S_OK;
+        }
+
+    private:
+
+        /// @brief private destructor ~ use `Release()`
+        virtual ~xPackStream() = default;
+
+        /// @brief COM reference count
+        LONG mRefs = 1;
+        /// @brief first byte of the blob (not owned)
+        const unsigned char* mData;
+        /// @brief size (in bytes) of the blob
+        ULONGLONG mSize;
+        /// @brief current read position
+        ULONGLONG mPos = 0;
+    };
+
+public:
+
+    /// @brief  static method that retrieves the `xPack` singleton instance pointer
+    /// @return reference to `xPack` singleton instance pointer
+    static xPack& get() {
+        if (instance == nullptr) {
+            instance = new xPack();
+        }
+        return *instance;
+    }
+
+    /// @brief delete copy constructor
+    xPack(const xPack&) = delete;
+    /// @brief delete copy assignment operator
+    xPack& operator=(const xPack&) = delete;
+
+    /// @brief   method for destructing `xPack` singleton instance
+    /// @details unmaps every mounted archive, i.e. MUST be called
+    ///          after all images/bitmaps created from the archives are freed
+    static void destruct() {
+        delete instance; // destructor takes care of clean-up
+        instance = nullptr;
+    }
+
+private:
+
+    /// @brief private default constructor
+    xPack() = default;
+
+    /// @brief destructor ~ unmaps every mounted archive
+    ~xPack() {
+        LOG("releasing xPack resources ...");
+        for (AssetPack* pPack : packs) {
+            delete pPack;
+        }
+        packs.clear();
+    }
+
+    /// @brief `xPack` singleton instance pointer
+    static xPack* instance;
+
+    /// @brief mounted archives ~ searched last to first
+    std::vector<AssetPack*> packs;
+
+    /// @brief flag indicating whether the default archive was already searched for
+    bool searchedDefault = false;
+
+public:
+
+    /// @brief prefix identifying a pack path, i.e. "pack:src/png/cpp.png"
+    static const std::string PREFIX;
+
+    /// @brief  method to check whether a path refers to a pack asset
+    /// @param  path ~ image/icon path to check
+    /// @return `true` if the path starts with "pack:", otherwize `false`
+    static bool isPackPath(const std::string& path) {
+        return path.compare(0, PREFIX.size(), PREFIX) == 0;
+    }
+
+    /// @brief  method to memory-map an `.xpak` archive
+    /// @param  path ~ file path of the archive
+    /// @return `true` if the archive was mounted, otherwize `false`
+    /// @note   archives mounted later take precedence over earlier ones
+    bool mount(const std::string& path) {
+        AssetPack* pPack = new AssetPack();
+        try {
+            if (!pPack->open(path)) {
+                throw xPackException("cannot mount asset pack: " + path);
+            }
+        } catch (xPackException &ex) {
+            LOG(ex.what());
+            std::cerr << ex.what() << std::endl;
+            delete pPack;
+            return false;
+        }
+        packs.push_back(pPack);
+        LOG(("mounted " + path + " => " + std::to_string(pPack->count()) + " assets").c_str());
+        return true;
+    }
+
+    /// @brief  method to mount the default `assets.xpak` archive (if it exists)
+    /// @return `true` if an archive was mounted, otherwize `false`
+    bool mountDefault() {
+
+        searchedDefault = true;
+
+        // directory of the executable ...
+        char szFileName[MAX_PATH];
+        DWORD length = GetModuleFileNameA(NULL, szFileName, MAX_PATH);
+        std::string dir(szFileName, length);
+        std::string::size_type slash = dir.find_last_of("\\/");
+        dir = (slash == std::string::npos) ? "." : dir.substr(0, slash);
+
+        const std::string candidates[] = {
+            dir + "\\assets.xpak",             // distributed alongside main.exe
+            dir + "\\..\\..\\rsc\\assets.xpak", // bin/<mode>/main.exe => rsc/
+            "./rsc/assets.xpak"                // working directory is the project root
+        };
+
+        for (const std::string& candidate : candidates) {
+            if (GetFileAttributesA(candidate.c_str()) != INVALID_FILE_ATTRIBUTES) {
+                return mount(candidate);
+            }
+        }
+
+        return false;
+    }
+
+    /// @brief      method to resolve a pack path to its (mapped) blob
+    /// @param[in]  path ~ pack path, i.e. "pack:src/png/cpp.png"
+    /// @param[out] asset ~ receives the pointer/size/format of the blob if found
+    /// @return     `true` if the asset was found, otherwize `false`
+    bool find(const std::string& path, AssetPack::Asset& asset) {
+
+        if (packs.empty() && !searchedDefault) {
+            mountDefault();
+        }
+
+        std::string name = isPackPath(path) ? path.substr(PREFIX.size()) : path;
+
+        for (auto it = packs.rbegin(); it != packs.rend(); ++it) {
+            if ((*it)->find(name, asset)) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /// @brief  method to load a pack asset as a `Gdiplus::Bitmap`
+    /// @param  path ~ pack path of the asset
+    /// @return pointer to a `Gdiplus::Bitmap` or `nullptr` if not found/decodable
+    /// @remark client code to free the returned bitmap (before `xPack::destruct()`)
+    Gdiplus::Bitmap* loadBitmap(const std::string& path) {
+
+        xGDI::get();
+
+        AssetPack::Asset asset;
+        Gdiplus::Bitmap* pBitmap = nullptr;
+
+        try {
+
+            if (!find(path, asset)) {
+                throw xPackException("asset not found: " + path);
+            }
+
+            if (asset.format == AssetPack::FORMAT_BGRA32) {
+                // pre-decoded => wrap the mapped pixels as-is (zero-copy) ...
+                pBitmap = new Gdiplus::Bitmap(
+                    asset.width, asset.height, asset.width * 4,
+                    PixelFormat32bppARGB, const_cast<BYTE*>(asset.data)
+                );
+            } else {
+                // encoded => let Gdiplus decode straight from the mapped bytes ...
+                IStream* pStream = new xPackStream(asset.data, asset.size);
+                pBitmap = Gdiplus::Bitmap::FromStream(pStream);
+                pStream->Release(); // Gdiplus holds its own reference (if needed)
+            }
+
+            if (!pBitmap || pBitmap->GetLastStatus() != Gdiplus::Ok) {
+                throw xPackException("cannot decode asset: " + path);
+            }
+
+        } catch (xPackException &ex) {
+            LOG(ex.what());
+            std::cerr << ex.what() << std::endl;
+            delete pBitmap;
+            pBitmap = nullptr;
+        }
+
+        return pBitmap;
+    }
+
+    /// @brief  method to load a pack asset as a `Gdiplus::Image`
+    /// @param  path ~ pack path of the asset
+    /// @return pointer to a `Gdiplus::Image` or `nullptr` if not found/decodable
+    /// @remark client code to free the returned image (before `xPack::destruct()`)
+    /// @note   encoded assets keep their frames, i.e. .gif animation still works
+    Gdiplus::Image* loadImage(const std::string& path) {
+
+        xGDI::get();
+
+        AssetPack::Asset asset;
+        if (find(path, asset) && asset.format == AssetPack::FORMAT_RAW) {
+            IStream* pStream = new xPackStream(asset.data, asset.size);
+            Gdiplus::Image* pImage = new Gdiplus::Image(pStream);
+            pStream->Release();
+            return pImage; // caller checks `GetLastStatus()`
+        }
+
+        return loadBitmap(path);
+    }
+
+    /// @brief  method to create an icon from a pack asset (.ico/.png)
+    /// @param  path ~ pack path of the asset
+    /// @param  cx ~ desired icon width (pixels)
+    /// @param  cy ~ desired icon height (pixels)
+    /// @return handle of the icon or `NULL` if not found/decodable
+    /// @remark client code to `DestroyIcon(...)` the returned handle
+    HICON loadIcon(const std::string& path, int cx, int cy) {
+
+        if (!xFile::valid(path, "ico")) {
+            // anything else is decoded by Gdiplus ...
+            Gdiplus::Bitmap* pBitmap = loadBitmap(path);
+            HICON hIcon = NULL;
+            if (pBitmap) {
+                pBitmap->GetHICON(&hIcon);
+                delete pBitmap;
+            }
+            return hIcon;
+        }
+
+        AssetPack::Asset asset;
+        if (!find(path, asset) || asset.size < 6) {
+            return NULL;
+        }
+
+        // ICONDIR => reserved (2), type (2), count (2), then 16-byte ICONDIRENTRY's
+        const BYTE* p = asset.data;
+        UINT count = p[4] | (p[5] << 8);
+        if (p[2] != 1 || count == 0 || 6 + count * 16 > asset.size) {
+            return NULL;
+        }
+
+        // pick the closest image that is at least as large as requested,
+        // otherwize the largest one, preferring the higher color depth ...
+        int best = -1, bestSize = 0, bestBits = 0;
+        for (UINT i = 0; i < count; i++) {
+            const BYTE* e = p + 6 + i * 16;
+            int size = e[0] ? e[0] : 256;
+            int bits = e[6] | (e[7] << 8);
+            bool better = false;
+            if (best < 0) {
+                better = true;
+            } else if ((size >= cx) != (bestSize >= cx)) {
+                better = size >= cx;
+            } else if (size != bestSize) {
+                better = (size >= cx) ? (size < bestSize) : (size > bestSize);
+            } else {
+                better = bits > bestBits;
+            }
+            if (better) {
+                best = i;
+                bestSize = size;
+                bestBits = bits;
+            }
+        }
+
+        if (best < 0) {
+            return NULL;
+        }
+
+        const BYTE* e = p + 6 + best * 16;
+        DWORD bytes = e[8] | (e[9] << 8) | (e[10] << 16) | (static_cast<DWORD>(e[11]) << 24);
+        DWORD offset = e[12] | (e[13] << 8) | (e[14] << 16) | (static_cast<DWORD>(e[15]) << 24);
+        if (offset > asset.size || bytes > asset.size - offset) {
+            return NULL;
+        }
+
+        // the image data of an .ico entry is exactly an `RT_ICON` resource ...
+        return CreateIconFromResourceEx(
+            const_cast<PBYTE>(p + offset), bytes, TRUE, 0x00030000,
+            cx, cy, LR_DEFAULTCOLOR
+        );
+    }
+};
+
+/// @brief initialize `xPack` singleton instance pointer
+xPack* xPack::instance = nullptr;
+
+/// @brief pack path prefix
+const std::string xPack::PREFIX = "pack:";
+
+#endif // end xPACK_H
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
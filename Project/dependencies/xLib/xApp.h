@@ -34,6 +34,24 @@
 #include "../utils/type/type.h"
 #include "../utils/str/StrConverter.h"
 #include "../utils/ex/SystemException.h"
+#include "../utils/pack/AssetPack.h"
+#include "../utils/img/Resampler.h"
+#include "../utils/img/GifFrames.h"
+#include "../utils/str/StrTable.h"
+#include "../utils/str/StrArena.h"
+#include "../utils/str/CaseMap.h"
+#include "../utils/text/Utf.h"
+#include "../utils/text/TextMetrics.h"
+#include "../utils/text/GlyphAtlas.h"
+#include "../utils/text/PieceTable.h"
+#include "../utils/text/TextSearch.h"
+#include "../utils/file/LineIndex.h"
+#include "../utils/event/EventGate.h"
+#include "../utils/list/ItemIndex.h"
+#include "../utils/list/SelectionSet.h"
+#include "../utils/list/ItemModel.h"
+#include "../utils/list/PageQueue.h"
+#include "../utils/list/ColumnStore.h"
 
 // include macro for general MACRO's used in program script ...
 // #include "../utils/macro/macro.h" // CMD.h includes macro.h
@@ -47,6 +65,24 @@
 // include for graphics library Gdiplus
 #include "./global/xGDI.h"
 
+// include `xPack` for loading images & icons from `.xpak` asset archives
+#include "./utils/xPack.h"
+
+// include `xImageBudget` for accounting for the memory held by decoded images
+#include "./global/xImageBudget.h"
+
+// include `xTimer` for delivering debounced/throttled events on the UI thread
+#include "./global/xTimer.h"
+
+// include `xGlyphSource` for measuring & rendering text from cached font tables
+#include "./custom/xGlyphSource.h"
+
+// include `xFontCache` for sharing font handles between widgets
+#include "./global/xFontCache.h"
+
+// include `xRowCache` for blitting the rendered rows of owner-drawn lists
+#include "./global/xRowCache.h"
+
 // include for debugging
 #include "./utils/xMsg.h"
 // & error/exception handling ...
@@ -132,6 +168,10 @@ public:
         // destroy all resources held by `xWidgetManager`
         xWidgetManager::get().destruct();
 
+        // `xTimer` ...
+        // kill the timers of pending (deferred) events ...
+        xTimer::get().destruct();
+
         // `xGDI` shutdown ...
         // cleanup `xGDI` RAII resources ...
         // safe to destroy `xGDI` resources
@@ -145,12 +185,24 @@ public:
         // safe to destroy `xSystemFont` resources ...
         xSystemFont::get().destruct();
 
+        // `xFontCache` ...
+        // all widget fonts are released by now ...
+        xFontCache::get().destruct();
+
         // destroy all menu items ...
         xItemManager::get().destruct();
 
         // destroy all menu ...
         xMenuManager::get().destruct();
 
+        // `xImageBudget` ...
+        // all images are released by now ...
+        xImageBudget::get().destruct();
+
+        // `xPack` ...
+        // unmap asset archives, once all images are released ...
+        xPack::get().destruct();
+
         // ... 
 
         // more code here, if any ...
@@ -213,6 +265,7 @@ public:
         #endif // NDEBUG
         
         // initialize `xFont` singleton instance
+        // (collects the fonts in the background, see `xSystemFont`)
         xSystemFont::get().CollectSystemFonts();        
     }
 
@@ -358,6 +411,9 @@ xApp* xApp::instance = nullptr;
 // #include "./xListBox.h"
 #include "./xMultiSelectListBox.h" // includes `xListBox`
 
+// Table ...
+#include "./xTable.h"
+
 // implement the following button types ...
 
 // The below are NOT THE SAME AS
@@ -0,0 +1,125 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		AssetPackBench.cpp
+  * @brief 		Cold-start benchmark of the `.xpak` asset pack against loose files
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	Writes `count` assets (1-64 KB, like the icons & bitmaps under ./dependencies/img)
+  *           as loose files & as one pack, then times reading every asset both ways,
+  *           the page cache being dropped for the files first (`posix_fadvise`) <br/>
+  *           usage: AssetPackBench [--quick] [count]
+  */
+
+#include "./Test.h"
+#include "../dependencies/utils/pack/AssetPack.h"
+
+#include <fstream>
+#include <random>
+#include <vector>
+
+#include <sys/stat.h>
+
+namespace {
+
+  /// @brief helper function to read a whole file, the way the loose assets are loaded
+  std::size_t readFile(const std::string& path, std::vector<char>& buffer) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+      return 0;
+    }
+    buffer.resize(static_cast<std::size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(buffer.data(), buffer.size());
+    return buffer.size();
+  }
+}
+
+int main(int argc, char* argv[]) {
+
+  const bool quick = argc > 1 && std::string(argv[1]) == "--quick";
+  const std::size_t count = static_cast<std::size_t>(parseSize(argc > 1 + quick ? argv[1 + quick] : nullptr, quick ? 200 : 2000));
+  const int rounds = 5;
+
+  const std::string dir = scratchDir() + "/xpak-bench";
+  mkdir(dir.c_str(), 0755);
+
+  std::mt19937 random(26);
+  std::vector<std::string> names;
+  std::vector<char> bytes;
+  AssetPackBuilder builder;
+  std::size_t total = 0;
+  for (std::size_t i = 0; i < count; i++) {
+    names.push_back("img/asset" + std::to_string(i) + ".png");
+    bytes.resize(1024 + random() % (63 * 1024));
+    for (char& b : bytes) {
+      b = static_cast<char>(random());
+    }
+    const std::string path = dir + "/asset" + std::to_string(i) + ".png";
+    std::ofstream(path, std::ios::binary).write(bytes.data(), bytes.size());
+    builder.addData(names.back(), bytes.data(), bytes.size());
+    total += bytes.size();
+  }
+  const std::string packPath = dir + "/assets.xpak";
+  if (!builder.write(packPath)) {
+    std::fprintf(stderr, "cannot write %s\n", packPath.c_str());
+    return EXIT_FAILURE;
+  }
+
+  std::printf("%zu assets, %.1f MB\n", count, total / 1048576.0);
+
+  double looseCold = 0, packCold = 0, looseWarm = 0, packWarm = 0;
+  bool cold = true;
+  std::vector<char> buffer;
+  for (int round = 0; round < rounds; round++) {
+    for (int warm = 0; warm < 2; warm++) {
+
+      // loose files ~ one open & read per asset ...
+      if (!warm) {
+        for (std::size_t i = 0; i < count; i++) {
+          cold = dropCache(dir + "/asset" + std::to_string(i) + ".png") && cold;
+        }
+      }
+      std::size_t sum = 0;
+      Stopwatch loose;
+      for (std::size_t i = 0; i < count; i++) {
+        sum += readFile(dir + "/asset" + std::to_string(i) + ".png", buffer);
+        sum += static_cast<unsigned char>(buffer[buffer.size() / 2]);
+      }
+      (warm ? looseWarm : looseCold) += loose.ms();
+
+      // one pack ~ mapped once, every asset touched in place ...
+      if (!warm) {
+        cold = dropCache(packPath) && cold;
+      }
+      Stopwatch packed;
+      AssetPack pack;
+      pack.open(packPath);
+      for (std::size_t i = 0; i < count; i++) {
+        AssetPack::Asset asset;
+        if (pack.find(names[i], asset)) {
+          for (std::size_t b = 0; b < asset.size; b += 4096) {
+            sum += asset.data[b];
+          }
+        }
+      }
+      (warm ? packWarm : packCold) += packed.ms();
+
+      if (sum == 0) {
+        std::printf("(nothing read)\n");
+      }
+    }
+  }
+
+  std::printf("cold start%s: loose files %.2f ms, pack %.2f ms\n",
+    cold ? "" : " (page cache not dropped)", looseCold / rounds, packCold / rounds);
+  std::printf("warm start: loose files %.2f ms, pack %.2f ms\n", looseWarm / rounds, packWarm / rounds);
+
+  for (std::size_t i = 0; i < count; i++) {
+    std::remove((dir + "/asset" + std::to_string(i) + ".png").c_str());
+  }
+  std::remove(packPath.c_str());
+  rmdir(dir.c_str());
+  return EXIT_SUCCESS;
+}
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
@@ -0,0 +1,117 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		CaseMapBench.cpp
+  * @brief 		Throughput of the `xTextBox::transformCase(...)` case mapping (`CaseMap`)
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	Converts 64 MB of text to upper & lower case, ASCII text (the fast path) &
+  *           mixed text (accented Latin, Greek & Cyrillic words), as UTF-8 & as wide
+  *           text, against the former loop of `std::toupper`/`std::towupper` per
+  *           character (C locale, i.e. wrong past ASCII) <br/>
+  *           usage: CaseMapBench [--quick] [size]
+  */
+
+#include "./Test.h"
+#include "../dependencies/utils/str/CaseMap.h"
+#include "../dependencies/utils/text/Utf.h"
+
+#include <cctype>
+#include <cwctype>
+#include <random>
+
+namespace {
+
+  /// @brief helper function to generate `size` bytes of words (a `mixed` share of them non-ASCII)
+  std::string makeText(std::size_t size, bool mixed) {
+    static const char* const WORDS[] = { "déjà", "Straße", "ὀδυσσεύς", "привет", "ÉCOLE", "Ångström" };
+    std::mt19937 random(38);
+    std::string text;
+    text.reserve(size + 32);
+    while (text.size() < size) {
+      if (mixed && random() % 5 == 0) {
+        text += WORDS[random() % 6];
+      } else {
+        const std::size_t letters = 1 + random() % 9;
+        for (std::size_t k = 0; k < letters; k++) {
+          text.push_back(static_cast<char>((random() % 3 ? 'a' : 'A') + random() % 26));
+        }
+      }
+      text.push_back(random() % 12 ? ' ' : '\n');
+    }
+    return text;
+  }
+
+  /// @brief helper function to decode UTF-8 text as wide text
+  std::wstring widen(const std::string& text) {
+    std::wstring out;
+    out.reserve(text.size());
+    for (std::size_t i = 0; i < text.size(); ) {
+      Utf::append(out, Utf::next(text.data(), text.size(), i));
+    }
+    return out;
+  }
+
+  /// @brief helper function to report the throughput (MB/s) of `ms` for `bytes`
+  double rate(std::size_t bytes, double ms) {
+    return bytes / 1048576.0 / (ms / 1000);
+  }
+}
+
+int main(int argc, char* argv[]) {
+
+  const bool quick = argc > 1 && std::string(argv[1]) == "--quick";
+  const std::size_t size = static_cast<std::size_t>(parseSize(argc > 1 + quick ? argv[1 + quick] : nullptr, quick ? 8u << 20 : 64u << 20));
+
+  std::printf("%.0f MB (MB/s of UTF-8 input, upper | lower):\n", size / 1048576.0);
+  std::size_t checksum = 0;
+  for (int mixed = 0; mixed < 2; mixed++) {
+
+    const std::string text = makeText(size, mixed != 0);
+    const std::wstring wide = widen(text);
+    double ms[2][4];
+
+    for (int up = 0; up < 2; up++) {
+      // CaseMap ~ UTF-8 & wide ...
+      std::string s = text;
+      Stopwatch stopwatch;
+      up ? CaseMap::toUpper(s) : CaseMap::toLower(s);
+      ms[up][0] = stopwatch.ms();
+      checksum += s.size();
+
+      std::wstring w = wide;
+      stopwatch.restart();
+      up ? CaseMap::toUpper(w) : CaseMap::toLower(w);
+      ms[up][1] = stopwatch.ms();
+      checksum += w.size();
+
+      // ... against the character loops
+      s = text;
+      stopwatch.restart();
+      for (char& c : s) {
+        c = static_cast<char>(up ? std::toupper(static_cast<unsigned char>(c)) : std::tolower(static_cast<unsigned char>(c)));
+      }
+      ms[up][2] = stopwatch.ms();
+      checksum += s.size();
+
+      w = wide;
+      stopwatch.restart();
+      for (wchar_t& c : w) {
+        c = static_cast<wchar_t>(up ? std::towupper(static_cast<std::wint_t>(c)) : std::towlower(static_cast<std::wint_t>(c)));
+      }
+      ms[up][3] = stopwatch.ms();
+      checksum += w.size();
+    }
+
+    static const char* const NAMES[] = { "CaseMap UTF-8", "CaseMap wide", "std::toupper loop", "std::towupper loop" };
+    std::printf("  %s text:\n", mixed ? "mixed" : "ASCII");
+    for (int k = 0; k < 4; k++) {
+      std::printf("    %-20s %8.0f | %8.0f\n", NAMES[k], rate(text.size(), ms[1][k]), rate(text.size(), ms[0][k]));
+    }
+  }
+
+  if (checksum == 0) {
+    std::printf("(nothing converted)\n");
+  }
+  return 0;
+}
\ No newline at end of file
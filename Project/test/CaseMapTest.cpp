@@ -0,0 +1,133 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		CaseMapTest.cpp
+  * @brief 		Test of the `xTextBox::transformCase(...)` case mapping (`CaseMap`)
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	Checks non-ASCII mappings (Latin, Greek, Cyrillic, Armenian, titlecase
+  *           digraphs, length-changing UTF-8 mappings, supplementary planes), that UTF-8
+  *           & wide text map every codepoint alike, that the ASCII fast path agrees with
+  *           the codepoint path at every offset of its blocks, & malformed UTF-8
+  */
+
+#include "./Test.h"
+#include "../dependencies/utils/str/CaseMap.h"
+#include "../dependencies/utils/text/Utf.h"
+
+#include <random>
+#include <vector>
+
+namespace {
+
+  /// @brief helper function to convert UTF-8 text to uppercase
+  std::string upper(std::string s) { CaseMap::toUpper(s); return s; }
+  /// @brief helper function to convert UTF-8 text to lowercase
+  std::string lower(std::string s) { CaseMap::toLower(s); return s; }
+  /// @brief helper function to convert wide text to uppercase
+  std::wstring upper(std::wstring s) { CaseMap::toUpper(s); return s; }
+  /// @brief helper function to convert wide text to lowercase
+  std::wstring lower(std::wstring s) { CaseMap::toLower(s); return s; }
+
+  /// @brief helper function to map UTF-8 text codepoint by codepoint (reference)
+  std::string mapEach(const std::string& s, bool toUpper) {
+    std::string out;
+    for (std::size_t i = 0; i < s.size(); ) {
+      const std::size_t start = i;
+      const std::uint32_t cp = Utf::next(s.data(), s.size(), i);
+      if (cp == Utf::REPLACEMENT) {
+        out.append(s, start, i - start); // malformed => untouched
+      } else {
+        Utf::append(out, toUpper ? CaseMap::upper(cp) : CaseMap::lower(cp));
+      }
+    }
+    return out;
+  }
+}
+
+int main() {
+
+  // non-ASCII mappings ...
+  CHECK(upper(std::string("déjà vu")) == "DÉJÀ VU");
+  CHECK(lower(std::string("ÉCOLE ÅNGSTRÖM")) == "école ångström");
+  CHECK(upper(std::string("straße")) == "STRAßE");                // simple mapping, `ß` kept
+  CHECK(upper(std::string("ὀδυσσεύς")) == "ὈΔΥΣΣΕΎΣ");             // final sigma, polytonic
+  CHECK(lower(std::string("ΟΔΥΣΣΕΥΣ")) == "οδυσσευσ");
+  CHECK(upper(std::string("привет, мир")) == "ПРИВЕТ, МИР");
+  CHECK(lower(std::string("ԱՐԵՎ")) == "արեվ");
+  CHECK(upper(std::string("ǅ ǈ")) == "Ǆ Ǉ" && lower(std::string("ǅ ǈ")) == "ǆ ǉ"); // titlecase
+  CHECK(lower(std::string("\xE2\x84\xAA")) == "k");              // KELVIN SIGN
+  CHECK(lower(std::string("\xE2\x84\xA6")) == "\xCF\x89");       // OHM SIGN => omega
+  CHECK(CaseMap::upper(0x00FF) == 0x0178 && CaseMap::lower(0x0178) == 0x00FF);
+  CHECK(CaseMap::upper(0x10428) == 0x10400 && CaseMap::lower(0x1E900) == 0x1E922);
+  CHECK(CaseMap::upper(0x4E2D) == 0x4E2D && CaseMap::upper(0x1F600) == 0x1F600);
+
+  // ... UTF-8 mappings changing the length (`ı` -> `I`, `ſ` -> `S`, `ɐ` -> `Ɐ`)
+  CHECK(upper(std::string("ıstanbul ſ")) == "ISTANBUL S");
+  CHECK(upper(std::string("\xC9\x90 x")) == "\xE2\xB1\xAF X");
+  CHECK(lower(std::string("\xE2\xB1\xAF" "A\xC3\x89")) == "\xC9\x90" "a\xC3\xA9");
+  CHECK(lower(std::string("İİ")) == "ii");                        // simple mapping, no combining dot
+
+  // wide text ~ the same mappings, supplementary planes included
+  CHECK(upper(std::wstring(L"déjà ὀδυσσεύς привет")) == L"DÉJÀ ὈΔΥΣΣΕΎΣ ПРИВЕТ");
+  CHECK(upper(std::wstring(L"ıſ")) == L"IS");
+  std::wstring deseret;
+  Utf::append(deseret, 0x10428);
+  Utf::append(deseret, 'a');
+  std::wstring DESERET;
+  Utf::append(DESERET, 0x10400);
+  Utf::append(DESERET, 'A');
+  CHECK(upper(deseret) == DESERET && lower(DESERET) == deseret);
+
+  // every codepoint maps alike in UTF-8 & wide text, & round-trips where it should
+  int mismatches = 0;
+  int unstable = 0;
+  for (std::uint32_t cp = 0; cp <= Utf::MAX_CODEPOINT; cp++) {
+    if (cp >= 0xD800 && cp <= 0xDFFF) {
+      continue;
+    }
+    std::string narrow;
+    Utf::append(narrow, cp);
+    std::wstring wide;
+    Utf::append(wide, cp);
+    std::string u8;
+    Utf::append(u8, CaseMap::upper(cp));
+    std::wstring u16;
+    Utf::append(u16, CaseMap::upper(cp));
+    std::string l8;
+    Utf::append(l8, CaseMap::lower(cp));
+    if (upper(narrow) != u8 || upper(wide) != u16 || lower(narrow) != l8) {
+      mismatches++;
+    }
+    // an uppercase letter (mapped from its lowercase) maps back to a letter mapping to it
+    const std::uint32_t up = CaseMap::upper(cp);
+    if (up != cp && CaseMap::upper(CaseMap::lower(up)) != up) {
+      unstable++;
+    }
+  }
+  CHECK(mismatches == 0);
+  CHECK(unstable == 0);
+
+  // the ASCII blocks agree with the codepoint path at every offset & length
+  const char* const PIECES[] = { "a", "Z", "é", "Σ", "ı", "中", "🙂", " ", "q" };
+  std::mt19937 random(38);
+  int blockMismatches = 0;
+  for (int round = 0; round < 2000; round++) {
+    std::string text;
+    const std::size_t length = random() % 80;
+    while (text.size() < length) {
+      text += (random() % 4) ? PIECES[random() % 2 + 7 * (random() % 2)] : PIECES[random() % 9];
+    }
+    if (upper(text) != mapEach(text, true) || lower(text) != mapEach(text, false)) {
+      blockMismatches++;
+    }
+  }
+  CHECK(blockMismatches == 0);
+
+  // malformed sequences are left untouched
+  CHECK(upper(std::string("a\xC3" "b\xFF" "c\x80")) == "A\xC3" "B\xFF" "C\x80");
+  CHECK(upper(std::string("\xE4\xB8")) == "\xE4\xB8");
+  CHECK(upper(std::string()).empty() && upper(std::wstring()).empty());
+
+  return TEST_RESULT();
+}
\ No newline at end of file
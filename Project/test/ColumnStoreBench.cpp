@@ -0,0 +1,136 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		ColumnStoreBench.cpp
+  * @brief 		Scroll & sort benchmark of the `xTable` data (`ColumnStore`) at 10M rows
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	Fills a table of 10M rows (name, city, amount & reference columns), then
+  *           times what `xTable` does: filling the cells of a screen (`LVN_GETDISPINFO`)
+  *           anywhere in the sorted rows, & sorting by every column both ways, at 1 thread
+  *           & at every core, against `std::sort` of the permutation by `compare(...)` <br/>
+  *           Every sort is checked <br/>
+  *           usage: ColumnStoreBench [--quick] [rows]
+  */
+
+#include "./Test.h"
+#include "../dependencies/utils/list/ColumnStore.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <thread>
+
+namespace {
+
+  /// @brief number of rows of a screen
+  const std::size_t ROWS = 40;
+
+  /// @brief helper function to check the order of a permutation
+  /// @details the cells of a `NUMBER` column not parsed as numbers go last, both ways
+  bool sorted(const ColumnStore& store, std::size_t col, bool ascending, const std::vector<ColumnStore::row_type>& order) {
+    const bool numbers = store.type(col) == ColumnStore::NUMBER;
+    for (std::size_t i = 1; i < order.size(); i++) {
+      if (numbers && std::isnan(store.number(order[i - 1], col)) != std::isnan(store.number(order[i], col))) {
+        if (std::isnan(store.number(order[i - 1], col))) {
+          return false; // a number after the non-numbers
+        }
+        continue;
+      }
+      const int c = store.compare(col, order[i - 1], order[i]);
+      if (ascending ? c > 0 : c < 0) {
+        return false;
+      }
+    }
+    return order.size() == store.rows();
+  }
+}
+
+int main(int argc, char* argv[]) {
+
+  const bool quick = argc > 1 && std::string(argv[1]) == "--quick";
+  const std::size_t rows = static_cast<std::size_t>(parseSize(argc > 1 + quick ? argv[1 + quick] : nullptr, quick ? 1000000 : 10000000));
+  const unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+
+  static const char* const CITIES[] = {
+    "Amsterdam", "Berlin", "Buenos Aires", "Cairo", "Lagos", "Lima", "London", "Madrid",
+    "Mumbai", "Nairobi", "Oslo", "Paris", "Seoul", "Sydney", "Tokyo", "Toronto"
+  };
+
+  // populate ...
+  ColumnStore store;
+  store.addColumn("name");
+  store.addColumn("city");
+  store.addColumn("amount", ColumnStore::NUMBER);
+  store.addColumn("reference", ColumnStore::NUMBER);
+  std::mt19937 random(49);
+  std::vector<std::string> cells(4);
+  Stopwatch stopwatch;
+  store.reserve(rows, 12);
+  for (std::size_t i = 0; i < rows; i++) {
+    cells[0].clear();
+    const std::size_t letters = 4 + random() % 12;
+    for (std::size_t k = 0; k < letters; k++) {
+      cells[0].push_back(static_cast<char>((k == 0 ? 'A' : 'a') + random() % 26));
+    }
+    cells[1] = CITIES[random() % 16];
+    cells[2] = std::to_string(random() % 1000000 / 100.0);
+    cells[3] = (random() % 50) ? std::to_string(random()) : "n/a";
+    store.appendRow(cells);
+  }
+  std::printf("%zu rows populated in %.0f ms\n", rows, stopwatch.ms());
+
+  // sort ~ every column both ways, at 1 thread & every core ...
+  std::vector<ColumnStore::row_type> order;
+  std::printf("sort (ms, 1 thread | %u threads):\n", cores);
+  bool ok = true;
+  for (std::size_t col = 0; col < store.columns(); col++) {
+    for (int ascending = 1; ascending >= 0; ascending--) {
+      double ms[2];
+      for (int t = 0; t < 2; t++) {
+        ColumnStore::identity(order, rows);
+        stopwatch.restart();
+        store.sort(col, ascending != 0, order, t ? cores : 1);
+        ms[t] = stopwatch.ms();
+        ok = sorted(store, col, ascending != 0, order) && ok;
+      }
+      std::printf("  %-9s %-10s %8.0f | %8.0f\n", store.name(col).c_str(), ascending ? "ascending" : "descending", ms[0], ms[1]);
+    }
+  }
+
+  // ... against sorting the permutation by comparing the cells
+  const std::size_t NAME = 0;
+  ColumnStore::identity(order, rows);
+  stopwatch.restart();
+  std::sort(order.begin(), order.end(), [&store, NAME](ColumnStore::row_type a, ColumnStore::row_type b) {
+    return store.compare(NAME, a, b) < 0;
+  });
+  std::printf("  %-9s %-10s %8.0f (std::sort by compare)\n", "name", "ascending", stopwatch.ms());
+  ok = sorted(store, NAME, true, order) && ok;
+
+  // scroll ~ the cells of a screen, anywhere in the sorted rows (`fillCell(...)`)
+  const std::size_t screens = quick ? 20000 : 200000;
+  char buffer[260];
+  std::size_t copied = 0;
+  stopwatch.restart();
+  for (std::size_t s = 0; s < screens; s++) {
+    const std::size_t top = random() % (rows - ROWS);
+    for (std::size_t r = top; r < top + ROWS; r++) {
+      for (std::size_t col = 0; col < store.columns(); col++) {
+        const ColumnStore::row_type row = order[r];
+        const std::size_t length = std::min<std::size_t>(store.length(row, col), sizeof(buffer) - 1);
+        std::memcpy(buffer, store.text(row, col), length);
+        buffer[length] = '\0';
+        copied += length;
+      }
+    }
+  }
+  std::printf("scroll: %.2f us a screen (%zu x %zu cells)\n", stopwatch.us() / screens, ROWS, store.columns());
+
+  if (!ok || copied == 0) {
+    std::printf("(unsorted rows)\n");
+    return 1;
+  }
+  return 0;
+}
\ No newline at end of file
@@ -0,0 +1,240 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		GlyphAtlasTest.cpp
+  * @brief 		Golden-image test of the `GlyphAtlas` text renderer (headless font)
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	Every scene is drawn through the atlas & compared pixel by pixel with a
+  *           reference image composited straight from the `HeadlessGlyphRasterizer`
+  *           masks (scalar blending, no atlas), then with the checksum of the golden
+  *           image, so that any change of the rendered pixels is reported
+  */
+
+#include "./Test.h"
+#include "../dependencies/utils/text/GlyphAtlas.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+
+namespace {
+
+  /// @brief helper function to divide by 255, rounded
+  int div255(int x) {
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+  }
+
+  /// @brief helper function to blend one pixel (reference of `GlyphAtlas::blend(...)`)
+  void blendPixel(unsigned char* p, int coverage, std::uint32_t color) {
+    const int a = div255(coverage * static_cast<int>(color >> 24));
+    const int inv = 255 - a;
+    p[0] = static_cast<unsigned char>(std::min(255, div255(static_cast<int>(color & 0xFF) * a) + div255(p[0] * inv)));
+    p[1] = static_cast<unsigned char>(std::min(255, div255(static_cast<int>((color >> 8) & 0xFF) * a) + div255(p[1] * inv)));
+    p[2] = static_cast<unsigned char>(std::min(255, div255(static_cast<int>((color >> 16) & 0xFF) * a) + div255(p[2] * inv)));
+    p[3] = static_cast<unsigned char>(std::min(255, a + div255(p[3] * inv)));
+  }
+
+  /// @brief a BGRA image
+  struct Image {
+    int width;
+    int height;
+    std::vector<unsigned char> pixels;
+
+    Image(int w, int h, std::uint32_t background) : width(w), height(h), pixels(static_cast<std::size_t>(w) * h * 4) {
+      for (std::size_t i = 0; i < pixels.size(); i += 4) {
+        pixels[i + 0] = static_cast<unsigned char>(background);
+        pixels[i + 1] = static_cast<unsigned char>(background >> 8);
+        pixels[i + 2] = static_cast<unsigned char>(background >> 16);
+        pixels[i + 3] = static_cast<unsigned char>(background >> 24);
+      }
+    }
+
+    Resampler::Surface surface() {
+      return Resampler::Surface{ pixels.data(), width, height, width * 4 };
+    }
+
+    /// @brief 64-bit FNV-1a checksum of the pixels
+    std::uint64_t checksum() const {
+      std::uint64_t hash = 14695981039346656037ull;
+      for (unsigned char c : pixels) {
+        hash = (hash ^ c) * 1099511628211ull;
+      }
+      return hash;
+    }
+  };
+
+  /// @brief helper function to draw a line of codepoints without the atlas, returning the pen position
+  int reference(Image& image, int size, int x, int baseline, const std::u32string& text, std::uint32_t color, TextMetrics* metrics) {
+
+    HeadlessGlyphRasterizer rasterizer(size);
+    GlyphBitmap space;
+    rasterizer.rasterize(' ', space);
+
+    std::uint32_t prev = 0;
+    for (std::uint32_t cp : text) {
+      if (cp == '\r' || cp == '\n') {
+        prev = 0;
+        continue;
+      }
+      GlyphBitmap bitmap;
+      rasterizer.rasterize(cp, bitmap);
+
+      int advance = bitmap.advance;
+      if (metrics) {
+        x += prev ? metrics->kerning(prev, cp) : 0;
+        advance = (cp == '\t') ? TextMetrics::TAB_SIZE * metrics->advance(' ') : metrics->advance(cp);
+      } else if (cp == '\t') {
+        advance = TextMetrics::TAB_SIZE * space.advance;
+      }
+
+      for (int y = 0; y < bitmap.height; y++) {
+        for (int c = 0; c < bitmap.width; c++) {
+          const int px = x + bitmap.left + c;
+          const int py = baseline - bitmap.top + y;
+          const int coverage = bitmap.coverage[static_cast<std::size_t>(y) * bitmap.width + c];
+          if (px >= 0 && px < image.width && py >= 0 && py < image.height && coverage && (color >> 24)) {
+            blendPixel(&image.pixels[(static_cast<std::size_t>(py) * image.width + px) * 4], coverage, color);
+          }
+        }
+      }
+
+      x += advance;
+      prev = cp;
+    }
+    return x;
+  }
+
+  /// @brief helper function to widen ASCII text
+  std::u32string codepoints(const std::string& text) {
+    return std::u32string(text.begin(), text.end());
+  }
+
+  /// @brief a golden scene
+  struct Scene {
+    const char* text;      ///< ASCII text
+    int size;              ///< em size
+    int width;             ///< surface width
+    int height;            ///< surface height
+    int x;                 ///< pen position
+    int baseline;          ///< baseline
+    std::uint32_t background;  ///< premultiplied `0xAARRGGBB`
+    std::uint32_t color;   ///< `0xAARRGGBB`
+    bool kerned;           ///< laid out with `TextMetrics`
+    std::uint64_t golden;  ///< checksum of the expected image
+  };
+}
+
+int main() {
+
+  // golden scenes ~ opaque, translucent, kerned, tabs, clipped on every side ...
+  const Scene SCENES[] = {
+    { "Hello, World",       16, 128, 24,   2, 17, 0xFFFFFFFF, 0xFF000000, false, 0x212c915c6f141e9dull },
+    { "AVATAR To. Wave",    16, 160, 24,   0, 17, 0x00000000, 0x80FF2000, true,  0x88d631da53f3ec85ull },
+    { "\tA\tgjpqy",         12, 200, 20,   1, 12, 0xFF204060, 0xFFFFFF00, false, 0xf8c567d1ccfc1aa5ull },
+    { "clipped on all sides", 24, 64, 12, -9,  8, 0xFF808080, 0xC00000FF, true,  0xc1bb7e5708789db9ull },
+  };
+
+  for (const Scene& scene : SCENES) {
+
+    TextMetrics metrics(std::unique_ptr<GlyphSource>(new HeadlessGlyphSource(scene.size)));
+    GlyphAtlas atlas(std::unique_ptr<GlyphRasterizer>(new HeadlessGlyphRasterizer(scene.size)));
+    TextMetrics* pMetrics = scene.kerned ? &metrics : nullptr;
+
+    Image expected(scene.width, scene.height, scene.background);
+    const int expectedEnd = reference(expected, scene.size, scene.x, scene.baseline, codepoints(scene.text), scene.color, pMetrics);
+
+    // first draw (cache misses) & second draw (cache hits) render the same image
+    for (int pass = 0; pass < 2; pass++) {
+      Image actual(scene.width, scene.height, scene.background);
+      Resampler::Surface surface = actual.surface();
+      const int end = atlas.draw(surface, scene.x, scene.baseline, scene.text, scene.color, pMetrics);
+      CHECK(end == expectedEnd);
+      CHECK(actual.pixels == expected.pixels);
+      CHECK(actual.checksum() == scene.golden);
+    }
+    // ... without a surface, only the pen moves (as measured)
+    Resampler::Surface none = { nullptr, 0, 0, 0 };
+    if (scene.kerned) {
+      CHECK(atlas.draw(none, scene.x, scene.baseline, scene.text, scene.color, &metrics) == scene.x + metrics.width(scene.text));
+    }
+  }
+
+  // a tab first in a fresh atlas ~ the space is cached while the tab is drawn
+  for (int kerned = 0; kerned < 2; kerned++) {
+    TextMetrics metrics(std::unique_ptr<GlyphSource>(new HeadlessGlyphSource(16)));
+    GlyphAtlas atlas(std::unique_ptr<GlyphRasterizer>(new HeadlessGlyphRasterizer(16)));
+    Image expected(96, 20, 0xFFFFFFFF);
+    Image actual(96, 20, 0xFFFFFFFF);
+    Resampler::Surface surface = actual.surface();
+    const int end = atlas.draw(surface, 0, 15, std::string("\tA"), 0xFF000000, kerned ? &metrics : nullptr);
+    CHECK(end == reference(expected, 16, 0, 15, codepoints("\tA"), 0xFF000000, kerned ? &metrics : nullptr));
+    CHECK(actual.pixels == expected.pixels);
+  }
+
+  // UTF-8 & wide strings render the same ...
+  {
+    GlyphAtlas atlas(std::unique_ptr<GlyphRasterizer>(new HeadlessGlyphRasterizer(16)));
+    const std::u32string text = U"Gr\u00FC\u00DFe \u4E2D\u6587 \u03A9";
+    Image expected(200, 24, 0x00000000);
+    Image narrow(200, 24, 0x00000000);
+    Image wide(200, 24, 0x00000000);
+    Resampler::Surface narrowSurface = narrow.surface();
+    Resampler::Surface wideSurface = wide.surface();
+    const int end = reference(expected, 16, 3, 17, text, 0xFF102030, nullptr);
+    CHECK(atlas.draw(narrowSurface, 3, 17, std::string(u8"Gr\u00FC\u00DFe \u4E2D\u6587 \u03A9"), 0xFF102030) == end);
+    CHECK(atlas.draw(wideSurface, 3, 17, std::wstring(L"Gr\u00FC\u00DFe \u4E2D\u6587 \u03A9"), 0xFF102030) == end);
+    CHECK(narrow.pixels == expected.pixels);
+    CHECK(wide.pixels == expected.pixels);
+    // ... & every glyph was rasterized once
+    CHECK(atlas.rasterized() == atlas.glyphCount());
+    CHECK(atlas.glyphCount() == 9);
+  }
+
+  // large glyphs spill over several pages
+  {
+    const int size = 200;
+    const std::string text = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+    GlyphAtlas atlas(std::unique_ptr<GlyphRasterizer>(new HeadlessGlyphRasterizer(size)));
+    Image expected(4000, 240, 0xFFFFFFFF);
+    Image actual(4000, 240, 0xFFFFFFFF);
+    Resampler::Surface surface = actual.surface();
+    CHECK(atlas.draw(surface, 0, 200, text, 0xFF000000) == reference(expected, size, 0, 200, codepoints(text), 0xFF000000, nullptr));
+    CHECK(atlas.pageCount() > 1);
+    CHECK(actual.pixels == expected.pixels);
+  }
+
+  // `blend(...)` matches the scalar reference, whatever the length & alignment
+  {
+    std::mt19937 random(33);
+    for (int iteration = 0; iteration < 2000; iteration++) {
+      const int count = static_cast<int>(random() % 37);
+      const std::uint32_t color = static_cast<std::uint32_t>(random());
+      std::vector<unsigned char> coverage(static_cast<std::size_t>(count) + 1);
+      std::vector<unsigned char> actual(4 * (static_cast<std::size_t>(count) + 1));
+      for (unsigned char& c : coverage) {
+        const unsigned r = random() % 4;
+        c = static_cast<unsigned char>(r == 0 ? 0 : r == 1 ? 255 : random());
+      }
+      for (std::size_t i = 0; i < actual.size(); i += 4) {
+        // premultiplied destination ~ color channels never exceed alpha
+        actual[i + 3] = static_cast<unsigned char>(random());
+        for (int k = 0; k < 3; k++) {
+          actual[i + k] = static_cast<unsigned char>(actual[i + 3] ? random() % (actual[i + 3] + 1u) : 0);
+        }
+      }
+      std::vector<unsigned char> expected = actual;
+      const int offset = iteration % 2; // unaligned rows
+      GlyphAtlas::blend(actual.data() + 4 * offset, coverage.data() + offset, count - offset < 0 ? 0 : count - offset, color);
+      for (int i = offset; i < count; i++) {
+        if (coverage[i]) {
+          blendPixel(&expected[4 * static_cast<std::size_t>(i)], coverage[i], color);
+        }
+      }
+      CHECK(actual == expected);
+    }
+  }
+
+  return TEST_RESULT();
+}
\ No newline at end of file
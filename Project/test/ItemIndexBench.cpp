@@ -0,0 +1,107 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		ItemIndexBench.cpp
+  * @brief 		Lookup & insert benchmark of the list item index (`ItemIndex`) at 1M items
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	Times what `xListBox` & `xDropDown` do with their items: `getIndex(...)`,
+  *           `checkItem(...)` & `select(...)` (`find(...)`), reading a row (`at(...)`),
+  *           against the former linear scan of `itemsList`, then prepending & inserting
+  *           items mid-list (`add(item, index)`) & removing them (`remove(...)`) <br/>
+  *           Every position is checked <br/>
+  *           usage: ItemIndexBench [--quick] [items]
+  */
+
+#include "./Test.h"
+#include "../dependencies/utils/list/ItemIndex.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+
+  const bool quick = argc > 1 && std::string(argv[1]) == "--quick";
+  const std::size_t count = static_cast<std::size_t>(parseSize(argc > 1 + quick ? argv[1 + quick] : nullptr, quick ? 100000 : 1000000));
+  const std::size_t inserts = quick ? 10000 : 100000;
+
+  std::vector<std::string> items;
+  items.reserve(count);
+  for (std::size_t i = 0; i < count; i++) {
+    items.push_back("customer #" + std::to_string(i * 7919 % 1000003) + " ~ " + std::to_string(i));
+  }
+
+  // index ~ `add(vector)` ...
+  ItemIndex index;
+  Stopwatch stopwatch;
+  index.assign(items);
+  std::printf("%zu items indexed in %.0f ms\n", count, stopwatch.ms());
+
+  // ... lookups, hits & misses, against a linear scan
+  std::mt19937 random(42);
+  const std::size_t lookups = quick ? 100000 : 1000000;
+  std::size_t found = 0;
+  bool ok = index.size() == count;
+  stopwatch.restart();
+  for (std::size_t l = 0; l < lookups; l++) {
+    const std::size_t i = random() % count;
+    found += index.find(items[i]) == i;
+  }
+  const double findNs = stopwatch.us() * 1000 / lookups;
+  stopwatch.restart();
+  for (std::size_t l = 0; l < lookups; l++) {
+    found += index.find("missing #" + std::to_string(l)) == ItemIndex::npos;
+  }
+  const double missNs = stopwatch.us() * 1000 / lookups;
+  stopwatch.restart();
+  for (std::size_t l = 0; l < lookups; l++) {
+    const std::size_t i = random() % count;
+    found += &index.at(i) != nullptr && index.at(i).size() == items[i].size();
+  }
+  const double atNs = stopwatch.us() * 1000 / lookups;
+  ok = found == 3 * lookups && ok;
+
+  const std::size_t scans = quick ? 20 : 50;
+  stopwatch.restart();
+  for (std::size_t l = 0; l < scans; l++) {
+    const std::size_t i = random() % count;
+    found += static_cast<std::size_t>(std::find(items.begin(), items.end(), items[i]) - items.begin()) == i;
+  }
+  const double scanNs = stopwatch.us() * 1000 / scans;
+  ok = found == 3 * lookups + scans && ok;
+  std::printf("lookup (ns): find %.0f, miss %.0f, at %.0f | linear scan %.0f\n", findNs, missNs, atNs, scanNs);
+
+  // inserts ~ prepends, then mid-list inserts, then removals of both
+  stopwatch.restart();
+  for (std::size_t i = 0; i < inserts; i++) {
+    index.insert(0, "prepended #" + std::to_string(i));
+  }
+  const double prependUs = stopwatch.us() / inserts;
+  stopwatch.restart();
+  for (std::size_t i = 0; i < inserts; i++) {
+    index.insert(index.size() / 2, "middle #" + std::to_string(i));
+  }
+  const double middleUs = stopwatch.us() / inserts;
+  ok = index.size() == count + 2 * inserts && ok;
+  ok = index.find("prepended #0") == inserts - 1 && index.find(items[0]) == inserts && ok;
+  ok = index.at(0) == "prepended #" + std::to_string(inserts - 1) && ok;
+  ok = index.find("middle #" + std::to_string(inserts - 1)) == (count + 2 * inserts - 1) / 2 && ok;
+
+  stopwatch.restart();
+  for (std::size_t i = 0; i < inserts; i++) {
+    ok = index.erase("middle #" + std::to_string(i)) != ItemIndex::npos && ok;
+    ok = index.erase("prepended #" + std::to_string(i)) != ItemIndex::npos && ok;
+  }
+  const double eraseUs = stopwatch.us() / (2 * inserts);
+  for (std::size_t i = 0; i < count; i += count / 100) {
+    ok = index.find(items[i]) == i && index.at(i) == items[i] && ok;
+  }
+  std::printf("%zu x insert (us): prepend %.2f, middle %.2f | erase %.2f\n", inserts, prependUs, middleUs, eraseUs);
+
+  if (!ok) {
+    std::printf("(wrong positions)\n");
+    return 1;
+  }
+  return 0;
+}
\ No newline at end of file
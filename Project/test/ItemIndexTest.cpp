@@ -0,0 +1,93 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		ItemIndexTest.cpp
+  * @brief 		Test of the `ItemIndex` positions under random inserts & removals
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	Replays inserts (front, middle, end), removals (by item & by position) &
+  *           re-assignments against a plain vector, checking every position after each
+  */
+
+#include "./Test.h"
+#include "../dependencies/utils/list/ItemIndex.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace {
+
+  /// @brief helper function to check the index against the list, item by item
+  bool same(const ItemIndex& index, const std::vector<std::string>& list) {
+    if (index.size() != list.size()) {
+      return false;
+    }
+    for (std::size_t i = 0; i < list.size(); i++) {
+      if (index.at(i) != list[i] || index.find(list[i]) != i) {
+        return false;
+      }
+    }
+    return true;
+  }
+}
+
+int main() {
+
+  // assigned ~ first appearance order, repeated items once ...
+  ItemIndex index;
+  CHECK(index.size() == 0 && index.find("a") == ItemIndex::npos);
+  index.assign({ "b", "a", "c", "a", "b", "d" });
+  CHECK(same(index, { "b", "a", "c", "d" }));
+  CHECK(!index.push_back("c") && index.size() == 4);
+
+  // ... inserted & removed anywhere
+  CHECK(index.insert(0, "z") && index.insert(2, "y") && index.insert(99, "x"));
+  CHECK(same(index, { "z", "b", "y", "a", "c", "d", "x" }));
+  CHECK(index.erase("y") == 2 && index.erase("y") == ItemIndex::npos);
+  index.eraseAt(0);
+  CHECK(same(index, { "b", "a", "c", "d", "x" }));
+  index.clear();
+  CHECK(index.size() == 0 && !index.contains("b"));
+
+  // random edits against a vector ~ prepends, middle inserts, appends & removals
+  std::mt19937 random(42);
+  std::vector<std::string> list;
+  int mismatches = 0;
+  for (int round = 0; round < 4; round++) {
+    for (int step = 0; step < 3000; step++) {
+      const unsigned action = random() % 10;
+      if (action < 6 || list.empty()) {
+        const std::string item = "item " + std::to_string(random() % 5000);
+        const std::size_t pos = (action == 0) ? 0 : random() % (list.size() + 1);
+        const bool listed = std::find(list.begin(), list.end(), item) != list.end();
+        if (index.insert(pos, item) == listed) {
+          mismatches++;
+        }
+        if (!listed) {
+          list.insert(list.begin() + pos, item);
+        }
+      } else if (action < 8) {
+        const std::size_t pos = random() % list.size();
+        if (index.erase(list[pos]) != pos) {
+          mismatches++;
+        }
+        list.erase(list.begin() + pos);
+      } else {
+        const std::size_t pos = random() % list.size();
+        index.eraseAt(pos);
+        list.erase(list.begin() + pos);
+      }
+      if (step % 100 == 0 && !same(index, list)) {
+        mismatches++;
+      }
+    }
+    CHECK(same(index, list));
+    // re-assigned, the freed nodes reused by the next round
+    index.assign(list);
+    CHECK(same(index, list));
+  }
+  CHECK(mismatches == 0);
+
+  return TEST_RESULT();
+}
\ No newline at end of file
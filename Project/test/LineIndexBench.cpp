@@ -0,0 +1,152 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		LineIndexBench.cpp
+  * @brief 		Open & scroll benchmark of the file view (`MappedFile` & `LineIndex`)
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	Writes a log-like file of `size` bytes (2 GB by default), then times what
+  *           `xMultiLineTextBox::openFile(...)` & `renderView()` do: mapping the file
+  *           (page cache dropped first), the first screen of lines, the whole index,
+  *           & rendering a screen of lines while paging & jumping through the file <br/>
+  *           usage: LineIndexBench [--quick] [size]
+  */
+
+#include "./Test.h"
+#include "../dependencies/utils/file/LineIndex.h"
+#include "../dependencies/utils/file/MappedFile.h"
+
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+
+  /// @brief number of lines of a screen
+  const std::size_t ROWS = 60;
+
+  /// @brief helper function to write `size` bytes of log lines (20 ~ 200 bytes each)
+  bool writeLog(const std::string& path, std::size_t size) {
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+      return false;
+    }
+    std::mt19937 random(36);
+    std::vector<char> block(1 << 20);
+    std::size_t written = 0;
+    std::size_t line = 0;
+    while (written < size) {
+      std::size_t used = 0;
+      while (used + 256 < block.size()) {
+        used += static_cast<std::size_t>(std::snprintf(&block[used], 64, "2026-10-18 12:00:00.%06zu INFO ", line++ % 1000000));
+        const std::size_t words = random() % 24;
+        for (std::size_t w = 0; w < words; w++) {
+          block[used++] = static_cast<char>('a' + random() % 26);
+          block[used++] = (random() % 5) ? static_cast<char>('a' + random() % 26) : ' ';
+          block[used++] = ' ';
+        }
+        block[used++] = '\n';
+      }
+      used = std::min(used, size - written);
+      if (std::fwrite(block.data(), 1, used, file) != used) {
+        std::fclose(file);
+        return false;
+      }
+      written += used;
+    }
+    return std::fclose(file) == 0;
+  }
+
+  /// @brief helper function to render a screen of lines (see `renderView()`), returning its length
+  std::size_t render(const MappedFile& file, const LineIndex& index, std::size_t top, std::string& text) {
+    text.clear();
+    const std::size_t count = index.lineCount();
+    for (std::size_t i = top; i < count && i < top + ROWS; i++) {
+      if (i > top) {
+        text += "\r\n";
+      }
+      text.append(reinterpret_cast<const char*>(file.data()) + index.lineStart(i), index.lineEnd(i) - index.lineStart(i));
+    }
+    return text.size();
+  }
+}
+
+int main(int argc, char* argv[]) {
+
+  const bool quick = argc > 1 && std::string(argv[1]) == "--quick";
+  const std::size_t size = static_cast<std::size_t>(parseSize(argc > 1 + quick ? argv[1 + quick] : nullptr, quick ? 256ull << 20 : 2ull << 30));
+  const std::string path = scratchDir() + "/lineindex-bench.log";
+
+  Stopwatch stopwatch;
+  if (!writeLog(path, size)) {
+    std::fprintf(stderr, "cannot write %s\n", path.c_str());
+    std::remove(path.c_str());
+    return 1;
+  }
+  std::printf("%.2f GB log written in %.1f s\n", size / 1073741824.0, stopwatch.ms() / 1000);
+  const bool cold = dropCache(path);
+
+  // open ~ map the file & start indexing ...
+  MappedFile file;
+  LineIndex index;
+  stopwatch.restart();
+  if (!file.open(path)) {
+    std::fprintf(stderr, "cannot map %s\n", path.c_str());
+    std::remove(path.c_str());
+    return 1;
+  }
+  const double mapMs = stopwatch.ms();
+  index.build(file.data(), file.size());
+
+  // ... the first screen is shown once its lines are indexed
+  while (index.lineCount() < ROWS && !index.done()) {
+    std::this_thread::yield();
+  }
+  std::string text;
+  render(file, index, 0, text);
+  const double firstScreenMs = stopwatch.ms();
+
+  index.wait();
+  const double indexMs = stopwatch.ms();
+  const std::size_t lines = index.lineCount();
+
+  std::printf("open%s: map %.3f ms, first screen %.2f ms, whole index %.0f ms (%.2f GB/s)\n",
+    cold ? " (cold)" : "", mapMs, firstScreenMs, indexMs, size / 1073741824.0 / (indexMs / 1000));
+  std::printf("index: %zu lines, %.1f MB\n", lines, lines * sizeof(std::uint64_t) / 1048576.0);
+
+  // scroll ~ page down from the top (warm pages), then jump anywhere (cold pages)
+  const std::size_t pages = quick ? 2000 : 20000;
+  std::size_t bytes = 0;
+  stopwatch.restart();
+  for (std::size_t p = 0; p < pages; p++) {
+    bytes += render(file, index, (p * ROWS) % lines, text);
+  }
+  const double pageUs = stopwatch.us() / pages;
+
+  // mapped pages stay cached => unmapped while dropped (the index is complete)
+  file.close();
+  const bool coldJumps = dropCache(path) && file.open(path);
+  if (!file.isOpen()) {
+    std::fprintf(stderr, "cannot map %s\n", path.c_str());
+    std::remove(path.c_str());
+    return 1;
+  }
+  std::mt19937 random(36);
+  const std::size_t jumps = quick ? 200 : 2000;
+  stopwatch.restart();
+  for (std::size_t j = 0; j < jumps; j++) {
+    bytes += render(file, index, static_cast<std::size_t>(random() % lines), text);
+  }
+  const double jumpUs = stopwatch.us() / jumps;
+
+  std::printf("scroll (%zu lines a screen): page down %.2f us, jump%s %.2f us\n",
+    ROWS, pageUs, coldJumps ? " (cold)" : "", jumpUs);
+  if (bytes == 0) {
+    std::printf("(nothing rendered)\n");
+  }
+
+  file.close();
+  std::remove(path.c_str());
+  return 0;
+}
\ No newline at end of file
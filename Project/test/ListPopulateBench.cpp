@@ -0,0 +1,211 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		ListPopulateBench.cpp
+  * @brief 		Populate time & memory of the `xListBox` row storages at 1M & 10M rows
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	Compares, for the host-side data of a list:
+  *           - the items mode (`itemsList` & the copy kept per `LB_INSERTSTRING`)
+  *           - the contiguous arena (`StrArena`)
+  *           - the virtual mode (`setVirtual(...)`), rows formatted on demand with the
+  *             selection in the model (`SelectionSet`), i.e. `LB_SETCOUNT` only
+  *           - rows streamed by a producer thread (`PageQueue`) into an arena <br/>
+  *           Memory is the heap in use (glibc) once populated <br/>
+  *           Then times the bulk `add(vector)` of 100k items (10% repeated): deduplicated
+  *           through `ItemIndex` into the arena, against the former `add(item)` loop
+  *           (`checkItem(...)` scan & a copy per `LB_INSERTSTRING`) <br/>
+  *           usage: ListPopulateBench [--quick]
+  */
+
+#include "./Test.h"
+#include "../dependencies/utils/list/ItemIndex.h"
+#include "../dependencies/utils/list/PageQueue.h"
+#include "../dependencies/utils/list/SelectionSet.h"
+#include "../dependencies/utils/str/StrArena.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace {
+
+  /// @brief number of rows of a screen
+  const std::size_t ROWS = 40;
+
+  /// @brief helper function to format the text of a row
+  std::string rowText(std::size_t row) {
+    return "customer #" + std::to_string(row) + " ~ order " + std::to_string(row * 7919 % 1000003);
+  }
+
+  /// @brief helper function to report a storage (`screenUs < 0` if not measured)
+  void report(const char* name, double populateMs, double screenUs, std::size_t before) {
+    const std::size_t after = heapBytes();
+    std::printf("    %-28s populate %9.1f ms", name, populateMs);
+    if (screenUs >= 0) {
+      std::printf(", screen %7.2f us", screenUs);
+    }
+    if (after) {
+      std::printf(", memory %8.1f MB", (after > before ? after - before : 0) / 1048576.0);
+    }
+    std::printf("\n");
+  }
+}
+
+int main(int argc, char* argv[]) {
+
+  const bool quick = argc > 1 && std::string(argv[1]) == "--quick";
+  const std::size_t COUNTS[] = { 1000000, 10000000 };
+
+  for (std::size_t rows : COUNTS) {
+
+    if (quick) {
+      rows /= 10;
+    }
+    std::printf("%zu rows:\n", rows);
+    std::size_t checksum = 0;
+
+    // items ~ the strings of the caller & the copy of the control ...
+    {
+      const std::size_t before = heapBytes();
+      Stopwatch stopwatch;
+      std::vector<std::string> items;
+      std::vector<std::string> control;
+      for (std::size_t i = 0; i < rows; i++) {
+        items.push_back(rowText(i));
+        control.push_back(items.back()); // `LB_INSERTSTRING`
+      }
+      const double populateMs = stopwatch.ms();
+      stopwatch.restart();
+      for (std::size_t i = 0; i < ROWS; i++) {
+        checksum += control[rows / 2 + i].size();
+      }
+      report("items (LB_INSERTSTRING)", populateMs, stopwatch.us(), before);
+    }
+
+    // ... arena ~ one contiguous copy
+    {
+      const std::size_t before = heapBytes();
+      Stopwatch stopwatch;
+      StrArena arena;
+      arena.reserve(rows, rows * 32);
+      for (std::size_t i = 0; i < rows; i++) {
+        arena.push_back(rowText(i));
+      }
+      const double populateMs = stopwatch.ms();
+      stopwatch.restart();
+      for (std::size_t i = 0; i < ROWS; i++) {
+        checksum += arena.length(rows / 2 + i);
+      }
+      report("arena (StrArena)", populateMs, stopwatch.us(), before);
+    }
+
+    // ... virtual ~ only the selection is stored, visible rows are formatted when drawn
+    {
+      const std::size_t before = heapBytes();
+      Stopwatch stopwatch;
+      SelectionSet selection(rows); // `LB_SETCOUNT`
+      const double populateMs = stopwatch.ms();
+      selection.insert(rows / 2 + 1);
+      stopwatch.restart();
+      for (std::size_t i = 0; i < ROWS; i++) {
+        checksum += rowText(rows / 2 + i).size() + selection.contains(rows / 2 + i);
+      }
+      report("virtual (LBS_NODATA)", populateMs, stopwatch.us(), before);
+    }
+
+    // ... streamed ~ the first page is shown while the producer fills the rest
+    {
+      const std::size_t before = heapBytes();
+      Stopwatch stopwatch;
+      StrArena arena;
+      std::size_t produced = 0;
+      PageQueue queue(4096, 4);
+      queue.start([&produced, rows](PageQueue::page_type& page, std::size_t size) {
+        for (; page.size() < size && produced < rows; produced++) {
+          page.push_back(rowText(produced));
+        }
+        return produced < rows;
+      }, nullptr);
+      double firstMs = 0;
+      PageQueue::page_type page;
+      while (!queue.finished()) {
+        queue.request(4);
+        if (!queue.pop(page)) {
+          std::this_thread::yield();
+          continue;
+        }
+        for (const std::string& row : page) {
+          arena.push_back(row);
+        }
+        if (firstMs == 0) {
+          firstMs = stopwatch.ms();
+        }
+      }
+      const double populateMs = stopwatch.ms();
+      queue.cancel();
+      report("streamed (PageQueue)", populateMs, -1, before);
+      std::printf("    %-28s first page %7.3f ms\n", "", firstMs);
+      checksum += arena.size();
+    }
+
+    if (checksum == 0) {
+      std::printf("(nothing read)\n");
+    }
+  }
+
+  // bulk add ~ the items of a batch, some repeated (`add(vector)`) ...
+  const std::size_t BULK = 100000;
+  std::vector<std::string> batch;
+  batch.reserve(BULK);
+  for (std::size_t i = 0; i < BULK; i++) {
+    batch.push_back(rowText(i % 10 == 9 ? i - 1 : i)); // repeats the previous item
+  }
+  std::printf("bulk add of %zu items:\n", BULK);
+
+  // ... deduplicated by the index, appended to the arena, sent in one batch
+  Stopwatch stopwatch;
+  ItemIndex index;
+  StrArena arena;
+  arena.reserve(batch.size());
+  for (const std::string& item : batch) {
+    if (index.push_back(item)) {
+      arena.push_back(item);
+    }
+  }
+  const double dedupMs = stopwatch.ms();
+  std::size_t bytes = 0;
+  for (std::size_t i = 0; i < arena.size(); i++) {
+    bytes += arena.length(i) + 1; // `LB_INITSTORAGE`
+  }
+  std::vector<std::string> control;
+  control.reserve(arena.size());
+  for (std::size_t i = 0; i < arena.size(); i++) {
+    control.emplace_back(arena.c_str(i), arena.length(i)); // `LB_INSERTSTRING`
+  }
+  const double bulkMs = stopwatch.ms();
+  std::printf("    %-28s %9.1f ms (dedup & arena %.1f ms), %zu items, %zu bytes\n",
+    "index & arena (add(vector))", bulkMs, dedupMs, arena.size(), bytes);
+
+  // ... against the former loop of `add(item)`, quadratic => timed on a prefix
+  const std::size_t prefix = quick ? 5000 : 20000;
+  stopwatch.restart();
+  std::vector<std::string> items;
+  std::vector<std::string> former;
+  for (std::size_t i = 0; i < prefix; i++) {
+    if (std::find(items.begin(), items.end(), batch[i]) == items.end()) { // `checkItem(...)`
+      items.push_back(batch[i]);
+      former.push_back(batch[i]); // `LB_INSERTSTRING`
+    }
+  }
+  const double loopMs = stopwatch.ms();
+  std::printf("    %-28s %9.1f ms for the first %zu items (%.1f us/item, growing linearly)\n",
+    "add(item) loop", loopMs, prefix, loopMs * 1000 / prefix);
+
+  const bool deduped = arena.size() == BULK - BULK / 10 && former.size() == prefix - prefix / 10;
+  if (!deduped || control.size() != arena.size()) {
+    std::printf("(wrong items)\n");
+    return 1;
+  }
+  return 0;
+}
\ No newline at end of file
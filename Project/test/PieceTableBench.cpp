@@ -0,0 +1,97 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		PieceTableBench.cpp
+  * @brief 		Per-keystroke benchmark of the `xTextBox` text model (`PieceTable`)
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	Replays typing in 1, 10 & 100 MB of text the way `xTextBox::pullText()`
+  *           applies it (one `replace(...)` per `EN_CHANGE`, then a snapshot for the
+  *           delta listeners), against copying the whole control text per keystroke
+  *           (the former `GetWindowText(...)` model) <br/>
+  *           usage: PieceTableBench [--quick]
+  */
+
+#include "./Test.h"
+#include "../dependencies/utils/text/PieceTable.h"
+
+#include <random>
+#include <vector>
+
+namespace {
+
+  /// @brief helper function to generate `size` bytes of text (words & lines)
+  std::string makeText(std::size_t size, std::mt19937& random) {
+    std::string text;
+    text.reserve(size);
+    while (text.size() < size) {
+      const std::size_t word = 1 + random() % 9;
+      for (std::size_t i = 0; i < word && text.size() < size; i++) {
+        text.push_back(static_cast<char>('a' + random() % 26));
+      }
+      if (text.size() < size) {
+        text.push_back(random() % 12 ? ' ' : '\n');
+      }
+    }
+    return text;
+  }
+}
+
+int main(int argc, char* argv[]) {
+
+  const bool quick = argc > 1 && std::string(argv[1]) == "--quick";
+  const std::size_t MB = 1 << 20;
+  const std::size_t SIZES[] = { 1 * MB, 10 * MB, 100 * MB };
+
+  std::printf("per keystroke (typing, backspace & caret jumps):\n");
+  for (std::size_t size : SIZES) {
+
+    if (quick && size > 10 * MB) {
+      break;
+    }
+
+    std::mt19937 random(34);
+    const std::string text = makeText(size, random);
+
+    // piece table ~ one edit per keystroke, a snapshot per text-change event ...
+    const std::size_t keystrokes = quick ? 20000 : 200000;
+    PieceTable model(text);
+    std::size_t caret = model.size() / 2;
+    std::size_t snapshots = 0;
+    Stopwatch stopwatch;
+    for (std::size_t k = 0; k < keystrokes; k++) {
+      const unsigned action = random() % 100;
+      if (action < 2) {
+        caret = random() % (model.size() + 1); // click elsewhere
+      } else if (action < 12 && caret > 0) {
+        model.erase(--caret, 1); // backspace
+      } else {
+        const char c = static_cast<char>('a' + random() % 26);
+        model.replace(caret++, 0, &c, 1);
+      }
+      snapshots += model.snapshot().size() != 0;
+    }
+    const double modelUs = stopwatch.us() / keystrokes;
+
+    // ... & copying the whole text per keystroke
+    const std::size_t copies = quick ? 20 : std::max<std::size_t>(20, 2000 / (size / MB));
+    std::string control = text;
+    std::string copy;
+    std::size_t copied = 0;
+    stopwatch.restart();
+    for (std::size_t k = 0; k < copies; k++) {
+      control[random() % control.size()] = static_cast<char>('a' + k % 26);
+      copy.assign(control.data(), control.size());
+      copied += copy.size();
+    }
+    const double copyUs = stopwatch.us() / copies;
+
+    std::printf("  %4zu MB: piece table %7.3f us (%zu pieces, %zu lines), whole-text copy %9.1f us\n",
+      size / MB, modelUs, model.pieceCount(), model.lineCount(), copyUs);
+    if (snapshots != keystrokes || copied != copies * size || model.size() == 0) {
+      std::printf("(unexpected sizes)\n");
+    }
+  }
+
+  return 0;
+}
\ No newline at end of file
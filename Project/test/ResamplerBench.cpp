@@ -0,0 +1,135 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		ResamplerBench.cpp
+  * @brief 		Quality & throughput benchmark of the `Resampler` kernels
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	Quality ~ PSNR of a 2x-then-4x downscale of a synthetic photo-like image
+  *           (smooth gradients, edges & fine detail) against the image rendered directly
+  *           at the small size <br/>
+  *           Throughput ~ output megapixels per second, for menu-sized bitmaps & for large
+  *           images, on one thread & on every core <br/>
+  *           usage: ResamplerBench [--quick]
+  */
+
+#include "./Test.h"
+#include "../dependencies/utils/img/Resampler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+namespace {
+
+  /// @brief 32-bit pixels with their storage
+  struct Image {
+    int width = 0, height = 0;
+    std::vector<unsigned char> pixels;
+    Image(int w, int h) : width(w), height(h), pixels(static_cast<std::size_t>(w) * h * 4) { }
+    Resampler::Surface surface() { return { pixels.data(), width, height, width * 4 }; }
+  };
+
+  /// @brief helper function to render the synthetic image at any size (supersampled)
+  Image render(int width, int height) {
+    Image image(width, height);
+    const int ss = 4;
+    for (int y = 0; y < height; y++) {
+      for (int x = 0; x < width; x++) {
+        double acc[3] = { 0, 0, 0 };
+        for (int sy = 0; sy < ss; sy++) {
+          for (int sx = 0; sx < ss; sx++) {
+            const double u = (x + (sx + 0.5) / ss) / width;
+            const double v = (y + (sy + 0.5) / ss) / height;
+            const double ring = 0.5 + 0.5 * std::cos(40.0 * std::hypot(u - 0.5, v - 0.5));
+            const bool square = u > 0.2 && u < 0.45 && v > 0.55 && v < 0.8;
+            acc[0] += 255 * u;
+            acc[1] += 255 * ring;
+            acc[2] += square ? 230 : 255 * v * 0.5;
+          }
+        }
+        unsigned char* p = &image.pixels[(static_cast<std::size_t>(y) * width + x) * 4];
+        for (int c = 0; c < 3; c++) {
+          p[c] = static_cast<unsigned char>(acc[c] / (ss * ss) + 0.5);
+        }
+        p[3] = 255;
+      }
+    }
+    return image;
+  }
+
+  /// @brief helper function to compute the PSNR (in dB) of two images of the same size
+  double psnr(const Image& a, const Image& b) {
+    double error = 0;
+    for (std::size_t i = 0; i < a.pixels.size(); i++) {
+      const double d = static_cast<double>(a.pixels[i]) - b.pixels[i];
+      error += d * d;
+    }
+    error /= a.pixels.size();
+    return error == 0 ? 99.0 : 10.0 * std::log10(255.0 * 255.0 / error);
+  }
+
+  /// @brief names of the filters
+  const char* NAMES[] = { "box", "bilinear", "bicubic", "lanczos3" };
+}
+
+int main(int argc, char* argv[]) {
+
+  const bool quick = argc > 1 && std::string(argv[1]) == "--quick";
+  const Resampler::Filter filters[] = { Resampler::BOX, Resampler::BILINEAR, Resampler::BICUBIC, Resampler::LANCZOS3 };
+  const unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+
+  // quality ...
+  {
+    Image large = render(512, 512);
+    Image expected = render(64, 64);
+    std::printf("quality (PSNR vs. reference, 512x512 => 64x64):\n");
+    for (Resampler::Filter filter : filters) {
+      Image direct(64, 64);
+      Resampler::resize(large.surface(), direct.surface(), filter, 1);
+      Image half(256, 256), twice(64, 64);
+      Resampler::resize(large.surface(), half.surface(), filter, 1);
+      Resampler::resize(half.surface(), twice.surface(), filter, 1);
+      std::printf("  %-9s direct %5.2f dB, in 2 steps %5.2f dB\n",
+        NAMES[filter], psnr(direct, expected), psnr(twice, expected));
+    }
+  }
+
+  // throughput ...
+  struct Case { const char* name; int sw, sh, dw, dh, repeat; };
+  const Case cases[] = {
+    { "menu bitmap 256x256 => 16x16",   256,  256,   16,   16, quick ? 200 : 2000 },
+    { "icon 32x32 => 48x48",             32,   32,   48,   48, quick ? 200 : 2000 },
+    { "1920x1080 => 960x540",          1920, 1080,  960,  540, quick ?   2 :   20 },
+    { "4000x3000 => 1600x1200",        4000, 3000, 1600, 1200, quick ?   1 :    5 },
+    { "800x600 => 2400x1800",           800,  600, 2400, 1800, quick ?   1 :    5 },
+  };
+  std::printf("throughput (output megapixels/s, 1 thread | %u threads):\n", cores);
+  for (const Case& c : cases) {
+    Image src = render(std::min(c.sw, 64), std::min(c.sh, 64));
+    Image big(c.sw, c.sh);
+    for (int y = 0; y < c.sh; y++) {
+      for (int x = 0; x < c.sw; x++) {
+        std::copy_n(&src.pixels[((y % src.height) * src.width + x % src.width) * 4], 4,
+          &big.pixels[(static_cast<std::size_t>(y) * c.sw + x) * 4]);
+      }
+    }
+    Image dst(c.dw, c.dh);
+    std::printf("  %s\n", c.name);
+    for (Resampler::Filter filter : filters) {
+      double rate[2];
+      for (int t = 0; t < 2; t++) {
+        Stopwatch watch;
+        for (int r = 0; r < c.repeat; r++) {
+          Resampler::resize(big.surface(), dst.surface(), filter, t ? cores : 1);
+        }
+        rate[t] = static_cast<double>(c.dw) * c.dh * c.repeat / watch.us();
+      }
+      std::printf("    %-9s %8.1f | %8.1f\n", NAMES[filter], rate[0], rate[1]);
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
@@ -0,0 +1,303 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		ResamplerTest.cpp
+  * @brief 		Regression test of the `Resampler` kernels against a scalar reference
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	The reference scales in double precision with the same filter windows,
+  *           rounding (& clamping to alpha) after each pass like the fixed-point kernels,
+  *           so that the SIMD & threaded paths may differ by the coefficient rounding only <br/>
+  *           Regions (`resizeRegion(...)`) must match the whole image exactly, & changed
+  *           input pixels must change output pixels within their `reach(...)` only
+  */
+
+#include "./Test.h"
+#include "../dependencies/utils/img/Resampler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+
+  /// @brief 32-bit pixels with their storage
+  struct Image {
+    int width = 0, height = 0;
+    std::vector<unsigned char> pixels;
+    Image(int w, int h) : width(w), height(h), pixels(static_cast<std::size_t>(w) * h * 4) { }
+    Resampler::Surface surface() { return { pixels.data(), width, height, width * 4 }; }
+    unsigned char* at(int x, int y) { return &pixels[(static_cast<std::size_t>(y) * width + x) * 4]; }
+  };
+
+  /// @brief helper function to fill an image with random premultiplied pixels
+  void randomize(Image& image, std::mt19937& random) {
+    for (std::size_t i = 0; i < image.pixels.size(); i += 4) {
+      const unsigned a = random() % 256;
+      for (int c = 0; c < 3; c++) {
+        image.pixels[i + c] = static_cast<unsigned char>(a ? random() % (a + 1) : 0);
+      }
+      image.pixels[i + 3] = static_cast<unsigned char>(a);
+    }
+  }
+
+  /// @brief helper function to round a channel & clamp the colors of a pixel to its alpha
+  void store(const double acc[4], unsigned char* out) {
+    int v[4];
+    for (int c = 0; c < 4; c++) {
+      v[c] = std::min(255, std::max(0, static_cast<int>(std::floor(acc[c] + 0.5))));
+    }
+    for (int c = 0; c < 3; c++) {
+      v[c] = std::min(v[c], v[3]);
+    }
+    for (int c = 0; c < 4; c++) {
+      out[c] = static_cast<unsigned char>(v[c]);
+    }
+  }
+
+  /// @brief helper function to compute the (normalized) window of output pixel `i`
+  void window(int inSize, int outSize, Resampler::Filter filter, int i, int& first, std::vector<double>& w) {
+    const double scale = static_cast<double>(inSize) / outSize;
+    const double filterScale = std::max(scale, 1.0);
+    const double support = Resampler::support(filter) * filterScale;
+    const int maxTaps = static_cast<int>(std::ceil(support)) * 2 + 1;
+    const double center = (i + 0.5) * scale;
+    first = std::max(static_cast<int>(center - support + 0.5), 0);
+    int last = std::min(static_cast<int>(center + support + 0.5), inSize);
+    last = std::min(last, first + maxTaps);
+    w.clear();
+    double sum = 0;
+    for (int k = first; k < last; k++) {
+      w.push_back(Resampler::kernel(filter, (k - center + 0.5) / filterScale));
+      sum += w.back();
+    }
+    if (w.empty() || sum == 0) {
+      first = std::min(static_cast<int>(center), inSize - 1);
+      w.assign(1, 1.0);
+      return;
+    }
+    for (double& v : w) {
+      v /= sum;
+    }
+  }
+
+  /// @brief scalar reference ~ horizontal then vertical pass, in double precision
+  Image reference(Image& src, int width, int height, Resampler::Filter filter) {
+    Image middle(width, src.height);
+    std::vector<double> w;
+    int first = 0;
+    for (int x = 0; x < width; x++) {
+      if (width == src.width) {
+        for (int y = 0; y < src.height; y++) {
+          std::copy(src.at(x, y), src.at(x, y) + 4, middle.at(x, y));
+        }
+        continue;
+      }
+      window(src.width, width, filter, x, first, w);
+      for (int y = 0; y < src.height; y++) {
+        double acc[4] = { 0, 0, 0, 0 };
+        for (std::size_t k = 0; k < w.size(); k++) {
+          for (int c = 0; c < 4; c++) {
+            acc[c] += src.at(first + static_cast<int>(k), y)[c] * w[k];
+          }
+        }
+        store(acc, middle.at(x, y));
+      }
+    }
+    if (height == src.height) {
+      return middle;
+    }
+    Image dst(width, height);
+    for (int y = 0; y < height; y++) {
+      window(src.height, height, filter, y, first, w);
+      for (int x = 0; x < width; x++) {
+        double acc[4] = { 0, 0, 0, 0 };
+        for (std::size_t k = 0; k < w.size(); k++) {
+          for (int c = 0; c < 4; c++) {
+            acc[c] += middle.at(x, first + static_cast<int>(k))[c] * w[k];
+          }
+        }
+        store(acc, dst.at(x, y));
+      }
+    }
+    return dst;
+  }
+
+  /// @brief helper function to retrieve the largest channel difference of two images
+  int maxDifference(const Image& a, const Image& b) {
+    int worst = 0;
+    for (std::size_t i = 0; i < a.pixels.size(); i++) {
+      worst = std::max(worst, std::abs(a.pixels[i] - b.pixels[i]));
+    }
+    return worst;
+  }
+}
+
+int main() {
+
+  const Resampler::Filter filters[] = { Resampler::BOX, Resampler::BILINEAR, Resampler::BICUBIC, Resampler::LANCZOS3 };
+  std::mt19937 random(28);
+
+  // random sizes (up, down & mixed) against the reference ...
+  for (int round = 0; round < 60; round++) {
+    Image src(1 + random() % 97, 1 + random() % 97);
+    randomize(src, random);
+    const int width = 1 + random() % 130;
+    const int height = 1 + random() % 130;
+    for (Resampler::Filter filter : filters) {
+      Image dst(width, height);
+      CHECK(Resampler::resize(src.surface(), dst.surface(), filter, 1));
+      Image expected = reference(src, width, height, filter);
+      const int difference = maxDifference(dst, expected);
+      CHECK(difference <= 2);
+      if (difference > 2) {
+        std::fprintf(stderr, "  filter %d, %dx%d => %dx%d: off by %d\n",
+          filter, src.width, src.height, width, height, difference);
+      }
+    }
+  }
+
+  // large images are split across threads ~ identical to a single thread ...
+  {
+    Image src(700, 500);
+    randomize(src, random);
+    for (Resampler::Filter filter : filters) {
+      Image one(613, 457), many(613, 457);
+      Resampler::resize(src.surface(), one.surface(), filter, 1);
+      Resampler::resize(src.surface(), many.surface(), filter, 4);
+      CHECK(one.pixels == many.pixels);
+    }
+  }
+
+  // bottom-up (negative stride) surfaces ~ same rows as top-down ...
+  {
+    Image src(40, 30);
+    randomize(src, random);
+    Image topDown(23, 51), bottomUp(23, 51);
+    Resampler::resize(src.surface(), topDown.surface(), Resampler::BICUBIC, 1);
+    Resampler::Surface from = { src.at(0, src.height - 1), src.width, src.height, -src.width * 4 };
+    Resampler::Surface to = { bottomUp.at(0, bottomUp.height - 1), bottomUp.width, bottomUp.height, -bottomUp.width * 4 };
+    Image flipped(40, 30);
+    for (int y = 0; y < src.height; y++) {
+      std::copy(src.at(0, y), src.at(0, y) + src.width * 4, flipped.at(0, src.height - 1 - y));
+    }
+    from.data = flipped.at(0, flipped.height - 1);
+    Resampler::resize(from, to, Resampler::BICUBIC, 1);
+    bool same = true;
+    for (int y = 0; y < topDown.height; y++) {
+      same = same && std::equal(topDown.at(0, y), topDown.at(0, y) + topDown.width * 4, bottomUp.at(0, bottomUp.height - 1 - y));
+    }
+    CHECK(same);
+  }
+
+  // regions ~ exactly what the whole image holds there, with one, both or no dimension scaled ...
+  for (int round = 0; round < 48; round++) {
+    Image src(1 + random() % 60, 1 + random() % 60);
+    randomize(src, random);
+    const int width = (round % 4 == 1 || round % 4 == 3) ? src.width : 1 + random() % 90;
+    const int height = (round % 4 == 2 || round % 4 == 3) ? src.height : 1 + random() % 90;
+    const Resampler::Filter filter = filters[random() % 4];
+    Image whole(width, height);
+    Resampler::resize(src.surface(), whole.surface(), filter, 1);
+    const int left = static_cast<int>(random() % width);
+    const int top = static_cast<int>(random() % height);
+    Image part(1 + random() % (width - left), 1 + random() % (height - top));
+    CHECK(Resampler::resizeRegion(src.surface(), width, height, part.surface(), left, top, filter, 1));
+    bool same = true;
+    for (int y = 0; y < part.height; y++) {
+      same = same && std::equal(part.at(0, y), part.at(0, y) + part.width * 4, whole.at(left, top + y));
+    }
+    CHECK(same);
+  }
+  {
+    Image src(8, 8), part(4, 4);
+    CHECK(!Resampler::resizeRegion(src.surface(), 10, 10, part.surface(), 7, 0));
+    CHECK(!Resampler::resizeRegion(src.surface(), 10, 10, part.surface(), 0, -1));
+  }
+
+  // reach ~ changing input pixels changes no output pixel beyond it ...
+  for (int round = 0; round < 40; round++) {
+    Image src(1 + random() % 60, 1 + random() % 60);
+    randomize(src, random);
+    const int width = 1 + random() % 90;
+    const int height = 1 + random() % 90;
+    const Resampler::Filter filter = filters[random() % 4];
+    Image before(width, height), after(width, height);
+    Resampler::resize(src.surface(), before.surface(), filter, 1);
+    const int x0 = static_cast<int>(random() % src.width);
+    const int x1 = x0 + 1 + static_cast<int>(random() % (src.width - x0));
+    const int y0 = static_cast<int>(random() % src.height);
+    const int y1 = y0 + 1 + static_cast<int>(random() % (src.height - y0));
+    for (int y = y0; y < y1; y++) {
+      for (int x = x0; x < x1; x++) {
+        src.at(x, y)[3] = static_cast<unsigned char>(255 - src.at(x, y)[3]);
+        src.at(x, y)[0] = src.at(x, y)[1] = src.at(x, y)[2] = 0;
+      }
+    }
+    Resampler::resize(src.surface(), after.surface(), filter, 1);
+    int left, right, top, bottom;
+    Resampler::reach(src.width, width, filter, x0, x1, left, right);
+    Resampler::reach(src.height, height, filter, y0, y1, top, bottom);
+    bool within = true;
+    for (int y = 0; y < height; y++) {
+      for (int x = 0; x < width; x++) {
+        const bool inside = x >= left && x < right && y >= top && y < bottom;
+        within = within && (inside || std::equal(before.at(x, y), before.at(x, y) + 4, after.at(x, y)));
+      }
+    }
+    CHECK(within);
+  }
+  {
+    int first, last;
+    Resampler::reach(100, 200, Resampler::BILINEAR, 50, 51, first, last);
+    CHECK(first < last && first >= 96 && last <= 106); // a few pixels, not the whole row
+    Resampler::reach(100, 100, Resampler::BICUBIC, 10, 20, first, last);
+    CHECK(first == 10 && last == 20);
+    Resampler::reach(100, 37, Resampler::BICUBIC, 20, 20, first, last);
+    CHECK(first == last);
+  }
+
+  // unit gain ~ a flat image stays flat with every filter ...
+  for (Resampler::Filter filter : filters) {
+    Image src(37, 29);
+    for (std::size_t i = 0; i < src.pixels.size(); i += 4) {
+      src.pixels[i] = 40; src.pixels[i + 1] = 90; src.pixels[i + 2] = 130; src.pixels[i + 3] = 200;
+    }
+    Image dst(101, 13);
+    Resampler::resize(src.surface(), dst.surface(), filter, 1);
+    bool flat = true;
+    for (std::size_t i = 0; i < dst.pixels.size(); i += 4) {
+      flat = flat && dst.pixels[i] == 40 && dst.pixels[i + 1] == 90 && dst.pixels[i + 2] == 130 && dst.pixels[i + 3] == 200;
+    }
+    CHECK(flat);
+  }
+
+  // premultiply/unpremultiply round trip (opaque pixels unchanged) ...
+  {
+    Image image(16, 16);
+    randomize(image, random);
+    for (std::size_t i = 3; i < image.pixels.size(); i += 8) {
+      image.pixels[i] = 255;
+    }
+    Image copy = image;
+    Resampler::unpremultiply(image.surface());
+    Resampler::premultiply(image.surface());
+    bool opaqueKept = true;
+    for (std::size_t i = 3; i < image.pixels.size(); i += 8) {
+      opaqueKept = opaqueKept && std::equal(&image.pixels[i - 3], &image.pixels[i + 1], &copy.pixels[i - 3]);
+    }
+    CHECK(opaqueKept);
+  }
+
+  // empty surfaces are rejected ...
+  {
+    Image src(4, 4), dst(4, 4);
+    Resampler::Surface empty = { nullptr, 0, 0, 0 };
+    CHECK(!Resampler::resize(empty, dst.surface()));
+    CHECK(!Resampler::resize(src.surface(), empty));
+  }
+
+  return TEST_RESULT();
+}
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
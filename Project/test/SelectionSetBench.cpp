@@ -0,0 +1,110 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		SelectionSetBench.cpp
+  * @brief 		Select-all & invert benchmark of the `xMultiSelectListBox` selection (`SelectionSet`)
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	Times, at 1M items, what `selectAll()`, `invert()`, `isSelected(...)`,
+  *           `getSelectedIndices()` & `applySelection()` (runs of selected items) do, &
+  *           a row inserted/removed at the top (`insertAt`/`eraseAt`), against the former
+  *           `std::vector<int> selectedIndices` (select-all by `select(index)` per item,
+  *           i.e. a `std::find` each, timed on a prefix since it is quadratic) <br/>
+  *           usage: SelectionSetBench [--quick] [items]
+  */
+
+#include "./Test.h"
+#include "../dependencies/utils/list/SelectionSet.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+
+  const bool quick = argc > 1 && std::string(argv[1]) == "--quick";
+  const std::size_t items = static_cast<std::size_t>(parseSize(argc > 1 + quick ? argv[1 + quick] : nullptr, quick ? 100000 : 1000000));
+  const std::size_t rounds = quick ? 10 : 100;
+  bool ok = true;
+
+  // select all & invert ...
+  SelectionSet selection(items);
+  Stopwatch stopwatch;
+  for (std::size_t r = 0; r < rounds; r++) {
+    selection.clear();
+    selection.fill();
+  }
+  const double fillUs = stopwatch.us() / rounds;
+  ok = selection.count() == items && ok;
+
+  std::mt19937 random(43);
+  for (std::size_t i = 0; i < items / 3; i++) {
+    selection.erase(random() % items);
+  }
+  const std::size_t selected = selection.count();
+  stopwatch.restart();
+  for (std::size_t r = 0; r < rounds; r++) {
+    selection.invert();
+  }
+  const double invertUs = stopwatch.us() / rounds;
+  ok = selection.count() == ((rounds % 2) ? items - selected : selected) && ok;
+
+  // ... membership, iteration & runs
+  const std::size_t lookups = quick ? 1000000 : 10000000;
+  std::size_t hits = 0;
+  stopwatch.restart();
+  for (std::size_t l = 0; l < lookups; l++) {
+    hits += selection.contains(random() % items);
+  }
+  const double containsNs = stopwatch.us() * 1000 / lookups;
+
+  std::vector<int> indices;
+  stopwatch.restart();
+  indices.reserve(selection.count());
+  for (std::size_t i = selection.next(0); i != SelectionSet::npos; i = selection.next(i + 1)) {
+    indices.push_back(static_cast<int>(i));
+  }
+  const double iterateMs = stopwatch.ms();
+  ok = indices.size() == selection.count() && ok;
+
+  std::size_t runs = 0;
+  stopwatch.restart();
+  for (std::size_t first = selection.next(0); first != SelectionSet::npos; runs++) {
+    first = selection.next(selection.nextClear(first));
+  }
+  const double runsMs = stopwatch.ms();
+
+  // rows inserted & removed at the top ~ the whole selection shifts
+  const std::size_t shifts = quick ? 100 : 1000;
+  const std::size_t before = selection.count();
+  stopwatch.restart();
+  for (std::size_t s = 0; s < shifts; s++) {
+    selection.insertAt(0);
+    selection.eraseAt(0);
+  }
+  const double shiftUs = stopwatch.us() / (2 * shifts);
+  ok = selection.count() == before && selection.size() == items && ok;
+
+  std::printf("%zu items: select all %.1f us, invert %.1f us, contains %.1f ns\n", items, fillUs, invertUs, containsNs);
+  std::printf("  %zu selected: iterate %.2f ms, %zu runs %.2f ms, insert/remove a row %.1f us\n",
+    indices.size(), iterateMs, runs, runsMs, shiftUs);
+
+  // the former vector of indices ~ select-all as one `select(index)` per item
+  const std::size_t prefix = std::min<std::size_t>(items, quick ? 10000 : 30000);
+  std::vector<int> selectedIndices;
+  stopwatch.restart();
+  for (std::size_t i = 0; i < prefix; i++) {
+    if (std::find(selectedIndices.begin(), selectedIndices.end(), static_cast<int>(i)) == selectedIndices.end()) {
+      selectedIndices.push_back(static_cast<int>(i));
+    }
+  }
+  const double formerMs = stopwatch.ms();
+  std::printf("  std::vector<int> select all: %.1f ms for the first %zu items (growing quadratically)\n", formerMs, prefix);
+  ok = selectedIndices.size() == prefix && hits > 0 && ok;
+
+  if (!ok) {
+    std::printf("(wrong counts)\n");
+    return 1;
+  }
+  return 0;
+}
\ No newline at end of file
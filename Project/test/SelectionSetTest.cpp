@@ -0,0 +1,134 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		SelectionSetTest.cpp
+  * @brief 		Test of the `xMultiSelectListBox` selection model (`SelectionSet`)
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	Checks ranges across word boundaries, iteration (`next`/`nextClear`),
+  *           `invert()` with a partial last word, the count, & rows inserted & removed
+  *           (`insertAt`/`eraseAt`), against a plain vector of flags
+  */
+
+#include "./Test.h"
+#include "../dependencies/utils/list/SelectionSet.h"
+
+#include <random>
+#include <vector>
+
+namespace {
+
+  /// @brief helper function to check the set against the flags, position by position
+  bool same(const SelectionSet& set, const std::vector<bool>& flags) {
+    if (set.size() != flags.size()) {
+      return false;
+    }
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < flags.size(); i++) {
+      if (set.contains(i) != flags[i]) {
+        return false;
+      }
+      count += flags[i];
+    }
+    if (set.count() != count || set.empty() != (count == 0)) {
+      return false;
+    }
+    // iteration visits the selected positions & the runs between them ...
+    std::size_t visited = 0;
+    for (std::size_t i = set.next(0); i != SelectionSet::npos; i = set.next(i + 1)) {
+      if (!flags[i] || set.nextClear(i) <= i) {
+        return false;
+      }
+      visited++;
+    }
+    for (std::size_t i = set.nextClear(0); i < set.size(); i = set.nextClear(i + 1)) {
+      if (flags[i]) {
+        return false;
+      }
+    }
+    return visited == count;
+  }
+}
+
+int main() {
+
+  // ranges across word (64) & summary (4096) boundaries ...
+  SelectionSet set(10000);
+  std::vector<bool> flags(10000, false);
+  CHECK(same(set, flags) && set.next(0) == SelectionSet::npos && set.nextClear(0) == 0);
+  set.insert(60, 70);
+  set.insert(4090, 4100);
+  set.insert(9999);
+  for (std::size_t i = 60; i < 70; i++) { flags[i] = true; }
+  for (std::size_t i = 4090; i < 4100; i++) { flags[i] = true; }
+  flags[9999] = true;
+  CHECK(same(set, flags));
+  CHECK(set.next(70) == 4090 && set.nextClear(60) == 70 && set.next(4100) == 9999);
+  CHECK(set.nextClear(9999) == set.size() && set.next(10000) == SelectionSet::npos);
+  set.erase(64, 4095);
+  for (std::size_t i = 64; i < 4095; i++) { flags[i] = false; }
+  CHECK(same(set, flags) && set.count() == 4 + 5 + 1);
+
+  // invert ~ the partial last word keeps no position past the list ...
+  set.invert();
+  flags.flip();
+  CHECK(same(set, flags) && set.count() == 10000 - 10);
+  set.resize(10010);
+  flags.resize(10010, false);
+  CHECK(same(set, flags) && set.nextClear(10000) == 10000);
+  set.fill();
+  CHECK(set.count() == 10010);
+  set.clear();
+  CHECK(set.empty() && set.size() == 10010);
+
+  // selecting past the list grows it, deselecting past it does not
+  SelectionSet grown;
+  grown.insert(130);
+  CHECK(grown.size() == 131 && grown.count() == 1);
+  grown.erase(200, 300);
+  CHECK(grown.size() == 131);
+
+  // rows inserted & removed ~ the selection follows its rows
+  SelectionSet rows(10);
+  rows.insert(2);
+  rows.insert(9);
+  rows.insertAt(0);
+  CHECK(rows.size() == 11 && rows.contains(3) && rows.contains(10) && !rows.contains(2) && rows.count() == 2);
+  rows.eraseAt(3);
+  CHECK(rows.size() == 10 && rows.contains(9) && rows.count() == 1);
+  rows.insertAt(10, 3); // appended
+  CHECK(rows.size() == 13 && rows.contains(9) && rows.count() == 1);
+
+  // random edits against the flags, shifts of up to two words included
+  std::mt19937 random(43);
+  SelectionSet model;
+  std::vector<bool> reference;
+  int mismatches = 0;
+  for (int step = 0; step < 4000; step++) {
+    const unsigned action = random() % 8;
+    const std::size_t size = reference.size();
+    const std::size_t pos = random() % (size + 1);
+    const std::size_t count = (random() % 4 == 0) ? random() % 150 : 1 + random() % 3;
+    if (action < 3) {
+      model.insertAt(pos, count);
+      reference.insert(reference.begin() + pos, count, false);
+    } else if (action < 5) {
+      model.eraseAt(pos, count);
+      const std::size_t n = std::min(count, size - pos);
+      reference.erase(reference.begin() + pos, reference.begin() + pos + n);
+    } else if (action < 7) {
+      const std::size_t last = std::min(size, pos + count);
+      model.insert(pos, last);
+      for (std::size_t i = pos; i < last; i++) { reference[i] = true; }
+    } else {
+      model.invert();
+      reference.flip();
+    }
+    if (!same(model, reference)) {
+      mismatches++;
+    }
+  }
+  CHECK(mismatches == 0 && reference.size() > 0);
+
+  return TEST_RESULT();
+}
\ No newline at end of file
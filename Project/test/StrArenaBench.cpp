@@ -0,0 +1,135 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		StrArenaBench.cpp
+  * @brief 		Memory per item & iteration benchmark of the list items (`StrArena`)
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	Stores the same items in `StrArena`/`WStrArena` (the `itemsList` of
+  *           `xListBox` & `xDropDown`) & in `std::vector<std::string>`/`std::wstring`
+  *           (the former `itemsList`), short items (small-string buffer) & long ones,
+  *           then times populating (in pages, as `receivePages()` does), reading every
+  *           character of every item, & removing items from the middle <br/>
+  *           Memory is the heap in use (glibc) per item <br/>
+  *           usage: StrArenaBench [--quick] [items]
+  */
+
+#include "./Test.h"
+#include "../dependencies/utils/str/StrArena.h"
+
+#include <vector>
+
+namespace {
+
+  /// @brief number of items of a page (see `PageQueue`)
+  const std::size_t PAGE = 4096;
+
+  /// @brief helper function to format an item of about `length` characters
+  template <typename String>
+  String item(std::size_t i, std::size_t length) {
+    String s;
+    const std::string digits = std::to_string(i);
+    for (std::size_t k = 0; s.size() < length; k++) {
+      s.push_back(static_cast<typename String::value_type>(k < digits.size() ? digits[k] : 'a' + (i + k) % 26));
+    }
+    return s;
+  }
+
+  /// @brief helper function to sum the characters of the items of a vector
+  template <typename String>
+  std::size_t sum(const std::vector<String>& list) {
+    std::size_t total = 0;
+    for (const String& s : list) {
+      for (const auto c : s) {
+        total += static_cast<std::size_t>(c);
+      }
+    }
+    return total;
+  }
+
+  /// @brief helper function to sum the characters of the items of an arena
+  template <typename CharT>
+  std::size_t sum(const BasicStrArena<CharT>& list) {
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < list.size(); i++) {
+      const CharT* s = list.c_str(i);
+      for (std::size_t k = 0, n = list.length(i); k < n; k++) {
+        total += static_cast<std::size_t>(s[k]);
+      }
+    }
+    return total;
+  }
+
+  /// @brief helper function to append an item
+  template <typename String>
+  void append(std::vector<String>& list, const String& s) { list.push_back(s); }
+
+  /// @brief helper function to append an item
+  template <typename CharT>
+  void append(BasicStrArena<CharT>& list, const std::basic_string<CharT>& s) { list.push_back(s); }
+
+  /// @brief helper function to remove an item
+  template <typename String>
+  void remove(std::vector<String>& list, std::size_t pos) { list.erase(list.begin() + pos); }
+
+  /// @brief helper function to remove an item
+  template <typename CharT>
+  void remove(BasicStrArena<CharT>& list, std::size_t pos) { list.erase(pos); }
+
+  /// @brief helper function to time a storage of `count` items of `length` characters
+  template <typename List, typename String>
+  std::size_t run(const char* name, std::size_t count, std::size_t length, std::size_t removals) {
+
+    const std::size_t before = heapBytes();
+    Stopwatch stopwatch;
+    List list;
+    for (std::size_t first = 0; first < count; first += PAGE) {
+      const std::size_t last = std::min(count, first + PAGE);
+      list.reserve(last - first); // additional, as `itemsList.reserve(page.size())`
+      for (std::size_t i = first; i < last; i++) {
+        append(list, item<String>(i, length));
+      }
+    }
+    const double populateMs = stopwatch.ms();
+    const std::size_t after = heapBytes();
+
+    stopwatch.restart();
+    const std::size_t total = sum(list);
+    const double iterateMs = stopwatch.ms();
+
+    stopwatch.restart();
+    for (std::size_t r = 0; r < removals; r++) {
+      remove(list, list.size() / 2);
+    }
+    const double removeUs = stopwatch.us() / removals;
+
+    std::printf("    %-22s populate %7.1f ms, iterate %6.2f ms (%5.2f ns/char), remove %7.2f us",
+      name, populateMs, iterateMs, iterateMs * 1e6 / (count * length), removeUs);
+    if (after) {
+      std::printf(", %6.1f bytes/item", (after > before ? after - before : 0) / static_cast<double>(count));
+    }
+    std::printf("\n");
+    return total + list.size();
+  }
+}
+
+int main(int argc, char* argv[]) {
+
+  const bool quick = argc > 1 && std::string(argv[1]) == "--quick";
+  const std::size_t count = static_cast<std::size_t>(parseSize(argc > 1 + quick ? argv[1 + quick] : nullptr, quick ? 100000 : 1000000));
+  const std::size_t removals = quick ? 100 : 1000;
+  const std::size_t LENGTHS[] = { 8, 48 };
+
+  std::size_t checksum = 0;
+  for (std::size_t length : LENGTHS) {
+    std::printf("%zu items of %zu characters:\n", count, length);
+    checksum += run<std::vector<std::string>, std::string>("std::vector<string>", count, length, removals);
+    checksum += run<StrArena, std::string>("StrArena", count, length, removals);
+    checksum += run<std::vector<std::wstring>, std::wstring>("std::vector<wstring>", count, length, removals);
+    checksum += run<WStrArena, std::wstring>("WStrArena", count, length, removals);
+  }
+  if (checksum == 0) {
+    std::printf("(nothing read)\n");
+  }
+  return 0;
+}
\ No newline at end of file
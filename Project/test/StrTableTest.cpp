@@ -0,0 +1,110 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		StrTableTest.cpp
+  * @brief 		Test of the `StrTable` lookups & of loading saved (possibly damaged) tables
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  */
+
+#include "./Test.h"
+#include "../dependencies/utils/str/StrTable.h"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace {
+
+  /// @brief offset of `count` in the saved header (magic, version, stamp, count, arena size)
+  const std::size_t COUNT_OFFSET = 16;
+  /// @brief offset of the arena size in the saved header
+  const std::size_t ARENA_OFFSET = 20;
+  /// @brief size of the saved header
+  const std::size_t HEADER_SIZE = 24;
+
+  /// @brief helper function to read a whole file
+  std::string readAll(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  }
+
+  /// @brief helper function to write a whole file
+  void writeAll(const std::string& path, const std::string& bytes) {
+    std::ofstream(path, std::ios::binary).write(bytes.data(), bytes.size());
+  }
+
+  /// @brief helper function to overwrite a 32-bit field of a saved table
+  std::string patch(std::string bytes, std::size_t offset, std::uint32_t value) {
+    std::memcpy(&bytes[offset], &value, sizeof(value));
+    return bytes;
+  }
+}
+
+int main() {
+
+  StrTable table;
+  table.assign({ "Segoe UI", "Arial", "arial", "Courier New", "Consolas", "Arial", "Cambria" });
+
+  // sorted, case-insensitive first, duplicates removed ...
+  CHECK(table.size() == 6);
+  CHECK(table.str(0) == "Arial" && table.str(1) == "arial");
+  CHECK(table.find("Consolas") != StrTable::npos);
+  CHECK(table.find("consolas") == StrTable::npos);
+  CHECK(table.findNoCase("consolas") == table.find("Consolas"));
+  std::pair<std::size_t, std::size_t> range = table.prefixRange("c");
+  CHECK(range.second - range.first == 3);
+  CHECK(table.prefixRange("co", range).second - table.prefixRange("co", range).first == 2);
+
+  // saved & loaded ...
+  const std::string path = scratchDir() + "/strtable-test.bin";
+  CHECK(table.save(path, 31));
+  StrTable loaded;
+  CHECK(loaded.load(path, 31));
+  CHECK(loaded.size() == table.size());
+  for (std::size_t i = 0; i < table.size() && i < loaded.size(); i++) {
+    CHECK(loaded.str(i) == table.str(i));
+  }
+  CHECK(!loaded.load(path, 32)); // stale stamp
+  CHECK(loaded.size() == table.size()); // ... table unchanged
+
+  const std::string saved = readAll(path);
+  CHECK(saved.size() > HEADER_SIZE);
+
+  // damaged files are rejected (no allocation of the sizes they claim) ...
+  StrTable damaged;
+  writeAll(path, saved.substr(0, saved.size() - 3));
+  CHECK(!damaged.load(path, 31)); // truncated
+  writeAll(path, patch(saved, ARENA_OFFSET, 0xFFFFFFF0u));
+  CHECK(!damaged.load(path, 31)); // arena larger than the file
+  writeAll(path, patch(saved, COUNT_OFFSET, 0xFFFFFFF0u));
+  CHECK(!damaged.load(path, 31)); // more strings than bytes
+  writeAll(path, patch(saved, COUNT_OFFSET, 5));
+  CHECK(!damaged.load(path, 31)); // count not matching the strings
+  writeAll(path, saved.substr(0, 10));
+  CHECK(!damaged.load(path, 31)); // no header
+  CHECK(damaged.empty());
+
+  // ... as are unsorted ones, every lookup being a binary search
+  std::string unsorted = saved;
+  const std::size_t consolas = unsorted.find("Consolas");
+  const std::size_t courier = unsorted.find("Courier New");
+  CHECK(consolas != std::string::npos && courier != std::string::npos && consolas < courier);
+  unsorted.replace(consolas, 8, "Zonsolas");
+  writeAll(path, unsorted);
+  CHECK(!damaged.load(path, 31));
+  std::string repeated = saved;
+  repeated.replace(repeated.find("arial"), 5, "Arial");
+  writeAll(path, repeated);
+  CHECK(!damaged.load(path, 31)); // duplicates
+  CHECK(damaged.empty());
+
+  // an empty table round-trips ...
+  StrTable empty;
+  CHECK(empty.save(path, 7));
+  CHECK(damaged.load(path, 7) && damaged.empty());
+
+  std::remove(path.c_str());
+  return TEST_RESULT();
+}
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
@@ -0,0 +1,131 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		Test.h
+  * @brief 		Minimal check & timing helpers shared by the tests & benchmarks
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	The tests (`*Test.cpp`) & benchmarks (`*Bench.cpp`) in ./test
+  *           exercise the portable `utils` on the host, i.e. without Win32,
+  *           & are built & run by `make test` & `make bench` <br/>
+  *           A test reports every failed `CHECK(...)` & returns `TEST_RESULT()`
+  */
+
+#pragma once
+
+/// @brief begin of TEST_H declaration
+#ifndef TEST_H
+#define TEST_H
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+/// @brief number of failed checks of the running test
+inline int& testFailures() { static int failures = 0; return failures; }
+/// @brief number of checks of the running test
+inline int& testChecks() { static int checks = 0; return checks; }
+
+/// @brief check a condition, reporting (but not aborting on) a failure
+#define CHECK(condition) \
+  do { \
+    testChecks()++; \
+    if (!(condition)) { \
+      testFailures()++; \
+      std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+    } \
+  } while (0)
+
+/// @brief report the checks & yield the exit code of the test
+#define TEST_RESULT() \
+  (std::printf("%d checks, %d failed\n", testChecks(), testFailures()), \
+   testFailures() ? EXIT_FAILURE : EXIT_SUCCESS)
+
+/**
+ * @class   Stopwatch
+ * @brief   elapsed (wall clock) time since construction or `restart()`
+ */
+class Stopwatch {
+
+public:
+
+  /// @brief constructor ~ starts timing
+  Stopwatch() : mStart(std::chrono::steady_clock::now()) { }
+
+  /// @brief method to start timing again
+  void restart() { mStart = std::chrono::steady_clock::now(); }
+
+  /// @brief method to retrieve the elapsed time (in milliseconds)
+  double ms() const {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - mStart).count();
+  }
+
+  /// @brief method to retrieve the elapsed time (in microseconds)
+  double us() const {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - mStart).count();
+  }
+
+private:
+
+  /// @brief the time timing started
+  std::chrono::steady_clock::time_point mStart;
+};
+
+/// @brief helper function to read a size argument, i.e. "64M", "2G" or "10000"
+inline unsigned long long parseSize(const char* text, unsigned long long fallback) {
+  if (!text) {
+    return fallback;
+  }
+  char* end = nullptr;
+  unsigned long long value = std::strtoull(text, &end, 10);
+  if (end && (*end == 'k' || *end == 'K')) { value <<= 10; }
+  if (end && (*end == 'm' || *end == 'M')) { value <<= 20; }
+  if (end && (*end == 'g' || *end == 'G')) { value <<= 30; }
+  return value ? value : fallback;
+}
+
+/// @brief helper function to retrieve the directory for scratch files of the benchmarks
+inline std::string scratchDir() {
+  const char* dir = std::getenv("TMPDIR");
+  return (dir && *dir) ? dir : "/tmp";
+}
+
+/// @brief helper function to drop the cached pages of a file (cold start)
+inline bool dropCache(const std::string& path) {
+  #if defined(__linux__)
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  ::fdatasync(fd);
+  bool dropped = ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED) == 0;
+  ::close(fd);
+  return dropped;
+  #else
+  (void) path;
+  return false;
+  #endif
+}
+
+/// @brief helper function to retrieve the heap in use (in bytes), `0` if unknown
+inline std::size_t heapBytes() {
+  #if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+  const struct mallinfo2 info = mallinfo2();
+  return info.uordblks + info.hblkhd;
+  #else
+  return 0;
+  #endif
+}
+
+#endif // end of TEST_H
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
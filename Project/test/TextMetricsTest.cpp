@@ -0,0 +1,128 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		TextMetricsTest.cpp
+  * @brief 		Test of the `TextMetrics` measurements & line breaking (headless font)
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	Every line produced by `breakLines(...)` is checked against `width(...)`
+  *           of the same substring, on random text mixing words, kerning pairs,
+  *           tabs, new lines & multi-byte characters
+  */
+
+#include "./Test.h"
+#include "../dependencies/utils/text/TextMetrics.h"
+
+#include <random>
+
+namespace {
+
+  /// @brief helper function to check the lines of a string, returning the number of bad lines
+  int checkLines(TextMetrics& metrics, const std::string& text, int maxWidth) {
+
+    int bad = 0;
+    std::size_t previousEnd = 0;
+    const std::vector<TextMetrics::Line> lines = metrics.breakLines(text, maxWidth);
+
+    for (const TextMetrics::Line& line : lines) {
+      const std::string content = text.substr(line.begin, line.end - line.begin);
+      // the width of a line is the width of its text ...
+      if (line.width != metrics.width(content)) {
+        bad++;
+      }
+      // ... in order, within the text
+      if (line.begin < previousEnd || line.end < line.begin || line.end > text.size()) {
+        bad++;
+      }
+      // ... fitting, unless a single character is wider than `maxWidth`
+      if (maxWidth > 0 && line.width > maxWidth) {
+        std::size_t i = line.begin;
+        std::size_t characters = 0;
+        while (i < line.end) {
+          i++;
+          while (i < line.end && (static_cast<unsigned char>(text[i]) & 0xC0) == 0x80) {
+            i++;
+          }
+          characters++;
+        }
+        if (characters > 1) {
+          bad++;
+        }
+      }
+      previousEnd = line.end;
+    }
+    return bad;
+  }
+}
+
+int main() {
+
+  TextMetrics metrics(std::unique_ptr<GlyphSource>(new HeadlessGlyphSource(16)));
+
+  // measurements ...
+  CHECK(metrics.width("") == 0);
+  CHECK(metrics.width("A") > 0);
+  CHECK(metrics.width("AV") < metrics.width("A") + metrics.width("V")); // kerned
+  CHECK(metrics.width("ab\ncd") == std::max(metrics.width("ab"), metrics.width("cd")));
+  CHECK(metrics.height("ab\ncd") == 2 * metrics.lineHeight());
+  CHECK(metrics.width("\t") == TextMetrics::TAB_SIZE * metrics.width(" "));
+  CHECK(metrics.width(std::string("\xE4\xB8\xAD")) == metrics.width(std::wstring(L"\x4E2D")));
+
+  // wrapping at spaces ...
+  {
+    const std::string text = "hello wide world";
+    const int maxWidth = metrics.width("hello wide") + 1;
+    std::vector<TextMetrics::Line> lines = metrics.breakLines(text, maxWidth);
+    CHECK(lines.size() == 2);
+    CHECK(lines.size() == 2 && text.substr(lines[0].begin, lines[0].end - lines[0].begin) == "hello wide");
+    CHECK(lines.size() == 2 && text.substr(lines[1].begin, lines[1].end - lines[1].begin) == "world");
+    CHECK(metrics.breakLines(text, 0).size() == 1);
+  }
+
+  // a word moved to a new line, then broken within (stale width) ...
+  {
+    const std::string text = ".Ai aVo";
+    std::vector<TextMetrics::Line> lines = metrics.breakLines(text, 18);
+    CHECK(checkLines(metrics, text, 18) == 0);
+    for (const TextMetrics::Line& line : lines) {
+      if (text.substr(line.begin, line.end - line.begin) == "a") {
+        CHECK(line.width == metrics.width("a"));
+      }
+    }
+  }
+
+  // random text against the widths of the substrings ...
+  {
+    const char* const PIECES[] = {
+      "a", "i", "m", "W", "A", "V", "T", "o", ".", " ", " ", "  ", "\t", "\n",
+      "\xC3\xA9", "\xE4\xB8\xAD", "Yo", "LT"
+    };
+    const std::size_t count = sizeof(PIECES) / sizeof(PIECES[0]);
+    std::mt19937 random(32);
+    int bad = 0;
+    for (int round = 0; round < 200000; round++) {
+      std::string text;
+      const int length = 1 + random() % 12;
+      for (int k = 0; k < length; k++) {
+        text += PIECES[random() % count];
+      }
+      bad += checkLines(metrics, text, 1 + random() % 60);
+    }
+    CHECK(bad == 0);
+    if (bad) {
+      std::fprintf(stderr, "  %d bad lines\n", bad);
+    }
+  }
+
+  // no source calls once warm ...
+  {
+    metrics.warm(0, 0x7F);
+    const std::size_t calls = metrics.sourceCalls();
+    metrics.breakLines("warm ASCII text only", 40);
+    metrics.width("still warm");
+    CHECK(metrics.sourceCalls() == calls);
+  }
+
+  return TEST_RESULT();
+}
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
\ No newline at end of file
@@ -0,0 +1,174 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		TextSearchBench.cpp
+  * @brief 		Find & replace benchmark of the text box model (`TextSearch` over `PieceTable`)
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	Searches 32 MB of edited text (a piece table) for a rare & a common word, in
+  *           every mode (exact, case-insensitive, whole word), narrow & wide, against the
+  *           former client code: copying the text out (`getText()`) & searching the copy
+  *           with `std::string::find` (`std::search` with a folding predicate when
+  *           case-insensitive, a boundary check per match for whole words) <br/>
+  *           Then times replace-all against rebuilding the text from the copy <br/>
+  *           Every count is checked <br/>
+  *           usage: TextSearchBench [--quick] [size]
+  */
+
+#include "./Test.h"
+#include "../dependencies/utils/text/TextSearch.h"
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+
+namespace {
+
+  /// @brief helper function to generate `size` characters of words, `needle` planted now & then
+  template <typename CharT>
+  std::basic_string<CharT> makeText(std::size_t size, const std::basic_string<CharT>& needle) {
+    static const char* const WORDS[] = { "the", "of", "and", "theme", "other", "The", "a", "in", "bathe", "THE", "to", "is" };
+    std::mt19937 random(39);
+    std::basic_string<CharT> text;
+    text.reserve(size + 64);
+    while (text.size() < size) {
+      if (random() % 20000 == 0) {
+        text += needle;
+      } else if (random() % 2) {
+        for (const char* w = WORDS[random() % 12]; *w; w++) {
+          text.push_back(static_cast<CharT>(*w));
+        }
+      } else {
+        const std::size_t letters = 2 + random() % 8;
+        for (std::size_t k = 0; k < letters; k++) {
+          text.push_back(static_cast<CharT>('a' + random() % 26));
+        }
+      }
+      text.push_back(static_cast<CharT>(random() % 10 ? ' ' : '\n'));
+    }
+    return text;
+  }
+
+  /// @brief helper function to widen an ASCII literal
+  template <typename CharT>
+  std::basic_string<CharT> literal(const char* s) { return std::basic_string<CharT>(s, s + std::strlen(s)); }
+
+  /// @brief helper function to fold a character (ASCII)
+  template <typename CharT>
+  CharT fold(CharT c) { return (c >= 'A' && c <= 'Z') ? static_cast<CharT>(c + 0x20) : c; }
+
+  /// @brief helper function to check whether a character belongs to a word
+  template <typename CharT>
+  bool isWord(CharT c) {
+    const std::uint32_t u = static_cast<std::uint32_t>(c) & ((sizeof(CharT) == 1) ? 0xFFu : 0xFFFFFFFFu);
+    return (u >= '0' && u <= '9') || (u >= 'A' && u <= 'Z') || (u >= 'a' && u <= 'z') || u == '_' || u >= 0x80;
+  }
+
+  /// @brief helper function to count the matches the former way, i.e. on a copy of the text
+  template <typename CharT>
+  std::size_t naiveCount(const BasicPieceTable<CharT>& table, const std::basic_string<CharT>& pattern, unsigned flags) {
+    typedef BasicTextSearch<CharT> Search;
+    const std::basic_string<CharT> text = table.str(); // `getText()`
+    const std::size_t m = pattern.size();
+    std::size_t count = 0;
+    if (flags & Search::IGNORE_CASE) {
+      for (auto it = text.begin(); ; it += m) {
+        it = std::search(it, text.end(), pattern.begin(), pattern.end(), [](CharT a, CharT b) { return fold(a) == fold(b); });
+        if (it == text.end()) {
+          break;
+        }
+        count++;
+      }
+      return count;
+    }
+    for (std::size_t pos = text.find(pattern); pos != std::basic_string<CharT>::npos; ) {
+      if ((flags & Search::WHOLE_WORD) && ((pos > 0 && isWord(text[pos - 1])) || (pos + m < text.size() && isWord(text[pos + m])))) {
+        pos = text.find(pattern, pos + 1);
+        continue;
+      }
+      count++;
+      pos = text.find(pattern, pos + m);
+    }
+    return count;
+  }
+
+  /// @brief helper function to time every mode of a text, returning `false` on a wrong count
+  template <typename CharT>
+  bool run(const char* name, std::size_t size) {
+
+    typedef BasicTextSearch<CharT> Search;
+    const std::basic_string<CharT> needle = literal<CharT>("needle_42");
+    const std::basic_string<CharT> common = literal<CharT>("the");
+
+    // an edited text ~ a thousand pieces
+    BasicPieceTable<CharT> table(makeText(size, needle));
+    std::mt19937 random(39);
+    for (int e = 0; e < 1000; e++) {
+      const CharT c = static_cast<CharT>('a' + random() % 26);
+      table.replace(random() % table.size(), 1, &c, 1);
+    }
+
+    std::printf("  %s (%zu pieces), ms: TextSearch | copy & search\n", name, table.pieceCount());
+    bool ok = true;
+    const std::basic_string<CharT>* const PATTERNS[] = { &needle, &common };
+    static const char* const MODES[] = { "exact", "ignore case", "whole word" };
+    const unsigned FLAGS[] = { Search::NONE, Search::IGNORE_CASE, Search::WHOLE_WORD };
+    for (const std::basic_string<CharT>* pattern : PATTERNS) {
+      for (int mode = 0; mode < 3; mode++) {
+        const Search search(*pattern, FLAGS[mode]);
+        Stopwatch stopwatch;
+        const std::size_t found = search.findAll(table).size();
+        const double searchMs = stopwatch.ms();
+        stopwatch.restart();
+        const std::size_t expected = naiveCount(table, *pattern, FLAGS[mode]);
+        const double naiveMs = stopwatch.ms();
+        std::printf("    %-6s %-11s %8zu matches %8.1f | %8.1f\n",
+          pattern == &needle ? "rare" : "common", MODES[mode], found, searchMs, naiveMs);
+        ok = found == expected && ok;
+      }
+    }
+
+    // replace-all ~ edited in place, against rebuilding the copy (`setText(...)`)
+    const std::basic_string<CharT> with = literal<CharT>("THE");
+    BasicPieceTable<CharT> edited(table.str());
+    Stopwatch stopwatch;
+    const std::size_t replaced = Search(common, Search::WHOLE_WORD).replaceAll(edited, with);
+    const double replaceMs = stopwatch.ms();
+    stopwatch.restart();
+    const std::basic_string<CharT> text = table.str();
+    std::basic_string<CharT> rebuilt;
+    rebuilt.reserve(text.size());
+    std::size_t done = 0;
+    std::size_t count = 0;
+    for (std::size_t pos = text.find(common); pos != std::basic_string<CharT>::npos; pos = text.find(common, pos + 1)) {
+      if ((pos > 0 && isWord(text[pos - 1])) || (pos + 3 < text.size() && isWord(text[pos + 3]))) {
+        continue;
+      }
+      rebuilt.append(text, done, pos - done);
+      rebuilt += with;
+      done = pos + 3;
+      count++;
+    }
+    rebuilt.append(text, done, std::basic_string<CharT>::npos);
+    BasicPieceTable<CharT> reset(std::move(rebuilt));
+    const double rebuildMs = stopwatch.ms();
+    std::printf("    replace all (whole word) %8zu matches %8.1f | %8.1f\n", replaced, replaceMs, rebuildMs);
+    return replaced == count && edited.size() == reset.size() && ok;
+  }
+}
+
+int main(int argc, char* argv[]) {
+
+  const bool quick = argc > 1 && std::string(argv[1]) == "--quick";
+  const std::size_t size = static_cast<std::size_t>(parseSize(argc > 1 + quick ? argv[1 + quick] : nullptr, quick ? 4u << 20 : 32u << 20));
+
+  std::printf("%.0f M characters:\n", size / 1048576.0);
+  bool ok = run<char>("UTF-8", size);
+  ok = run<wchar_t>("wide", size) && ok;
+
+  if (!ok) {
+    std::printf("(wrong counts)\n");
+    return 1;
+  }
+  return 0;
+}
\ No newline at end of file
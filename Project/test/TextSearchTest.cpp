@@ -0,0 +1,213 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		TextSearchTest.cpp
+  * @brief 		Test of the text box find & replace engine (`TextSearch`)
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	Compares `find(...)`, `findAll(...)` & `replaceAll(...)` with a naive search,
+  *           every mode (case-insensitive, whole word), narrow & wide text, over random
+  *           text where the SIMD filter finds many candidates (matches at the edges of its
+  *           blocks & of the text included), & over piece tables (matches across pieces &
+  *           across the chunks the table is searched in)
+  */
+
+#include "./Test.h"
+#include "../dependencies/utils/str/CaseMap.h"
+#include "../dependencies/utils/text/TextSearch.h"
+
+#include <random>
+#include <vector>
+
+namespace {
+
+  /// @brief helper function to fold a character as the search does (reference)
+  char fold(char c) { return (c >= 'A' && c <= 'Z') ? static_cast<char>(c + 0x20) : c; }
+
+  /// @brief helper function to fold a character as the search does (reference)
+  wchar_t fold(wchar_t c) {
+    const std::uint32_t u = static_cast<std::uint32_t>(c);
+    if (u > 0xFFFF || (u >= 0xD800 && u <= 0xDFFF)) {
+      return c;
+    }
+    return static_cast<wchar_t>(CaseMap::lower(u));
+  }
+
+  /// @brief helper function to check whether a character belongs to a word (reference)
+  template <typename CharT>
+  bool isWord(CharT c) {
+    const std::uint32_t u = static_cast<std::uint32_t>(c) & ((sizeof(CharT) == 1) ? 0xFFu : 0xFFFFFFFFu);
+    return (u >= '0' && u <= '9') || (u >= 'A' && u <= 'Z') || (u >= 'a' && u <= 'z') || u == '_' || u >= 0x80;
+  }
+
+  /// @brief helper function to check whether the pattern matches at `pos` (reference)
+  template <typename CharT>
+  bool matchesAt(const std::basic_string<CharT>& text, const std::basic_string<CharT>& pattern, unsigned flags, std::size_t pos) {
+    typedef BasicTextSearch<CharT> Search;
+    const std::size_t m = pattern.size();
+    if (m == 0 || pos + m > text.size()) {
+      return false;
+    }
+    for (std::size_t k = 0; k < m; k++) {
+      const bool same = (flags & Search::IGNORE_CASE) ? fold(text[pos + k]) == fold(pattern[k]) : text[pos + k] == pattern[k];
+      if (!same) {
+        return false;
+      }
+    }
+    if (flags & Search::WHOLE_WORD) {
+      return !(pos > 0 && isWord(text[pos - 1])) && !(pos + m < text.size() && isWord(text[pos + m]));
+    }
+    return true;
+  }
+
+  /// @brief helper function to find every (non-overlapping) match, one position at a time
+  template <typename CharT>
+  std::vector<std::size_t> naive(const std::basic_string<CharT>& text, const std::basic_string<CharT>& pattern, unsigned flags) {
+    std::vector<std::size_t> found;
+    for (std::size_t pos = 0; pos + pattern.size() <= text.size(); ) {
+      if (matchesAt(text, pattern, flags, pos)) {
+        found.push_back(pos);
+        pos += pattern.size();
+      } else {
+        pos++;
+      }
+    }
+    return found;
+  }
+
+  /// @brief helper function to find the first match at or after `from`, one position at a time
+  template <typename CharT>
+  std::size_t naiveFind(const std::basic_string<CharT>& text, const std::basic_string<CharT>& pattern, unsigned flags, std::size_t from) {
+    for (std::size_t pos = from; pos + pattern.size() <= text.size(); pos++) {
+      if (matchesAt(text, pattern, flags, pos)) {
+        return pos;
+      }
+    }
+    return BasicTextSearch<CharT>::npos;
+  }
+
+  /// @brief helper function to replace the matches found by the naive search
+  template <typename CharT>
+  std::basic_string<CharT> naiveReplace(const std::basic_string<CharT>& text, const std::basic_string<CharT>& pattern,
+                                        unsigned flags, const std::basic_string<CharT>& with) {
+    std::basic_string<CharT> out;
+    std::size_t done = 0;
+    for (std::size_t pos : naive(text, pattern, flags)) {
+      out.append(text, done, pos - done);
+      out += with;
+      done = pos + pattern.size();
+    }
+    out.append(text, done, std::basic_string<CharT>::npos);
+    return out;
+  }
+
+  /// @brief helper function to retrieve the offsets of matches
+  template <typename Matches>
+  std::vector<std::size_t> offsets(const Matches& matches) {
+    std::vector<std::size_t> out;
+    for (const auto& match : matches) {
+      out.push_back(match.offset);
+    }
+    return out;
+  }
+
+  /// @brief helper function to generate random text of a few characters
+  template <typename CharT>
+  std::basic_string<CharT> randomText(std::mt19937& random, std::size_t n, const std::basic_string<CharT>& alphabet) {
+    std::basic_string<CharT> text(n, CharT());
+    for (CharT& c : text) {
+      c = alphabet[random() % alphabet.size()];
+    }
+    return text;
+  }
+
+  /// @brief helper function to check every mode over random buffers, returning the mismatches
+  template <typename CharT>
+  int checkBuffers(const std::basic_string<CharT>& alphabet, std::mt19937& random) {
+    typedef BasicTextSearch<CharT> Search;
+    int mismatches = 0;
+    for (int round = 0; round < 1000; round++) {
+      const std::basic_string<CharT> text = randomText(random, random() % 300, alphabet);
+      const std::basic_string<CharT> pattern = randomText(random, 1 + random() % ((round % 3) ? 3 : 24), alphabet);
+      for (unsigned flags = 0; flags < 4; flags++) {
+        const Search search(pattern, flags);
+        if (offsets(search.findAll(text.data(), text.size())) != naive(text, pattern, flags)) {
+          mismatches++;
+        }
+        const std::size_t from = random() % (text.size() + 1);
+        if (search.find(text.data(), text.size(), from) != naiveFind(text, pattern, flags, from)) {
+          mismatches++;
+        }
+      }
+    }
+    return mismatches;
+  }
+
+  /// @brief helper function to check every mode over edited piece tables, returning the mismatches
+  template <typename CharT>
+  int checkPieceTables(const std::basic_string<CharT>& alphabet, std::mt19937& random) {
+    typedef BasicTextSearch<CharT> Search;
+    const std::size_t CHUNK = Search::CHUNK;
+    int mismatches = 0;
+    for (int round = 0; round < 3; round++) {
+      // a little over two chunks, the pattern planted across the chunk edges & edits ...
+      const std::basic_string<CharT> pattern = randomText(random, 2 + random() % 6, alphabet);
+      BasicPieceTable<CharT> table(randomText(random, 2 * CHUNK + 1000, alphabet));
+      const std::size_t edges[] = { 0, CHUNK - 3, CHUNK - 1, CHUNK, 2 * CHUNK - pattern.size() / 2 };
+      for (std::size_t edge : edges) {
+        table.replace(edge, pattern.size(), pattern.data(), pattern.size());
+      }
+      for (int e = 0; e < 200; e++) {
+        const std::size_t pos = random() % table.size();
+        table.replace(pos, random() % 3, pattern.data(), 1 + random() % pattern.size());
+      }
+      const std::basic_string<CharT> text = table.str();
+      const std::basic_string<CharT> with = randomText(random, random() % 4, alphabet);
+      for (unsigned flags = 0; flags < 4; flags++) {
+        const Search search(pattern, flags);
+        if (offsets(search.findAll(table)) != naive(text, pattern, flags)) {
+          mismatches++;
+        }
+        const std::size_t from = CHUNK - 2 - random() % 8;
+        if (search.find(table, from) != naiveFind(text, pattern, flags, from)) {
+          mismatches++;
+        }
+        BasicPieceTable<CharT> replaced(table.str());
+        const std::size_t count = search.replaceAll(replaced, with);
+        if (count != naive(text, pattern, flags).size() || replaced.str() != naiveReplace(text, pattern, flags, with)) {
+          mismatches++;
+        }
+      }
+    }
+    return mismatches;
+  }
+}
+
+int main() {
+
+  std::mt19937 random(39);
+
+  // known cases ...
+  const std::string text = "Find the word, the WORD & words: word_ word.";
+  CHECK(offsets(TextSearch("word").findAll(text.data(), text.size())) == std::vector<std::size_t>({ 9, 26, 33, 39 }));
+  CHECK(TextSearch("word", TextSearch::IGNORE_CASE).findAll(text.data(), text.size()).size() == 5);
+  CHECK(offsets(TextSearch("word", TextSearch::WHOLE_WORD | TextSearch::IGNORE_CASE).findAll(text.data(), text.size()))
+    == std::vector<std::size_t>({ 9, 19, 39 }));
+  CHECK(TextSearch("aa").findAll("aaaaa", 5).size() == 2); // non-overlapping
+  CHECK(TextSearch("").find(text.data(), text.size()) == TextSearch::npos);
+  CHECK(TextSearch("word.").find(text.data(), text.size()) == 39);         // at the end of the text
+  const std::wstring wide = L"Ωmega, ωMEGA & \x212A" L"elvin kelvin";
+  CHECK(WTextSearch(L"ωmega", WTextSearch::IGNORE_CASE).findAll(wide.data(), wide.size()).size() == 2);
+  CHECK(WTextSearch(L"kelvin", WTextSearch::IGNORE_CASE).findAll(wide.data(), wide.size()).size() == 2);
+  CHECK(WTextSearch(L"mega", WTextSearch::WHOLE_WORD).find(wide.data(), wide.size()) == WTextSearch::npos);
+
+  // ... plain buffers, every mode, narrow & wide, dense candidates
+  CHECK(checkBuffers<char>("aAb_ .Z\xC3\xA9", random) == 0);
+  CHECK(checkBuffers<wchar_t>(L"aAb_ .Z\xE9\xC9\x212A" L"kK", random) == 0);
+
+  // ... piece tables, across pieces & chunks, replace-all included
+  CHECK(checkPieceTables<char>("abAB ", random) == 0);
+  CHECK(checkPieceTables<wchar_t>(L"ab\xE9\xC9 ", random) == 0);
+
+  return TEST_RESULT();
+}
\ No newline at end of file
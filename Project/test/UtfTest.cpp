@@ -0,0 +1,128 @@
+/*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*%*/
+/**
+  * @file 		UtfTest.cpp
+  * @brief 		Test of the `Utf` encoding helpers & of UTF-8 prefix searches (`StrTable`)
+  * @author 	&lambda;ambda
+  * @date     \showdate "%Y-%m-%d"
+  *
+  * @details 	Every codepoint is encoded & decoded back, in UTF-8 & in wide strings, &
+  *           items encoded the way the type-ahead index of `xDropDown` is are narrowed
+  *           character by character, non-ASCII characters included
+  */
+
+#include "./Test.h"
+#include "../dependencies/utils/str/StrTable.h"
+#include "../dependencies/utils/text/Utf.h"
+
+#include <vector>
+
+namespace {
+
+  /// @brief helper function to encode wide text as UTF-8 (see `xDropDown::toIndexText(...)`)
+  std::string utf8(const std::wstring& text) {
+    std::string out;
+    for (std::size_t i = 0; i < text.size(); ) {
+      Utf::append(out, Utf::next(text.data(), text.size(), i));
+    }
+    return out;
+  }
+
+  /// @brief helper function to decode UTF-8 as wide text (see `xDropDown::fromIndexText(...)`)
+  std::wstring wide(const std::string& text) {
+    std::wstring out;
+    for (std::size_t i = 0; i < text.size(); ) {
+      Utf::append(out, Utf::next(text.data(), text.size(), i));
+    }
+    return out;
+  }
+}
+
+int main() {
+
+  // every codepoint survives both encodings ...
+  int bad = 0;
+  for (std::uint32_t cp = 0; cp <= Utf::MAX_CODEPOINT; cp++) {
+    std::string narrow;
+    Utf::append(narrow, cp);
+    std::size_t i = 0;
+    const bool utf8Ok = Utf::next(narrow.data(), narrow.size(), i) == cp && i == narrow.size();
+    std::wstring w;
+    Utf::append(w, cp);
+    i = 0;
+    const bool surrogate = cp >= 0xD800 && cp <= 0xDFFF;
+    const bool wideOk = surrogate || (Utf::next(w.data(), w.size(), i) == cp && i == w.size());
+    if (!utf8Ok || !wideOk) {
+      bad++;
+    }
+  }
+  CHECK(bad == 0);
+
+  // ... with the expected lengths
+  std::string s;
+  Utf::append(s, 0x41);
+  Utf::append(s, 0xE9);
+  Utf::append(s, 0x4E2D);
+  Utf::append(s, 0x1F600);
+  CHECK(s == "A\xC3\xA9\xE4\xB8\xAD\xF0\x9F\x98\x80");
+  s.clear();
+  Utf::append(s, 0x110000);
+  CHECK(s == "\xEF\xBF\xBD"); // out of range => replacement
+  std::wstring w;
+  Utf::append(w, 0x1F600);
+  CHECK(w.size() == (sizeof(wchar_t) == 2 ? 2u : 1u));
+
+  // wide text round-trips through UTF-8, lone surrogates included
+  const std::wstring items[] = {
+    L"Zoe", L"Élodie", L"école", L"éclair", L"Ångström",
+    L"中文", L"中国", L"café", L"cafe", L"Café noir"
+  };
+  for (const std::wstring& item : items) {
+    CHECK(wide(utf8(item)) == item);
+  }
+  if (sizeof(wchar_t) == 2) {
+    const std::wstring lone(1, static_cast<wchar_t>(0xD83D));
+    CHECK(wide(utf8(lone)) == lone);
+  }
+
+  // type-ahead ~ narrowing the range character by character finds non-ASCII items
+  std::vector<std::string> names;
+  for (const std::wstring& item : items) {
+    names.push_back(utf8(item));
+  }
+  StrTable table;
+  table.assign(names);
+  CHECK(table.size() == names.size());
+
+  struct Typed {
+    const wchar_t* text;     ///< the typed characters
+    const wchar_t* first;    ///< the first item of the range, `nullptr` if none
+  };
+  const Typed TYPED[] = {
+    { L"éc",   L"éclair" },
+    { L"éco",  L"école" },
+    { L"中",    L"中国" },
+    { L"中文", L"中文" },
+    { L"café", L"café" },
+    { L"CAFé", L"café" },   // ASCII case ignored
+    { L"Ån",   L"Ångström" },
+    { L"Él",   L"Élodie" },
+    { L"él",   nullptr },          // non-ASCII case is not folded
+    { L"zz",        nullptr },
+  };
+  for (const Typed& typed : TYPED) {
+    std::string prefix;
+    std::pair<std::size_t, std::size_t> range(0, table.size());
+    for (const wchar_t* c = typed.text; *c; c++) {
+      prefix += utf8(std::wstring(1, *c));
+      range = table.prefixRange(prefix, range);
+    }
+    CHECK(range == table.prefixRange(prefix));
+    if (typed.first) {
+      CHECK(range.first < range.second && wide(table.str(range.first)) == typed.first);
+    } else {
+      CHECK(range.first >= range.second);
+    }
+  }
+
+  return TEST_RESULT();
+}
\ No newline at end of file